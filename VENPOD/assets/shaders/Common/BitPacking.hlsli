@@ -6,6 +6,7 @@
 #define BIT_PACKING_HLSLI
 
 #include "SharedTypes.hlsli"
+#include "MaterialTraits.hlsli"
 
 // Voxel bit layout (32-bit uint):
 //   Bits 31-24: State (IsStatic, IsIgnited, HasMoved, Life[4])
@@ -118,19 +119,15 @@ bool IsAir(uint voxel) {
 }
 
 bool IsSolid(uint voxel) {
-    uint mat = GetMaterial(voxel);
-    return mat == MAT_STONE || mat == MAT_BEDROCK || mat == MAT_GLASS;
+    return MaterialHasFlag(GetMaterial(voxel), MATFLAG_SOLID);
 }
 
 bool IsLiquid(uint voxel) {
-    uint mat = GetMaterial(voxel);
-    return mat == MAT_WATER || mat == MAT_LAVA || mat == MAT_OIL ||
-           mat == MAT_ACID || mat == MAT_HONEY || mat == MAT_CONCRETE;
+    return MaterialHasFlag(GetMaterial(voxel), MATFLAG_LIQUID);
 }
 
 bool IsPowder(uint voxel) {
-    uint mat = GetMaterial(voxel);
-    return mat == MAT_SAND || mat == MAT_DIRT;
+    return MaterialHasFlag(GetMaterial(voxel), MATFLAG_POWDER);
 }
 
 bool CanFall(uint voxel) {
@@ -6,6 +6,7 @@
 
 #include "../Common/SharedTypes.hlsli"
 #include "../Common/BitPacking.hlsli"
+#include "../Common/MaterialTraits.hlsli"
 
 // Constants for chunk scanning
 cbuffer ChunkScanConstants : register(b0) {
@@ -48,17 +49,9 @@ bool IsVoxelActive(uint voxel) {
     // Static voxels (bedrock, frozen) are not active
     if (state & STATE_IS_STATIC) return false;
 
-    // Falling materials (sand, water, etc.) are active
-    if (material == MAT_SAND || material == MAT_WATER ||
-        material == MAT_LAVA || material == MAT_OIL) {
-        return true;
-    }
-
-    // Fire is always active
-    if (material == MAT_FIRE) return true;
-
-    // Everything else is potentially active but settled
-    return false;
+    // Falling materials and fire are active; everything else is potentially
+    // active but settled (MATFLAG_ACTIVE in MaterialTraits)
+    return MaterialHasFlag(material, MATFLAG_ACTIVE);
 }
 
 // Thread group: one thread per voxel in chunk (16x16x16 = 4096 threads)
@@ -7,6 +7,7 @@
 #include "../Common/SharedTypes.hlsli"
 #include "../Common/MortonCode.hlsli"
 #include "../Common/BitPacking.hlsli"
+#include "../Common/MaterialTraits.hlsli"
 
 // Physics constants
 cbuffer PhysicsConstants : register(b0) {
@@ -35,11 +36,9 @@ StructuredBuffer<uint> VoxelGridIn : register(t1);
 // Output voxel grid (write)
 RWStructuredBuffer<uint> VoxelGridOut : register(u0);
 
-// Material properties lookup (helpers for physics)
+// Material properties lookup (helpers for physics) - one table load each, see MaterialTraits.hlsli
 bool IsMovable(uint material) {
-    return material == MAT_SAND || material == MAT_WATER || material == MAT_LAVA || material == MAT_OIL ||
-           material == MAT_SMOKE || material == MAT_FIRE || material == MAT_ACID || material == MAT_HONEY ||
-           material == MAT_CONCRETE || material == MAT_GUNPOWDER || material == MAT_STEAM;
+    return MaterialHasFlag(material, MATFLAG_MOVABLE);
 }
 
 bool IsEmpty(uint material) {
@@ -47,19 +46,12 @@ bool IsEmpty(uint material) {
 }
 
 bool IsFlammable(uint material) {
-    return material == MAT_WOOD || material == MAT_OIL || material == MAT_GUNPOWDER;
+    return MaterialHasFlag(material, MATFLAG_FLAMMABLE);
 }
 
 bool IsDissolvable(uint material) {
     // Materials that acid can dissolve
-    return material == MAT_STONE || material == MAT_DIRT || material == MAT_WOOD ||
-           material == MAT_SAND || material == MAT_ICE || material == MAT_CONCRETE;
-}
-
-bool IsLiquidOrGas(uint material) {
-    return material == MAT_WATER || material == MAT_LAVA || material == MAT_OIL ||
-           material == MAT_ACID || material == MAT_HONEY || material == MAT_CONCRETE ||
-           material == MAT_SMOKE || material == MAT_STEAM;
+    return MaterialHasFlag(material, MATFLAG_DISSOLVABLE);
 }
 
 // Decompose chunk index to 3D position
@@ -109,8 +101,7 @@ int GetLiquidColumnHeight(int3 pos) {
         uint voxel = GetVoxelSafe(checkPos);
         uint mat = GetMaterial(voxel);
 
-        if (mat == MAT_WATER || mat == MAT_OIL || mat == MAT_LAVA ||
-            mat == MAT_ACID || mat == MAT_HONEY || mat == MAT_CONCRETE) {
+        if (MaterialHasFlag(mat, MATFLAG_LIQUID)) {
             surfaceY = checkY;  // Update surface height
         } else if (!IsEmpty(mat)) {
             break;  // Hit solid - stop scanning
@@ -440,6 +431,13 @@ void main(uint3 groupId : SV_GroupID, uint3 groupThreadId : SV_GroupThreadID) {
                         continue;
                     }
 
+                    // Density displacement: sink through a lighter liquid or gas
+                    if (CanDisplaceMaterial(material, belowMaterial)) {
+                        SetVoxel(uint3(pos), belowVoxel);
+                        SetVoxel(uint3(belowPos), PackVoxel(material, GetVariant(currentVoxel), 0, 0));
+                        continue;
+                    }
+
                     // Sand: try diagonal down (slide)
                     if (material == MAT_SAND) {
                         // Random direction based on position + frame
@@ -706,7 +704,7 @@ void main(uint3 groupId : SV_GroupID, uint3 groupThreadId : SV_GroupThreadID) {
                         }
                     }
 
-                    // Oil: like water but floats on water
+                    // Oil: like water but floats on water (lighter, see MaterialTraits)
                     if (material == MAT_OIL) {
                         uint rng = PCGHash(pos.x + pos.y * 1000 + pos.z * 1000000 + frameIndex);
 
@@ -737,16 +735,9 @@ void main(uint3 groupId : SV_GroupID, uint3 groupThreadId : SV_GroupThreadID) {
 
                         bool moved = false;
 
-                        // Oil floats on water - swap positions if oil is above water
-                        if (belowMaterial == MAT_WATER) {
-                            // Swap: oil goes up, water goes down
-                            outputVoxel = PackVoxel(MAT_WATER, GetVariant(belowVoxel), 0, 0);  // Water moves up
-                            SetVoxel(uint3(pos), outputVoxel);
-                            SetVoxel(uint3(belowPos), PackVoxel(MAT_OIL, GetVariant(currentVoxel), 0, 0));  // Oil stays below
-                            continue;  // Done processing this voxel
-                        }
+                        // Oil floats on water through density displacement (water sinks through oil)
 
-                        // Diagonal flow (only if not on water)
+                        // Diagonal flow
                         if (!moved && !IsEmpty(belowMaterial)) {
                             int3 diagonals[4];
                             diagonals[0] = pos + int3(1, -1, 0);
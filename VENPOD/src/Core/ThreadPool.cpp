@@ -0,0 +1,103 @@
+#include "ThreadPool.h"
+#include <algorithm>
+
+namespace VENPOD {
+
+ThreadPool::~ThreadPool() {
+    Shutdown();
+}
+
+void ThreadPool::Initialize(uint32_t workerCount) {
+    Shutdown();
+
+    if (workerCount == 0) {
+        workerCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    m_stopping = false;
+    m_threads.reserve(workerCount - 1);
+    for (uint32_t i = 1; i < workerCount; ++i) {
+        m_threads.emplace_back([this, i]() { WorkerLoop(i); });
+    }
+}
+
+void ThreadPool::Shutdown() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_wakeCondition.notify_all();
+
+    for (auto& thread : m_threads) {
+        if (thread.joinable()) {
+            thread.join();
+        }
+    }
+    m_threads.clear();
+}
+
+void ThreadPool::ParallelFor(uint32_t count, const JobFunction& job) {
+    if (count == 0) {
+        return;
+    }
+
+    // Serial fast path - no point waking workers for a single item
+    if (m_threads.empty() || count == 1) {
+        for (uint32_t i = 0; i < count; ++i) {
+            job(i, 0);
+        }
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_job = &job;
+        m_jobCount = count;
+        m_nextIndex.store(0, std::memory_order_relaxed);
+        m_busyWorkers = static_cast<uint32_t>(m_threads.size());
+        ++m_generation;
+    }
+    m_wakeCondition.notify_all();
+
+    // Calling thread works too
+    RunJob(0);
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_doneCondition.wait(lock, [this]() { return m_busyWorkers == 0; });
+    m_job = nullptr;
+}
+
+void ThreadPool::WorkerLoop(uint32_t workerIndex) {
+    uint64_t seenGeneration = 0;
+
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_wakeCondition.wait(lock, [&]() { return m_stopping || m_generation != seenGeneration; });
+            if (m_stopping) {
+                return;
+            }
+            seenGeneration = m_generation;
+        }
+
+        RunJob(workerIndex);
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (--m_busyWorkers == 0) {
+            m_doneCondition.notify_one();
+        }
+    }
+}
+
+void ThreadPool::RunJob(uint32_t workerIndex) {
+    // Dynamic scheduling: workers grab the next index until the range is exhausted
+    while (true) {
+        uint32_t index = m_nextIndex.fetch_add(1, std::memory_order_relaxed);
+        if (index >= m_jobCount) {
+            break;
+        }
+        (*m_job)(index, workerIndex);
+    }
+}
+
+} // namespace VENPOD
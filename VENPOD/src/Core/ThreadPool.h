@@ -0,0 +1,61 @@
+#pragma once
+
+// =============================================================================
+// VENPOD Thread Pool - Fixed set of worker threads for data-parallel CPU work
+// The calling thread participates as worker 0, so a pool of N workers spawns
+// N-1 threads. ParallelFor blocks until every index has been processed.
+// =============================================================================
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace VENPOD {
+
+class ThreadPool {
+public:
+    // Job signature: (itemIndex, workerIndex). workerIndex is in [0, GetWorkerCount())
+    using JobFunction = std::function<void(uint32_t, uint32_t)>;
+
+    ThreadPool() = default;
+    ~ThreadPool();
+
+    // Non-copyable
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // Spawn workers. workerCount = 0 uses std::thread::hardware_concurrency()
+    void Initialize(uint32_t workerCount = 0);
+    void Shutdown();
+
+    // Total workers including the calling thread
+    uint32_t GetWorkerCount() const { return static_cast<uint32_t>(m_threads.size()) + 1; }
+
+    // Run job(i, worker) for every i in [0, count) and wait for completion.
+    // Not reentrant - must only be called from one thread at a time.
+    void ParallelFor(uint32_t count, const JobFunction& job);
+
+private:
+    void WorkerLoop(uint32_t workerIndex);
+    void RunJob(uint32_t workerIndex);
+
+    std::vector<std::thread> m_threads;
+
+    std::mutex m_mutex;
+    std::condition_variable m_wakeCondition;   // Signals workers that a job is ready
+    std::condition_variable m_doneCondition;   // Signals caller that workers finished
+    uint64_t m_generation = 0;                 // Incremented per job
+    uint32_t m_busyWorkers = 0;                // Spawned workers still inside the current job
+    bool m_stopping = false;
+
+    // Current job (valid while ParallelFor is running)
+    const JobFunction* m_job = nullptr;
+    uint32_t m_jobCount = 0;
+    std::atomic<uint32_t> m_nextIndex{0};
+};
+
+} // namespace VENPOD
@@ -0,0 +1,162 @@
+#include "AsyncChunkGenerator.h"
+#include "TerrainGenerator.h"
+#include <algorithm>
+#include <spdlog/spdlog.h>
+
+namespace VENPOD::Simulation {
+
+AsyncChunkGenerator::~AsyncChunkGenerator() {
+    Shutdown();
+}
+
+void AsyncChunkGenerator::Initialize(uint32_t workerCount, uint32_t worldSeed, uint32_t chunkSize, bool columnCache,
+                                     uint32_t caveLattice) {
+    Shutdown();
+
+    if (workerCount == 0) {
+        workerCount = std::max(1u, std::thread::hardware_concurrency()) - 1;
+    }
+    workerCount = std::max(workerCount, 1u);
+
+    m_worldSeed = worldSeed;
+    m_chunkSize = chunkSize;
+    m_useColumnCache = columnCache;
+    m_caveLattice = caveLattice;
+    m_columnCache.Initialize(chunkSize, worldSeed);
+    m_stopping = false;
+    m_threads.reserve(workerCount);
+    for (uint32_t i = 0; i < workerCount; ++i) {
+        m_threads.emplace_back([this]() { WorkerLoop(); });
+    }
+
+    if (caveLattice != CAVE_LATTICE_EXACT) {
+        spdlog::info("AsyncChunkGenerator initialized - {} workers, seed {}, cave lattice {}", workerCount, worldSeed,
+            caveLattice);
+    } else {
+        spdlog::info("AsyncChunkGenerator initialized - {} workers, seed {}", workerCount, worldSeed);
+    }
+}
+
+void AsyncChunkGenerator::Shutdown() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_wakeCondition.notify_all();
+
+    for (auto& thread : m_threads) {
+        if (thread.joinable()) {
+            thread.join();
+        }
+    }
+    m_threads.clear();
+
+    m_requests.clear();
+    m_completed.clear();
+    m_outstanding.Clear();
+    m_activeJobs = 0;
+    m_columnCache.Shutdown();
+}
+
+bool AsyncChunkGenerator::Submit(const ChunkCoord& coord) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_outstanding.Insert(coord, 1)) {
+            return false;
+        }
+        m_requests.push_back(coord);
+    }
+    m_wakeCondition.notify_one();
+    return true;
+}
+
+size_t AsyncChunkGenerator::CancelIf(const std::function<bool(const ChunkCoord&)>& predicate) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    size_t before = m_requests.size();
+    auto kept = std::remove_if(m_requests.begin(), m_requests.end(), [&](const ChunkCoord& coord) {
+        if (predicate(coord)) {
+            m_outstanding.Erase(coord);
+            return true;
+        }
+        return false;
+    });
+    m_requests.erase(kept, m_requests.end());
+    return before - m_requests.size();
+}
+
+size_t AsyncChunkGenerator::PollCompleted(std::vector<GeneratedChunk>& out, size_t maxCount) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    size_t count = std::min(maxCount, m_completed.size());
+    for (size_t i = 0; i < count; ++i) {
+        m_outstanding.Erase(m_completed[i].coord);
+        out.push_back(std::move(m_completed[i]));
+    }
+    m_completed.erase(m_completed.begin(), m_completed.begin() + count);
+    return count;
+}
+
+void AsyncChunkGenerator::WaitIdle() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_idleCondition.wait(lock, [this]() { return m_requests.empty() && m_activeJobs == 0; });
+}
+
+size_t AsyncChunkGenerator::GetOutstandingCount() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_outstanding.Size();
+}
+
+bool AsyncChunkGenerator::IsOutstanding(const ChunkCoord& coord) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_outstanding.Contains(coord);
+}
+
+void AsyncChunkGenerator::WorkerLoop() {
+    // Raw output of one chunk, reused for every chunk this worker generates
+    std::vector<uint32_t> voxels(static_cast<size_t>(m_chunkSize) * m_chunkSize * m_chunkSize);
+
+    while (true) {
+        ChunkCoord coord;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_wakeCondition.wait(lock, [this]() { return m_stopping || !m_requests.empty(); });
+            if (m_stopping) {
+                return;
+            }
+            coord = m_requests.front();
+            m_requests.pop_front();
+            ++m_activeJobs;
+        }
+
+        // ===== Generate and compress outside the lock =====
+        int32_t originX, originY, originZ;
+        coord.GetWorldOrigin(originX, originY, originZ, m_chunkSize);
+        std::shared_ptr<const TerrainColumn> column;
+        if (m_useColumnCache) {
+            column = m_columnCache.Acquire(coord.x, coord.z);
+        }
+
+        GeneratedChunk result;
+        result.coord = coord;
+        result.voxels.SetVariantOrigin(originX, originY, originZ, m_worldSeed);
+
+        // Sky and open water above the column's terrain: one value, nothing to generate
+        uint32_t uniformVoxel = 0;
+        if (column && PredictUniformChunk(originY, m_chunkSize, *column, uniformVoxel)) {
+            result.voxels.Initialize(m_chunkSize, uniformVoxel);
+        } else {
+            GenerateChunkVoxels(originX, originY, originZ, m_chunkSize, m_worldSeed, voxels.data(), column.get(),
+                m_caveLattice);
+            result.voxels.Initialize(m_chunkSize);
+            result.voxels.Encode(voxels.data());
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_completed.push_back(std::move(result));
+            --m_activeJobs;
+        }
+        m_idleCondition.notify_all();
+    }
+}
+
+} // namespace VENPOD::Simulation
@@ -0,0 +1,103 @@
+#pragma once
+
+// =============================================================================
+// VENPOD Async Chunk Generator - Background CPU terrain generation
+// Worker threads take chunk coordinates from a request queue (FIFO, so the
+// caller's priority order is kept), run GenerateChunkVoxels and encode the
+// result straight into PalettedVoxels with procedural variants, then post it
+// to a completion queue. The owner polls completions once per frame and only
+// has to adopt the compressed voxels and upload them - generation scales with
+// cores and overlaps the frame instead of costing a GPU dispatch per chunk.
+// Terrain height and biome values are shared by the vertically stacked chunks
+// of a column through a TerrainColumnCache; chunks those heights prove uniform
+// (sky, open water) are not generated at all.
+// =============================================================================
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "ChunkCoord.h"
+#include "ChunkCoordMap.h"
+#include "PalettedVoxels.h"
+#include "TerrainColumnCache.h"
+#include "TerrainGenerator.h"
+
+namespace VENPOD::Simulation {
+
+struct GeneratedChunk {
+    ChunkCoord coord;
+    PalettedVoxels voxels;      // Variant origin and seed already set
+};
+
+class AsyncChunkGenerator {
+public:
+    AsyncChunkGenerator() = default;
+    ~AsyncChunkGenerator();
+
+    // Non-copyable
+    AsyncChunkGenerator(const AsyncChunkGenerator&) = delete;
+    AsyncChunkGenerator& operator=(const AsyncChunkGenerator&) = delete;
+
+    // Spawn workers. workerCount = 0 uses hardware_concurrency - 1 (the
+    // calling thread keeps rendering), at least 1. columnCache = false
+    // recomputes the column values for every chunk (for comparisons).
+    // caveLattice is passed to GenerateChunkVoxels (CAVE_LATTICE_EXACT or a
+    // lattice spacing such as 4 or 8).
+    void Initialize(uint32_t workerCount, uint32_t worldSeed, uint32_t chunkSize, bool columnCache = true,
+                    uint32_t caveLattice = CAVE_LATTICE_EXACT);
+    // Stops the workers; requests not yet generated and unpolled results are dropped
+    void Shutdown();
+
+    bool IsInitialized() const { return !m_threads.empty(); }
+    uint32_t GetWorkerCount() const { return static_cast<uint32_t>(m_threads.size()); }
+
+    // Request a chunk; returns false if it is already requested and not yet polled
+    bool Submit(const ChunkCoord& coord);
+
+    // Withdraw requests that no worker has started (e.g. chunks that left the
+    // render distance); returns how many were dropped
+    size_t CancelIf(const std::function<bool(const ChunkCoord&)>& predicate);
+
+    // Move up to maxCount finished chunks into `out` (appended); returns the count
+    size_t PollCompleted(std::vector<GeneratedChunk>& out, size_t maxCount = SIZE_MAX);
+
+    // Block until every submitted chunk is finished (pre-generation, tools)
+    void WaitIdle();
+
+    // Forget cached terrain columns beyond `radius` chunks of (centerX,
+    // centerZ); call with the horizontal streaming radius as the camera moves
+    size_t EvictColumnsOutside(int32_t centerX, int32_t centerZ, int32_t radius) {
+        return m_columnCache.EvictOutside(centerX, centerZ, radius);
+    }
+    const TerrainColumnCache& GetColumnCache() const { return m_columnCache; }
+
+    // Requested and not yet polled (queued, generating or completed)
+    size_t GetOutstandingCount() const;
+    bool IsOutstanding(const ChunkCoord& coord) const;
+
+private:
+    void WorkerLoop();
+
+    std::vector<std::thread> m_threads;
+    uint32_t m_worldSeed = 0;
+    uint32_t m_chunkSize = 64;
+    bool m_useColumnCache = true;
+    uint32_t m_caveLattice = CAVE_LATTICE_EXACT;
+    TerrainColumnCache m_columnCache;
+
+    mutable std::mutex m_mutex;
+    std::condition_variable m_wakeCondition;    // Signals workers that requests are queued
+    std::condition_variable m_idleCondition;    // Signals WaitIdle that a chunk finished
+    std::deque<ChunkCoord> m_requests;
+    std::vector<GeneratedChunk> m_completed;
+    ChunkCoordMap<uint8_t> m_outstanding;       // Requested and not yet polled
+    uint32_t m_activeJobs = 0;                  // Chunks being generated right now
+    bool m_stopping = false;
+};
+
+} // namespace VENPOD::Simulation
@@ -0,0 +1,415 @@
+#include "BitboardKernel.h"
+#include "../Utils/MortonCode.h"
+#include "../Utils/PCGRandom.h"
+#include <algorithm>
+#include <array>
+#include <bit>
+
+namespace VENPOD::Simulation {
+
+using namespace Utils;
+
+namespace {
+
+struct MoveDir {
+    int32_t dx, dy, dz;
+};
+
+// Same directions and order as kDiagonalsDown / kHorizontals in CPUPhysicsKernel
+constexpr MoveDir kWaterDiagonals[4] = {
+    { 1, -1, 0}, {-1, -1, 0}, {0, -1, 1}, {0, -1, -1}
+};
+
+constexpr MoveDir kWaterHorizontals[4] = {
+    { 1, 0, 0}, {-1, 0, 0}, {0, 0, 1}, {0, 0, -1}
+};
+
+// Align a target row to source bits: result bit x holds target bit x + dx
+void AlignToSource(const uint64_t* target, uint64_t* out, uint32_t words, int32_t dx) {
+    if (dx == 0) {
+        std::copy(target, target + words, out);
+    } else if (dx > 0) {
+        for (uint32_t w = 0; w < words; ++w) {
+            uint64_t carry = (w + 1 < words) ? (target[w + 1] << 63) : 0;
+            out[w] = (target[w] >> 1) | carry;
+        }
+    } else {
+        for (uint32_t w = 0; w < words; ++w) {
+            uint64_t carry = (w > 0) ? (target[w - 1] >> 63) : 0;
+            out[w] = (target[w] << 1) | carry;
+        }
+    }
+}
+
+} // namespace
+
+void BitboardKernel::Initialize(uint32_t gridSizeX, uint32_t gridSizeY, uint32_t gridSizeZ) {
+    m_gridSizeX = gridSizeX;
+    m_gridSizeY = gridSizeY;
+    m_gridSizeZ = gridSizeZ;
+    m_wordsPerRow = (gridSizeX + 63) / 64;
+
+    uint32_t tailBits = gridSizeX % 64;
+    m_lastWordMask = tailBits == 0 ? ~0ull : ((1ull << tailBits) - 1);
+
+    size_t totalWords = static_cast<size_t>(m_wordsPerRow) * gridSizeY * gridSizeZ;
+    m_occupied.assign(totalWords, 0);
+    m_sand.assign(totalWords, 0);
+    m_water.assign(totalWords, 0);
+    m_claimed.assign(totalWords, 0);
+}
+
+void BitboardKernel::Shutdown() {
+    m_occupied.clear();
+    m_sand.clear();
+    m_water.clear();
+    m_claimed.clear();
+    m_wordsPerRow = 0;
+}
+
+void BitboardKernel::BuildSlice(const uint32_t* voxels, uint32_t z, const uint32_t* chunkVoxelCounts,
+                                uint32_t chunkCountX, uint32_t chunkCountY) {
+    uint32_t cz = z / CHUNK_SIZE;
+
+    for (uint32_t y = 0; y < m_gridSizeY; ++y) {
+        uint32_t offset = RowOffset(y, z);
+        std::fill_n(&m_claimed[offset], m_wordsPerRow, 0);
+
+        // Whole chunk row empty - nothing to decode
+        uint32_t cy = y / CHUNK_SIZE;
+        const uint32_t* chunkRow = &chunkVoxelCounts[(cz * chunkCountY + cy) * chunkCountX];
+        bool anyVoxels = std::any_of(chunkRow, chunkRow + chunkCountX, [](uint32_t count) { return count > 0; });
+        if (!anyVoxels) {
+            std::fill_n(&m_occupied[offset], m_wordsPerRow, 0);
+            std::fill_n(&m_sand[offset], m_wordsPerRow, 0);
+            std::fill_n(&m_water[offset], m_wordsPerRow, 0);
+            continue;
+        }
+
+        const uint32_t* row = &voxels[LinearIndex3D(0, y, z, m_gridSizeX, m_gridSizeY)];
+        for (uint32_t w = 0; w < m_wordsPerRow; ++w) {
+            uint32_t baseX = w * 64;
+            uint32_t bits = std::min(64u, m_gridSizeX - baseX);
+
+            uint64_t occupied = 0;
+            uint64_t sand = 0;
+            uint64_t water = 0;
+            for (uint32_t b = 0; b < bits; ++b) {
+                uint8_t mat = UnpackMaterial(row[baseX + b]);
+                occupied |= static_cast<uint64_t>(mat != Material::Air) << b;
+                sand |= static_cast<uint64_t>(mat == Material::Sand) << b;
+                water |= static_cast<uint64_t>(mat == Material::Water) << b;
+            }
+            m_occupied[offset + w] = occupied;
+            m_sand[offset + w] = sand;
+            m_water[offset + w] = water;
+        }
+    }
+}
+
+void BitboardKernel::UpdateSlice(const uint32_t* voxels, uint32_t z, const uint64_t* staleBricks,
+                                 uint32_t chunkCountX, uint32_t chunkCountY) {
+    uint32_t cz = z / CHUNK_SIZE;
+    uint32_t localZ = z % CHUNK_SIZE;
+
+    for (uint32_t cy = 0; cy < chunkCountY; ++cy) {
+        const uint64_t* chunkRow = &staleBricks[(cz * chunkCountY + cy) * chunkCountX];
+        for (uint32_t cx = 0; cx < chunkCountX; ++cx) {
+            uint64_t bricks = chunkRow[cx];
+            if (bricks == 0) {
+                continue;
+            }
+            uint32_t baseX = cx * CHUNK_SIZE;
+            uint32_t baseY = cy * CHUNK_SIZE;
+            uint32_t endX = std::min(baseX + CHUNK_SIZE, m_gridSizeX);
+            uint32_t endY = std::min(baseY + CHUNK_SIZE, m_gridSizeY);
+
+            for (uint32_t y = baseY; y < endY; ++y) {
+                uint32_t rowBricks = static_cast<uint32_t>(bricks >> LocalBrickIndex(0, y - baseY, localZ)) &
+                                     ((1u << CHUNK_BRICKS_PER_AXIS) - 1);
+                if (rowBricks == 0) {
+                    continue;
+                }
+                uint32_t w = RowOffset(y, z) + baseX / 64;
+                const uint32_t* row = &voxels[LinearIndex3D(0, y, z, m_gridSizeX, m_gridSizeY)];
+
+                // Decode the stale bricks' voxels, then splice them into the words
+                uint64_t stale = 0;
+                uint64_t occupied = 0;
+                uint64_t sand = 0;
+                uint64_t water = 0;
+                for (; rowBricks; rowBricks &= rowBricks - 1) {
+                    uint32_t x0 = baseX + static_cast<uint32_t>(std::countr_zero(rowBricks)) * BRICK_SIZE;
+                    uint32_t x1 = std::min(x0 + BRICK_SIZE, endX);
+                    for (uint32_t x = x0; x < x1; ++x) {
+                        uint8_t mat = UnpackMaterial(row[x]);
+                        uint32_t b = x % 64;
+                        stale |= 1ull << b;
+                        occupied |= static_cast<uint64_t>(mat != Material::Air) << b;
+                        sand |= static_cast<uint64_t>(mat == Material::Sand) << b;
+                        water |= static_cast<uint64_t>(mat == Material::Water) << b;
+                    }
+                }
+                m_occupied[w] = (m_occupied[w] & ~stale) | occupied;
+                m_sand[w] = (m_sand[w] & ~stale) | sand;
+                m_water[w] = (m_water[w] & ~stale) | water;
+                m_claimed[w] &= ~stale;
+            }
+        }
+    }
+}
+
+void BitboardKernel::SimulateSlices(const CPUPhysicsContext& ctx, const uint8_t* chunkEligible,
+                                    uint32_t zBegin, uint32_t zEnd, CPUPhysicsStats& stats) {
+    const uint32_t words = m_wordsPerRow;
+    const uint32_t segmentsPerWord = 64 / CHUNK_SIZE;
+    const uint64_t segmentMask = (CHUNK_SIZE == 64) ? ~0ull : ((1ull << CHUNK_SIZE) - 1);
+
+    std::vector<uint64_t> moved(words);
+    std::vector<uint64_t> occupiedBelow(words);
+    std::vector<uint64_t> available(words);
+    std::vector<uint64_t> scratch(words);
+    std::vector<uint64_t> candidates(words);
+
+    // Free cells (empty in READ, not yet claimed) of row (y, z), aligned to source bits
+    auto buildAvailable = [&](int32_t y, int32_t z, int32_t dx) {
+        if (y < 0 || y >= static_cast<int32_t>(m_gridSizeY) || z < 0 || z >= static_cast<int32_t>(m_gridSizeZ)) {
+            std::fill(available.begin(), available.end(), 0);
+            return;
+        }
+        uint32_t offset = RowOffset(static_cast<uint32_t>(y), static_cast<uint32_t>(z));
+        for (uint32_t w = 0; w < words; ++w) {
+            uint64_t valid = (w + 1 == words) ? m_lastWordMask : ~0ull;
+            scratch[w] = ~m_occupied[offset + w] & ~m_claimed[offset + w] & valid;
+        }
+        AlignToSource(scratch.data(), available.data(), words, dx);
+    };
+
+    // Move every voxel whose bit is set in `mask` by (dx, dy, dz)
+    auto applyMoves = [&](const std::vector<uint64_t>& mask, uint32_t y, uint32_t z, const MoveDir& dir, uint8_t material) {
+        uint32_t ty = static_cast<uint32_t>(static_cast<int32_t>(y) + dir.dy);
+        uint32_t tz = static_cast<uint32_t>(static_cast<int32_t>(z) + dir.dz);
+        uint32_t targetOffset = RowOffset(ty, tz);
+
+        for (uint32_t w = 0; w < words; ++w) {
+            uint64_t bits = mask[w];
+            moved[w] |= bits;
+            while (bits) {
+                uint32_t x = w * 64 + static_cast<uint32_t>(std::countr_zero(bits));
+                bits &= bits - 1;
+
+                uint32_t tx = static_cast<uint32_t>(static_cast<int32_t>(x) + dir.dx);
+                uint32_t src = LinearIndex3D(x, y, z, ctx.gridSizeX, ctx.gridSizeY);
+                uint32_t dst = LinearIndex3D(tx, ty, tz, ctx.gridSizeX, ctx.gridSizeY);
+
+                ctx.voxelsOut[dst] = PackVoxel(material, UnpackVariant(ctx.voxelsIn[src]), 0, 0);
+                ctx.voxelsOut[src] = PackVoxel(Material::Air, 0, 0, 0);
+                MarkLiquidColumnDirty(ctx, x, z);
+                MarkLiquidColumnDirty(ctx, tx, tz);
+                MarkVoxelChanged(ctx, x, y, z);
+                MarkVoxelChanged(ctx, tx, ty, tz);
+                m_claimed[targetOffset + tx / 64] |= 1ull << (tx % 64);
+                ++stats.voxelsMoved;
+            }
+        }
+    };
+
+    // Move sources into free cells of the target row in one masked step.
+    // Within a single direction every source has a distinct target.
+    auto tryMove = [&](const std::vector<uint64_t>& sources, uint32_t y, uint32_t z, const MoveDir& dir, uint8_t material) {
+        buildAvailable(static_cast<int32_t>(y) + dir.dy, static_cast<int32_t>(z) + dir.dz, dir.dx);
+        bool any = false;
+        for (uint32_t w = 0; w < words; ++w) {
+            candidates[w] = sources[w] & ~moved[w] & available[w];
+            any |= candidates[w] != 0;
+        }
+        if (any) {
+            applyMoves(candidates, y, z, dir, material);
+        }
+    };
+
+    std::vector<uint64_t> sand(words);
+    std::vector<uint64_t> water(words);
+    std::vector<uint64_t> preferPlus(words);
+    std::vector<uint64_t> preferMinus(words);
+    std::array<std::vector<uint64_t>, 4> startMask;
+    startMask.fill(std::vector<uint64_t>(words));
+    std::vector<uint64_t> sources(words);
+
+    // Split water into four masks by a random 2-bit start direction per voxel
+    auto buildStartMasks = [&](uint32_t y, uint32_t z, uint32_t salt) {
+        for (uint32_t w = 0; w < words; ++w) {
+            uint32_t seed = w * 64u + y * 1000u + z * 1000000u + ctx.frameIndex;
+            uint64_t low = water[w] ? PCGHash64(seed ^ salt) : 0;
+            uint64_t high = water[w] ? PCGHash64(seed ^ (salt * 3u)) : 0;
+            startMask[0][w] = water[w] & ~low & ~high;
+            startMask[1][w] = water[w] & low & ~high;
+            startMask[2][w] = water[w] & ~low & high;
+            startMask[3][w] = water[w] & low & high;
+        }
+    };
+
+    for (uint32_t z = zBegin; z < zEnd; ++z) {
+        uint32_t cz = z / CHUNK_SIZE;
+
+        for (uint32_t y = 0; y < m_gridSizeY; ++y) {
+            uint32_t cy = y / CHUNK_SIZE;
+            uint32_t offset = RowOffset(y, z);
+
+            // ===== STEP 1: Sources in the simulated bricks of eligible chunks =====
+            uint32_t brickShift = LocalBrickIndex(0, y % CHUNK_SIZE, z % CHUNK_SIZE);
+            bool anySource = false;
+            for (uint32_t w = 0; w < words; ++w) {
+                uint64_t mask = 0;
+                for (uint32_t s = 0; s < segmentsPerWord; ++s) {
+                    uint32_t cx = w * segmentsPerWord + s;
+                    uint32_t chunkIndex = (cz * ctx.chunkCountY + cy) * ctx.chunkCountX + cx;
+                    if (cx >= ctx.chunkCountX || !chunkEligible[chunkIndex]) {
+                        continue;
+                    }
+                    uint64_t segment = segmentMask;
+                    if (ctx.simulateBricks) {
+                        uint32_t rowBricks = static_cast<uint32_t>(ctx.simulateBricks[chunkIndex] >> brickShift);
+                        segment = 0;
+                        for (uint32_t bx = 0; bx < CHUNK_BRICKS_PER_AXIS; ++bx) {
+                            if (rowBricks & (1u << bx)) {
+                                segment |= ((1ull << BRICK_SIZE) - 1) << (bx * BRICK_SIZE);
+                            }
+                        }
+                    }
+                    mask |= segment << (s * CHUNK_SIZE);
+                }
+                sand[w] = m_sand[offset + w] & mask;
+                water[w] = m_water[offset + w] & mask;
+                moved[w] = 0;
+                stats.voxelsProcessed += static_cast<uint64_t>(std::popcount(m_occupied[offset + w] & mask));
+                anySource |= (sand[w] | water[w]) != 0;
+            }
+
+            // Floor row can't move (same as belowPos.y < 0 in the scalar kernel)
+            if (!anySource || y == 0) {
+                continue;
+            }
+
+            // ===== STEP 2: Fall straight down =====
+            tryMove(sand, y, z, MoveDir{0, -1, 0}, Material::Sand);
+            tryMove(water, y, z, MoveDir{0, -1, 0}, Material::Water);
+
+            // Everything below only applies to voxels resting on something in READ
+            uint32_t belowOffset = RowOffset(y - 1, z);
+            bool anyResting = false;
+            for (uint32_t w = 0; w < words; ++w) {
+                occupiedBelow[w] = m_occupied[belowOffset + w];
+                sand[w] &= occupiedBelow[w] & ~moved[w];
+                water[w] &= occupiedBelow[w] & ~moved[w];
+                anyResting |= (sand[w] | water[w]) != 0;
+            }
+            if (!anyResting) {
+                continue;
+            }
+
+            // ===== STEP 2b: Sand sinks through water (density displacement) =====
+            // Per-voxel check that the water below is still untouched in WRITE,
+            // same as CanModify in the scalar kernel
+            for (uint32_t w = 0; w < words; ++w) {
+                uint64_t bits = sand[w] & m_water[belowOffset + w];
+                while (bits) {
+                    uint32_t b = static_cast<uint32_t>(std::countr_zero(bits));
+                    bits &= bits - 1;
+                    uint32_t x = w * 64 + b;
+
+                    uint32_t src = LinearIndex3D(x, y, z, ctx.gridSizeX, ctx.gridSizeY);
+                    uint32_t dst = LinearIndex3D(x, y - 1, z, ctx.gridSizeX, ctx.gridSizeY);
+                    if (ctx.voxelsOut[dst] != ctx.voxelsIn[dst]) {
+                        continue;
+                    }
+                    ctx.voxelsOut[dst] = PackVoxel(Material::Sand, UnpackVariant(ctx.voxelsIn[src]), 0, 0);
+                    ctx.voxelsOut[src] = ctx.voxelsIn[dst];
+                    MarkLiquidColumnDirty(ctx, x, z);
+                    MarkVoxelChanged(ctx, x, y, z);
+                    MarkVoxelChanged(ctx, x, y - 1, z);
+                    moved[w] |= 1ull << b;
+                    sand[w] &= ~(1ull << b);
+                    ++stats.voxelsMoved;
+                }
+            }
+
+            // ===== STEP 3: Sand slides diagonally along X, random preferred side per voxel =====
+            bool anySand = false;
+            for (uint32_t w = 0; w < words; ++w) {
+                uint64_t random = PCGHash64(w * 64u + y * 1000u + z * 1000000u + ctx.frameIndex);
+                preferPlus[w] = sand[w] & random;
+                preferMinus[w] = sand[w] & ~random;
+                anySand |= sand[w] != 0;
+            }
+            if (anySand) {
+                tryMove(preferPlus, y, z, MoveDir{1, -1, 0}, Material::Sand);
+                tryMove(preferMinus, y, z, MoveDir{-1, -1, 0}, Material::Sand);
+                tryMove(preferPlus, y, z, MoveDir{-1, -1, 0}, Material::Sand);
+                tryMove(preferMinus, y, z, MoveDir{1, -1, 0}, Material::Sand);
+            }
+
+            // ===== STEP 4: Water flows down diagonals, random start direction per voxel =====
+            bool anyWater = std::any_of(water.begin(), water.end(), [](uint64_t w) { return w != 0; });
+            if (!anyWater) {
+                continue;
+            }
+
+            // Round i tries each voxel's (start + i)-th direction, so every
+            // voxel walks the directions in the scalar rule's order
+            buildStartMasks(y, z, 0x9E3779B9u);
+            for (uint32_t i = 0; i < 4; ++i) {
+                for (uint32_t d = 0; d < 4; ++d) {
+                    const std::vector<uint64_t>& group = startMask[(d + 4 - i) % 4];
+                    if (std::any_of(group.begin(), group.end(), [](uint64_t w) { return w != 0; })) {
+                        tryMove(group, y, z, kWaterDiagonals[d], Material::Water);
+                    }
+                }
+            }
+
+            // ===== STEP 5: Pressure-based horizontal spread, random start direction per voxel =====
+            // Only surface voxels with a free side cell get here, so the column
+            // height scan runs per candidate instead of per voxel
+            buildStartMasks(y, z, 0x85EBCA6Bu);
+            for (uint32_t i = 0; i < 4; ++i) {
+                for (uint32_t d = 0; d < 4; ++d) {
+                    bool anyGroup = false;
+                    for (uint32_t w = 0; w < words; ++w) {
+                        sources[w] = startMask[(d + 4 - i) % 4][w] & ~moved[w];
+                        anyGroup |= sources[w] != 0;
+                    }
+                    if (!anyGroup) {
+                        continue;
+                    }
+
+                    const MoveDir& dir = kWaterHorizontals[d];
+                    buildAvailable(static_cast<int32_t>(y), static_cast<int32_t>(z) + dir.dz, dir.dx);
+
+                    bool any = false;
+                    for (uint32_t w = 0; w < words; ++w) {
+                        uint64_t bits = sources[w] & available[w];
+                        candidates[w] = 0;
+                        while (bits) {
+                            uint32_t b = static_cast<uint32_t>(std::countr_zero(bits));
+                            bits &= bits - 1;
+                            int32_t x = static_cast<int32_t>(w * 64 + b);
+
+                            int32_t myHeight = GetLiquidColumnHeight(ctx, x, static_cast<int32_t>(y), static_cast<int32_t>(z));
+                            int32_t neighborHeight = GetLiquidColumnHeight(ctx, x + dir.dx, static_cast<int32_t>(y),
+                                                                           static_cast<int32_t>(z) + dir.dz);
+                            if (neighborHeight < myHeight - 1) {
+                                candidates[w] |= 1ull << b;
+                                any = true;
+                            }
+                        }
+                    }
+                    if (any) {
+                        applyMoves(candidates, y, z, dir, Material::Water);
+                    }
+                }
+            }
+        }
+    }
+}
+
+} // namespace VENPOD::Simulation
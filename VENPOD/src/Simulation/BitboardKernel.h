@@ -0,0 +1,85 @@
+#pragma once
+
+// =============================================================================
+// VENPOD Bitboard Kernel - Word-parallel sand/water step for the CPU simulation
+// Keeps per-row occupancy bitplanes (one bit per voxel, 64 voxels per word
+// along X) and computes "can fall", "can slide +/-X" and "can flow +/-Z" for
+// a whole word with shifts and masks. Per-voxel work is only done for voxels
+// that actually move, so settled terrain and resting piles cost a few bit
+// operations per 64 voxels instead of a full neighbourhood lookup each.
+//
+// Only chunks made entirely of "bitboard materials" (see IsBitboardMaterial)
+// whose face neighbours are too are handled here; everything else still runs
+// through CPUPhysicsKernel. Requires the checkerboard scheduler's claim rules
+// (moves target cells empty in READ and unclaimed this tick).
+// =============================================================================
+
+#include <cstdint>
+#include <vector>
+#include "CPUPhysicsKernel.h"
+#include "MaterialTraits.h"
+#include "../Utils/BitPacking.h"
+
+namespace VENPOD::Simulation {
+
+// 64-bit words must cover whole chunks so chunk masks stay word-aligned
+static_assert(64 % CHUNK_SIZE == 0, "Bitboard rows assume CHUNK_SIZE divides 64");
+
+// Materials whose complete rule set the bitboard step reproduces: sand and
+// water movement (including sand sinking through water), plus anything that
+// never moves and never reacts with either of them
+inline bool IsBitboardMaterial(uint8_t mat) {
+    return mat == Utils::Material::Air || mat == Utils::Material::Sand || mat == Utils::Material::Water ||
+           (!HasMaterialFlag(mat, MaterialFlag::Movable) &&
+            !MaterialsReact(mat, Utils::Material::Sand) && !MaterialsReact(mat, Utils::Material::Water));
+}
+
+class BitboardKernel {
+public:
+    BitboardKernel() = default;
+    ~BitboardKernel() = default;
+
+    // Non-copyable
+    BitboardKernel(const BitboardKernel&) = delete;
+    BitboardKernel& operator=(const BitboardKernel&) = delete;
+
+    void Initialize(uint32_t gridSizeX, uint32_t gridSizeY, uint32_t gridSizeZ);
+    void Shutdown();
+
+    // Rebuild the planes of every row in slice z from READ. Rows of empty chunk
+    // rows are just cleared. Safe to call for different z concurrently.
+    void BuildSlice(const uint32_t* voxels, uint32_t z, const uint32_t* chunkVoxelCounts,
+                    uint32_t chunkCountX, uint32_t chunkCountY);
+
+    // Decode again only the bricks of slice z set in staleBricks (one 4³ brick
+    // mask per chunk) and clear their claims. Every other brick must still
+    // match READ. Safe to call for different z concurrently.
+    void UpdateSlice(const uint32_t* voxels, uint32_t z, const uint64_t* staleBricks,
+                     uint32_t chunkCountX, uint32_t chunkCountY);
+
+    // Simulate sand/water in eligible chunks of slices [zBegin, zEnd). Moves reach
+    // at most one slice beyond the range, so ranges two chunk layers apart may run
+    // concurrently. chunkEligible holds one flag per chunk; with ctx.simulateBricks
+    // only voxels in those bricks move.
+    void SimulateSlices(const CPUPhysicsContext& ctx, const uint8_t* chunkEligible,
+                        uint32_t zBegin, uint32_t zEnd, CPUPhysicsStats& stats);
+
+    uint32_t GetWordsPerRow() const { return m_wordsPerRow; }
+
+private:
+    uint32_t RowOffset(uint32_t y, uint32_t z) const { return (z * m_gridSizeY + y) * m_wordsPerRow; }
+
+    uint32_t m_gridSizeX = 0;
+    uint32_t m_gridSizeY = 0;
+    uint32_t m_gridSizeZ = 0;
+    uint32_t m_wordsPerRow = 0;
+    uint64_t m_lastWordMask = 0;   // Valid bits of the last word in each row
+
+    // Bitplanes, m_wordsPerRow words per (y, z) row, kept between ticks
+    std::vector<uint64_t> m_occupied;   // Non-air in READ
+    std::vector<uint64_t> m_sand;
+    std::vector<uint64_t> m_water;
+    std::vector<uint64_t> m_claimed;    // Cells moved into this tick
+};
+
+} // namespace VENPOD::Simulation
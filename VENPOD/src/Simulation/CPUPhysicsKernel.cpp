@@ -0,0 +1,695 @@
+#include "CPUPhysicsKernel.h"
+#include "MaterialTraits.h"
+#include "../Utils/BitPacking.h"
+#include "../Utils/MortonCode.h"
+#include "../Utils/PCGRandom.h"
+#include <algorithm>
+#include <atomic>
+
+namespace VENPOD::Simulation {
+
+using namespace Utils;
+
+namespace {
+
+struct Int3 {
+    int32_t x, y, z;
+
+    Int3 operator+(const Int3& other) const {
+        return Int3{x + other.x, y + other.y, z + other.z};
+    }
+};
+
+// Neighbour offsets, same order as the arrays in CS_GravityChunk.hlsl
+constexpr Int3 kFaceNeighbors[6] = {
+    { 1, 0, 0}, {-1, 0, 0}, {0, 1, 0}, {0, -1, 0}, {0, 0, 1}, {0, 0, -1}
+};
+
+constexpr Int3 kDiagonalsDown[4] = {
+    { 1, -1, 0}, {-1, -1, 0}, {0, -1, 1}, {0, -1, -1}
+};
+
+constexpr Int3 kHorizontals[4] = {
+    { 1, 0, 0}, {-1, 0, 0}, {0, 0, 1}, {0, 0, -1}
+};
+
+constexpr Int3 kSmokeExpansions[8] = {
+    { 1, 0, 0}, {-1, 0, 0}, {0, 0, 1}, {0, 0, -1},
+    { 0, 1, 0}, { 1, 1, 0}, {-1, 1, 0}, {0, 1, 1}
+};
+
+// Furthest any voxel writes outside its own chunk (moves, spawned smoke and
+// steam, sparks). Explosions are deferred to ExplosionQueue and don't count.
+// Conflict-free passes rely on same-colour chunks being a full chunk apart,
+// so halos must not overlap.
+constexpr int32_t kMaxWriteReach = 1;
+static_assert(2 * kMaxWriteReach <= static_cast<int32_t>(CHUNK_SIZE),
+    "Chunk colouring requires write halos of same-colour chunks to be disjoint");
+
+// Material classification - single lookups into MATERIAL_TRAITS
+inline bool IsMovable(uint8_t mat) {
+    return HasMaterialFlag(mat, MaterialFlag::Movable);
+}
+
+inline bool IsEmpty(uint8_t mat) {
+    return mat == Material::Air;
+}
+
+inline bool IsFlammable(uint8_t mat) {
+    return HasMaterialFlag(mat, MaterialFlag::Flammable);
+}
+
+inline bool IsDissolvable(uint8_t mat) {
+    return HasMaterialFlag(mat, MaterialFlag::Dissolvable);
+}
+
+inline bool IsLiquid(uint8_t mat) {
+    return HasMaterialFlag(mat, MaterialFlag::Liquid);
+}
+
+inline bool IsHeatSource(uint8_t mat) {
+    return HasMaterialFlag(mat, MaterialFlag::HeatSource);
+}
+
+inline uint8_t WithLife(uint8_t state, uint32_t life) {
+    return static_cast<uint8_t>((state & ~StateFlags::LifeMask) | (life & StateFlags::LifeMask));
+}
+
+// Simulates the voxels of one chunk. One instance per SimulateChunk call.
+class ChunkSimulator {
+public:
+    ChunkSimulator(const CPUPhysicsContext& ctx, CPUPhysicsStats& stats, std::vector<ExplosionEvent>& explosions)
+        : m_ctx(ctx), m_stats(stats), m_explosions(explosions) {}
+
+    void Run(uint32_t chunkIndex) {
+        // Decompose chunk index to 3D position (X fastest, like ChunkIndexToPos)
+        uint32_t cx = chunkIndex % m_ctx.chunkCountX;
+        uint32_t cy = (chunkIndex / m_ctx.chunkCountX) % m_ctx.chunkCountY;
+        uint32_t cz = chunkIndex / (m_ctx.chunkCountX * m_ctx.chunkCountY);
+
+        int32_t baseX = static_cast<int32_t>(cx * CHUNK_SIZE);
+        int32_t baseY = static_cast<int32_t>(cy * CHUNK_SIZE);
+        int32_t baseZ = static_cast<int32_t>(cz * CHUNK_SIZE);
+
+        int32_t endX = std::min(baseX + static_cast<int32_t>(CHUNK_SIZE), static_cast<int32_t>(m_ctx.gridSizeX));
+        int32_t endY = std::min(baseY + static_cast<int32_t>(CHUNK_SIZE), static_cast<int32_t>(m_ctx.gridSizeY));
+        int32_t endZ = std::min(baseZ + static_cast<int32_t>(CHUNK_SIZE), static_cast<int32_t>(m_ctx.gridSizeZ));
+
+        // Same z, y, x order as the shader, skipping bricks nothing can have woken
+        uint64_t bricks = m_ctx.simulateBricks ? m_ctx.simulateBricks[chunkIndex] : ~0ull;
+        for (int32_t z = baseZ; z < endZ; ++z) {
+            for (int32_t y = baseY; y < endY; ++y) {
+                uint32_t rowBricks = static_cast<uint32_t>(
+                    bricks >> LocalBrickIndex(0, static_cast<uint32_t>(y - baseY), static_cast<uint32_t>(z - baseZ))) &
+                    ((1u << CHUNK_BRICKS_PER_AXIS) - 1);
+                if (rowBricks == 0) {
+                    continue;
+                }
+                for (int32_t x = baseX; x < endX; ++x) {
+                    if (rowBricks & (1u << ((x - baseX) / static_cast<int32_t>(BRICK_SIZE)))) {
+                        SimulateVoxel(Int3{x, y, z});
+                    }
+                }
+            }
+        }
+    }
+
+private:
+    // ===== Voxel access =====
+
+    bool InBounds(const Int3& pos) const {
+        return pos.x >= 0 && pos.x < static_cast<int32_t>(m_ctx.gridSizeX) &&
+               pos.y >= 0 && pos.y < static_cast<int32_t>(m_ctx.gridSizeY) &&
+               pos.z >= 0 && pos.z < static_cast<int32_t>(m_ctx.gridSizeZ);
+    }
+
+    uint32_t Index(const Int3& pos) const {
+        return LinearIndex3D(static_cast<uint32_t>(pos.x), static_cast<uint32_t>(pos.y),
+                             static_cast<uint32_t>(pos.z), m_ctx.gridSizeX, m_ctx.gridSizeY);
+    }
+
+    // Out of bounds reads as bedrock (same as GetVoxelSafe)
+    uint32_t GetVoxelSafe(const Int3& pos) const {
+        if (!InBounds(pos)) {
+            return PackVoxel(Material::Bedrock, 0, 0, 0);
+        }
+        return m_ctx.voxelsIn[Index(pos)];
+    }
+
+    uint8_t GetMaterialSafe(const Int3& pos) const {
+        return UnpackMaterial(GetVoxelSafe(pos));
+    }
+
+    // In unordered mode neighbouring chunks run concurrently and may write the
+    // same voxel (the shader has the same race). Relaxed atomics keep that
+    // well-defined in C++ without adding any ordering cost. In conflict-free
+    // mode the pass scheduler guarantees exclusive access, so plain accesses.
+    uint32_t LoadOutput(uint32_t index) const {
+        if (m_ctx.conflictFree) {
+            return m_ctx.voxelsOut[index];
+        }
+        return std::atomic_ref<uint32_t>(m_ctx.voxelsOut[index]).load(std::memory_order_relaxed);
+    }
+
+    void StoreOutput(const Int3& pos, uint32_t voxel) {
+        uint32_t index = Index(pos);
+        uint32_t readVoxel = m_ctx.voxelsIn[index];
+        if (voxel != readVoxel) {
+            TrackChange(pos, readVoxel, voxel);
+        }
+        if (m_ctx.conflictFree) {
+            m_ctx.voxelsOut[index] = voxel;
+        } else {
+            std::atomic_ref<uint32_t>(m_ctx.voxelsOut[index]).store(voxel, std::memory_order_relaxed);
+        }
+    }
+
+    // Target is empty and (conflict-free mode) nobody has written it this tick
+    bool CanClaim(const Int3& pos) const {
+        if (!InBounds(pos)) {
+            return false;
+        }
+        uint32_t index = Index(pos);
+        if (!IsEmpty(UnpackMaterial(m_ctx.voxelsIn[index]))) {
+            return false;
+        }
+        return !m_ctx.conflictFree || IsEmpty(UnpackMaterial(m_ctx.voxelsOut[index]));
+    }
+
+    // Target still holds its READ value (first writer wins in conflict-free mode)
+    bool CanModify(const Int3& pos) const {
+        if (!m_ctx.conflictFree) {
+            return true;
+        }
+        if (!InBounds(pos)) {
+            return false;
+        }
+        uint32_t index = Index(pos);
+        return m_ctx.voxelsOut[index] == m_ctx.voxelsIn[index];
+    }
+
+    // Reaction write: may create or destroy matter, tracked for the mass check
+    void SetVoxel(const Int3& pos, uint32_t voxel) {
+        if (!InBounds(pos)) {
+            return;
+        }
+        uint32_t previous = LoadOutput(Index(pos));
+        m_stats.reactionMassDelta += static_cast<int64_t>(!IsEmpty(UnpackMaterial(voxel))) -
+                                     static_cast<int64_t>(!IsEmpty(UnpackMaterial(previous)));
+        StoreOutput(pos, voxel);
+    }
+
+    // Mass-preserving move into a claimed (empty) cell
+    void MoveVoxel(const Int3& from, const Int3& to, uint32_t voxel) {
+        StoreOutput(from, PackVoxel(Material::Air, 0, 0, 0));
+        StoreOutput(to, voxel);
+        ++m_stats.voxelsMoved;
+    }
+
+    // Mass-preserving exchange of two voxels
+    void SwapVoxels(const Int3& a, uint32_t voxelForA, const Int3& b, uint32_t voxelForB) {
+        StoreOutput(a, voxelForA);
+        StoreOutput(b, voxelForB);
+        ++m_stats.voxelsMoved;
+    }
+
+    // A voxel now differs from READ: feed the wake-up chain, and the liquid
+    // surface cache if the column's air/liquid/solid layout changed
+    void TrackChange(const Int3& pos, uint32_t readVoxel, uint32_t voxel) const {
+        uint32_t x = static_cast<uint32_t>(pos.x);
+        uint32_t y = static_cast<uint32_t>(pos.y);
+        uint32_t z = static_cast<uint32_t>(pos.z);
+        MarkVoxelChanged(m_ctx, x, y, z);
+
+        if (m_ctx.liquidColumnDirty) {
+            uint8_t before = UnpackMaterial(readVoxel);
+            uint8_t after = UnpackMaterial(voxel);
+            if (IsEmpty(before) != IsEmpty(after) || IsLiquid(before) != IsLiquid(after)) {
+                MarkLiquidColumnDirty(m_ctx, x, z);
+            }
+        }
+    }
+
+    uint32_t Random(const Int3& pos) const {
+        return PCGHash(static_cast<uint32_t>(pos.x) + static_cast<uint32_t>(pos.y) * 1000u +
+                       static_cast<uint32_t>(pos.z) * 1000000u + m_ctx.frameIndex);
+    }
+
+    int32_t GetLiquidColumnHeight(const Int3& pos) const {
+        return Simulation::GetLiquidColumnHeight(m_ctx, pos.x, pos.y, pos.z);
+    }
+
+    // ===== Shared flow helpers =====
+
+    // Try `tries` of the 4 down-diagonals starting at startIdx; move into the first empty one
+    bool TryDiagonalFlow(const Int3& pos, uint32_t voxel, uint32_t startIdx, uint32_t tries) {
+        for (uint32_t i = 0; i < tries; ++i) {
+            Int3 diagPos = pos + kDiagonalsDown[(startIdx + i) % 4];
+            if (CanClaim(diagPos)) {
+                MoveVoxel(pos, diagPos, voxel);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Pressure-based horizontal spread: only move into an empty side cell whose
+    // liquid column is more than `threshold` voxels lower than ours
+    bool TryHorizontalSpread(const Int3& pos, uint32_t voxel, uint32_t startIdx, uint32_t tries, int32_t threshold) {
+        int32_t myHeight = GetLiquidColumnHeight(pos);
+        for (uint32_t i = 0; i < tries; ++i) {
+            Int3 sidePos = pos + kHorizontals[(startIdx + i) % 4];
+            if (CanClaim(sidePos)) {
+                int32_t neighborHeight = GetLiquidColumnHeight(sidePos);
+                if (neighborHeight < myHeight - threshold) {
+                    MoveVoxel(pos, sidePos, voxel);
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    // ===== Per-voxel rules (same order as CS_GravityChunk main) =====
+
+    void SimulateVoxel(const Int3& pos) {
+        uint32_t currentVoxel = m_ctx.voxelsIn[Index(pos)];
+        uint8_t material = UnpackMaterial(currentVoxel);
+
+        // Skip air (don't write - prevents overwriting voxels moved in by neighbours)
+        if (material == Material::Air) {
+            return;
+        }
+
+        ++m_stats.voxelsProcessed;
+
+        // Conflict-free mode: a voxel already overwritten this tick (ignited,
+        // dissolved, swapped...) has been handled by whoever wrote it
+        if (!CanModify(pos)) {
+            return;
+        }
+
+        if (material == Material::Bedrock) {
+            SetVoxel(pos, currentVoxel);
+            return;
+        }
+
+        if (!IsMovable(material)) {
+            SimulateStatic(pos, currentVoxel, material);
+            return;
+        }
+
+        switch (material) {
+            case Material::Smoke:     SimulateSmoke(pos, currentVoxel); return;
+            case Material::Steam:     SimulateSteam(pos, currentVoxel); return;
+            case Material::Fire:      SimulateFire(pos, currentVoxel); return;
+            case Material::Gunpowder:
+                if (TryDetonate(pos)) {
+                    return;
+                }
+                break;  // Gunpowder falls like sand below
+            default:
+                break;
+        }
+
+        SimulateFalling(pos, currentVoxel, material);
+    }
+
+    // Static / non-movable materials. Ice melts next to fire or lava.
+    void SimulateStatic(const Int3& pos, uint32_t currentVoxel, uint8_t material) {
+        if (material == Material::Ice) {
+            for (const Int3& offset : kFaceNeighbors) {
+                if (IsHeatSource(GetMaterialSafe(pos + offset))) {
+                    SetVoxel(pos, PackVoxel(Material::Water, UnpackVariant(currentVoxel), 0, 0));
+                    return;
+                }
+            }
+        }
+        SetVoxel(pos, currentVoxel);
+    }
+
+    // Smoke billows upward and dissipates gradually
+    void SimulateSmoke(const Int3& pos, uint32_t currentVoxel) {
+        uint32_t currentLife = UnpackLife(currentVoxel);
+        uint32_t rng = Random(pos);
+
+        if (currentLife == 0) {
+            SetVoxel(pos, PackVoxel(Material::Air, 0, 0, 0));
+            return;
+        }
+
+        // Slow dissipation - only decrement every ~4 frames for billowing effect
+        uint32_t newLife = ((rng & 0x3) == 0) ? currentLife - 1 : currentLife;
+        uint8_t newState = WithLife(UnpackState(currentVoxel), newLife);
+
+        if (currentLife > 8) {
+            // Young smoke rises vigorously
+            Int3 abovePos = pos + Int3{0, 1, 0};
+            if (abovePos.y < static_cast<int32_t>(m_ctx.gridSizeY) && CanClaim(abovePos)) {
+                MoveVoxel(pos, abovePos, PackVoxel(Material::Smoke, UnpackVariant(currentVoxel), 0, newState));
+                return;
+            }
+        } else {
+            // Old smoke spreads in all directions
+            uint32_t startIdx = (rng >> 4) & 0x7;
+            for (uint32_t i = 0; i < 4; ++i) {
+                Int3 expandPos = pos + kSmokeExpansions[(startIdx + i) % 8];
+                if (CanClaim(expandPos)) {
+                    uint32_t cloneLife = newLife > 0 ? newLife - 1 : 0;
+                    uint8_t cloneState = WithLife(newState, cloneLife);
+                    SetVoxel(expandPos, PackVoxel(Material::Smoke, static_cast<uint8_t>((rng >> 8) & 0xFF), 0, cloneState));
+                    break;
+                }
+            }
+        }
+
+        SetVoxel(pos, PackVoxel(Material::Smoke, UnpackVariant(currentVoxel), 0, newState));
+    }
+
+    // Steam rises like smoke but loses a life point every frame
+    void SimulateSteam(const Int3& pos, uint32_t currentVoxel) {
+        uint32_t currentLife = UnpackLife(currentVoxel);
+        if (currentLife == 0) {
+            SetVoxel(pos, PackVoxel(Material::Air, 0, 0, 0));
+            return;
+        }
+
+        uint8_t newState = WithLife(UnpackState(currentVoxel), currentLife - 1);
+
+        Int3 abovePos = pos + Int3{0, 1, 0};
+        if (abovePos.y < static_cast<int32_t>(m_ctx.gridSizeY) && CanClaim(abovePos)) {
+            MoveVoxel(pos, abovePos, PackVoxel(Material::Steam, UnpackVariant(currentVoxel), 0, newState));
+            return;
+        }
+
+        SetVoxel(pos, PackVoxel(Material::Steam, UnpackVariant(currentVoxel), 0, newState));
+    }
+
+    // Gunpowder next to fire/lava explodes. The blast itself (fire core,
+    // cleared shell) is queued and applied once per voxel after the passes.
+    bool TryDetonate(const Int3& pos) {
+        for (const Int3& offset : kFaceNeighbors) {
+            if (IsHeatSource(GetMaterialSafe(pos + offset))) {
+                m_explosions.push_back({ pos.x, pos.y, pos.z, EXPLOSION_RADIUS, EXPLOSION_ENERGY });
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Fire burns down, spreads to flammables, emits smoke and drops sparks
+    void SimulateFire(const Int3& pos, uint32_t currentVoxel) {
+        uint32_t rng = Random(pos);
+
+        uint32_t currentLife = UnpackLife(currentVoxel);
+        if (currentLife == 0) {
+            // Fire burns out → becomes smoke
+            SetVoxel(pos, PackVoxel(Material::Smoke, UnpackVariant(currentVoxel), 0, 15));
+            return;
+        }
+
+        uint8_t newState = static_cast<uint8_t>((UnpackState(currentVoxel) & 0xF0) | ((currentLife - 1) & 0x0F));
+
+        // Spread to adjacent flammable voxels (1 in 4 chance each)
+        for (uint32_t i = 0; i < 6; ++i) {
+            Int3 neighborPos = pos + kFaceNeighbors[i];
+            uint32_t neighborVoxel = GetVoxelSafe(neighborPos);
+            if (IsFlammable(UnpackMaterial(neighborVoxel)) && ((rng >> (i * 2)) & 0x3) == 0 && CanModify(neighborPos)) {
+                SetVoxel(neighborPos, PackVoxel(Material::Fire, UnpackVariant(neighborVoxel), 0, 60));
+            }
+        }
+
+        // Randomly spawn smoke above fire (1 in 8)
+        Int3 abovePos = pos + Int3{0, 1, 0};
+        if ((rng & 0x7) == 0 && CanClaim(abovePos)) {
+            SetVoxel(abovePos, PackVoxel(Material::Smoke, static_cast<uint8_t>((rng >> 8) & 0xFF), 0, 15));
+        }
+
+        // Sparks (1 in 16): fall into empty space below or ignite flammables
+        if (((rng >> 10) & 0xF) == 0) {
+            Int3 belowPos = pos + Int3{0, -1, 0};
+            if (belowPos.y >= 0) {
+                uint32_t belowVoxel = GetVoxelSafe(belowPos);
+                uint8_t belowMat = UnpackMaterial(belowVoxel);
+                if (IsEmpty(belowMat)) {
+                    if (CanClaim(belowPos)) {
+                        SetVoxel(belowPos, PackVoxel(Material::Fire, static_cast<uint8_t>((rng >> 16) & 0xFF), 0, 8));
+                    }
+                } else if (IsFlammable(belowMat) && CanModify(belowPos)) {
+                    SetVoxel(belowPos, PackVoxel(Material::Fire, UnpackVariant(belowVoxel), 0, 60));
+                }
+            }
+        }
+
+        SetVoxel(pos, PackVoxel(Material::Fire, UnpackVariant(currentVoxel), 0, newState));
+    }
+
+    // Falling sand / liquid physics
+    void SimulateFalling(const Int3& pos, uint32_t currentVoxel, uint8_t material) {
+        Int3 belowPos = pos + Int3{0, -1, 0};
+        if (belowPos.y < 0) {
+            SetVoxel(pos, currentVoxel);  // Resting on the grid floor
+            return;
+        }
+
+        uint8_t variant = UnpackVariant(currentVoxel);
+        uint32_t movedVoxel = PackVoxel(material, variant, 0, 0);
+
+        // Can fall straight down?
+        uint32_t belowVoxel = GetVoxelSafe(belowPos);
+        uint8_t belowMaterial = UnpackMaterial(belowVoxel);
+        if (IsEmpty(belowMaterial)) {
+            if (CanClaim(belowPos)) {
+                MoveVoxel(pos, belowPos, movedVoxel);
+            } else {
+                SetVoxel(pos, currentVoxel);  // Another voxel got there first this tick
+            }
+            return;
+        }
+
+        // Below is occupied from here on
+
+        // Density displacement: sink through a lighter liquid or gas
+        if (CanDisplace(material, belowMaterial) && CanModify(belowPos)) {
+            SwapVoxels(pos, belowVoxel, belowPos, movedVoxel);
+            return;
+        }
+
+        // Sand slides diagonally along X in a random direction
+        if (material == Material::Sand) {
+            uint32_t rng = Random(pos);
+            int32_t dir = (rng & 1) ? 1 : -1;
+            for (int32_t side : {dir, -dir}) {
+                Int3 diagPos = pos + Int3{side, -1, 0};
+                if (diagPos.x >= 0 && diagPos.x < static_cast<int32_t>(m_ctx.gridSizeX) &&
+                    CanClaim(diagPos)) {
+                    MoveVoxel(pos, diagPos, movedVoxel);
+                    return;
+                }
+            }
+        }
+
+        if (IsLiquid(material)) {
+            if (SimulateLiquid(pos, currentVoxel, material)) {
+                return;
+            }
+        }
+
+        // No movement possible - stay put
+        SetVoxel(pos, currentVoxel);
+    }
+
+    // Liquids. Every liquid first runs the generic water flow, then its
+    // material-specific block - the same fall-through order as the shader.
+    // Returns true if the voxel has been fully handled.
+    bool SimulateLiquid(const Int3& pos, uint32_t currentVoxel, uint8_t material) {
+        uint32_t rng = Random(pos);
+        uint8_t variant = UnpackVariant(currentVoxel);
+        uint32_t movedVoxel = PackVoxel(material, variant, 0, 0);
+
+        // ===== WATER INTERACTIONS =====
+        if (material == Material::Water) {
+            uint32_t iceNeighborCount = 0;
+            for (const Int3& offset : kFaceNeighbors) {
+                Int3 neighborPos = pos + offset;
+                uint32_t neighborVoxel = GetVoxelSafe(neighborPos);
+                uint8_t neighborMat = UnpackMaterial(neighborVoxel);
+
+                if (neighborMat == Material::Lava) {
+                    // Water touching lava turns to stone and releases steam above
+                    SetVoxel(pos, PackVoxel(Material::Stone, variant, 0, StateFlags::IsStatic));
+                    Int3 abovePos = pos + Int3{0, 1, 0};
+                    if (CanClaim(abovePos)) {
+                        SetVoxel(abovePos, PackVoxel(Material::Steam, variant, 0, 10));
+                    }
+                    return true;
+                }
+                if (neighborMat == Material::Fire && CanModify(neighborPos)) {
+                    // Water evaporates, fire becomes steam
+                    SetVoxel(pos, PackVoxel(Material::Air, 0, 0, 0));
+                    SetVoxel(neighborPos, PackVoxel(Material::Steam, UnpackVariant(neighborVoxel), 0, 10));
+                    return true;
+                }
+                if (neighborMat == Material::Ice) {
+                    ++iceNeighborCount;
+                }
+            }
+
+            // Water freezes if surrounded by ice (3+ ice neighbours)
+            if (iceNeighborCount >= 3) {
+                SetVoxel(pos, PackVoxel(Material::Ice, variant, 0, StateFlags::IsStatic));
+                return true;
+            }
+        }
+
+        // ===== GENERIC LIQUID FLOW =====
+        if (TryDiagonalFlow(pos, movedVoxel, (rng >> 2) & 0x3, 4)) {
+            return true;
+        }
+        if (TryHorizontalSpread(pos, movedVoxel, (rng >> 4) & 0x3, 4, 1)) {
+            return true;
+        }
+
+        switch (material) {
+            case Material::Lava:     return SimulateLava(pos, movedVoxel, rng);
+            case Material::Oil:      return SimulateOil(pos, currentVoxel, movedVoxel, rng);
+            case Material::Acid:     return SimulateAcid(pos, currentVoxel, movedVoxel, rng);
+            case Material::Honey:    return SimulateHoney(pos, movedVoxel, rng);
+            case Material::Concrete: return SimulateConcrete(pos, currentVoxel, rng);
+            default:                 return false;
+        }
+    }
+
+    // Lava: solidifies water, ignites flammables, spreads slower than water
+    bool SimulateLava(const Int3& pos, uint32_t movedVoxel, uint32_t rng) {
+        for (uint32_t i = 0; i < 6; ++i) {
+            Int3 neighborPos = pos + kFaceNeighbors[i];
+            uint32_t neighborVoxel = GetVoxelSafe(neighborPos);
+            uint8_t neighborMat = UnpackMaterial(neighborVoxel);
+
+            if (!CanModify(neighborPos)) {
+                continue;
+            }
+            if (neighborMat == Material::Water) {
+                SetVoxel(neighborPos, PackVoxel(Material::Stone, UnpackVariant(neighborVoxel), 0, StateFlags::IsStatic));
+            } else if (IsFlammable(neighborMat) && ((rng >> (i * 2)) & 0x1) == 0) {
+                SetVoxel(neighborPos, PackVoxel(Material::Fire, UnpackVariant(neighborVoxel), 0, 60));
+            }
+        }
+
+        if (TryDiagonalFlow(pos, movedVoxel, (rng >> 2) & 0x3, 4)) {
+            return true;
+        }
+        // Only 2 directions and a 2-voxel pressure threshold (slower pooling)
+        return TryHorizontalSpread(pos, movedVoxel, (rng >> 4) & 0x3, 2, 2);
+    }
+
+    // Oil: ignites near heat (floats on water via density displacement)
+    bool SimulateOil(const Int3& pos, uint32_t currentVoxel, uint32_t movedVoxel, uint32_t rng) {
+        for (const Int3& offset : kFaceNeighbors) {
+            if (IsHeatSource(GetMaterialSafe(pos + offset))) {
+                SetVoxel(pos, PackVoxel(Material::Fire, UnpackVariant(currentVoxel), 0, 60));
+                return true;
+            }
+        }
+
+        if (TryDiagonalFlow(pos, movedVoxel, (rng >> 2) & 0x3, 4)) {
+            return true;
+        }
+        return TryHorizontalSpread(pos, movedVoxel, (rng >> 4) & 0x3, 4, 1);
+    }
+
+    // Acid: neutralised by water, dissolves soft materials
+    bool SimulateAcid(const Int3& pos, uint32_t currentVoxel, uint32_t movedVoxel, uint32_t rng) {
+        for (uint32_t i = 0; i < 6; ++i) {
+            Int3 neighborPos = pos + kFaceNeighbors[i];
+            uint32_t neighborVoxel = GetVoxelSafe(neighborPos);
+            uint8_t neighborMat = UnpackMaterial(neighborVoxel);
+
+            if (!CanModify(neighborPos)) {
+                continue;
+            }
+            if (neighborMat == Material::Water) {
+                // Neutralisation - both become dirt
+                SetVoxel(pos, PackVoxel(Material::Dirt, UnpackVariant(currentVoxel), 0, StateFlags::IsStatic));
+                SetVoxel(neighborPos, PackVoxel(Material::Dirt, UnpackVariant(neighborVoxel), 0, StateFlags::IsStatic));
+                return true;
+            }
+            if (IsDissolvable(neighborMat) && ((rng >> (i * 2)) & 0xF) == 0) {
+                SetVoxel(neighborPos, PackVoxel(Material::Air, 0, 0, 0));
+            }
+        }
+
+        if (TryDiagonalFlow(pos, movedVoxel, (rng >> 2) & 0x3, 4)) {
+            return true;
+        }
+        return TryHorizontalSpread(pos, movedVoxel, (rng >> 4) & 0x3, 4, 1);
+    }
+
+    // Honey: very viscous, single random direction, only 1 in 4 frames
+    bool SimulateHoney(const Int3& pos, uint32_t movedVoxel, uint32_t rng) {
+        if ((rng & 0x3) != 0) {
+            return true;  // Skipped this frame (no write, WRITE already holds the copy)
+        }
+        if (TryDiagonalFlow(pos, movedVoxel, (rng >> 4) & 0x3, 1)) {
+            return true;
+        }
+        return TryHorizontalSpread(pos, movedVoxel, (rng >> 6) & 0x3, 1, 3);
+    }
+
+    // Concrete: flows while its life counter rises, hardens into stone at 15
+    bool SimulateConcrete(const Int3& pos, uint32_t currentVoxel, uint32_t rng) {
+        uint32_t currentLife = UnpackLife(currentVoxel);
+        uint8_t variant = UnpackVariant(currentVoxel);
+
+        if (currentLife >= 15) {
+            SetVoxel(pos, PackVoxel(Material::Stone, variant, 0, StateFlags::IsStatic));
+            return true;
+        }
+
+        uint32_t agedVoxel = PackVoxel(Material::Concrete, variant, 0, WithLife(UnpackState(currentVoxel), currentLife + 1));
+
+        if (!TryDiagonalFlow(pos, agedVoxel, (rng >> 2) & 0x3, 4) &&
+            !TryHorizontalSpread(pos, agedVoxel, (rng >> 4) & 0x3, 4, 1)) {
+            SetVoxel(pos, agedVoxel);
+        }
+        return true;
+    }
+
+    const CPUPhysicsContext& m_ctx;
+    CPUPhysicsStats& m_stats;
+    std::vector<ExplosionEvent>& m_explosions;
+};
+
+} // namespace
+
+int32_t GetLiquidColumnHeight(const CPUPhysicsContext& ctx, int32_t x, int32_t y, int32_t z) {
+    if (x < 0 || x >= static_cast<int32_t>(ctx.gridSizeX) || z < 0 || z >= static_cast<int32_t>(ctx.gridSizeZ)) {
+        return y;  // Out-of-bounds columns read as bedrock
+    }
+    if (ctx.liquidSurface && y >= 0 && y < static_cast<int32_t>(ctx.gridSizeY)) {
+        size_t column = static_cast<size_t>(z) * ctx.gridSizeX + static_cast<size_t>(x);
+        return ctx.liquidSurface[column * ctx.gridSizeY + static_cast<size_t>(y)];
+    }
+
+    int32_t surfaceY = y;
+    for (int32_t checkY = std::max(y, 0); checkY < static_cast<int32_t>(ctx.gridSizeY); ++checkY) {
+        uint32_t index = LinearIndex3D(static_cast<uint32_t>(x), static_cast<uint32_t>(checkY),
+                                       static_cast<uint32_t>(z), ctx.gridSizeX, ctx.gridSizeY);
+        uint8_t mat = UnpackMaterial(ctx.voxelsIn[index]);
+        if (IsLiquid(mat)) {
+            surfaceY = checkY;
+        } else if (!IsEmpty(mat)) {
+            break;  // Hit solid - stop scanning
+        }
+    }
+    return surfaceY;
+}
+
+void SimulateChunk(const CPUPhysicsContext& ctx, uint32_t chunkIndex, CPUPhysicsStats& stats,
+                   std::vector<ExplosionEvent>& explosions) {
+    ChunkSimulator simulator(ctx, stats, explosions);
+    simulator.Run(chunkIndex);
+}
+
+} // namespace VENPOD::Simulation
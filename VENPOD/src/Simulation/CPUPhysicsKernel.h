@@ -0,0 +1,100 @@
+#pragma once
+
+// =============================================================================
+// VENPOD CPU Physics Kernel - C++ port of CS_GravityChunk.hlsl
+// Simulates one 16³ chunk per call, reading from the READ buffer and writing
+// to the WRITE buffer exactly like the compute shader does.
+// =============================================================================
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+#include "SimulationConstants.h"
+#include "ExplosionQueue.h"
+
+namespace VENPOD::Simulation {
+
+// Per-tick inputs (mirrors PhysicsChunkConstants + the bound voxel buffers)
+struct CPUPhysicsContext {
+    const uint32_t* voxelsIn = nullptr;   // READ buffer (previous tick)
+    uint32_t* voxelsOut = nullptr;        // WRITE buffer (pre-filled copy of READ)
+
+    uint32_t gridSizeX = 0;
+    uint32_t gridSizeY = 0;
+    uint32_t gridSizeZ = 0;
+    uint32_t frameIndex = 0;
+
+    uint32_t chunkCountX = 0;
+    uint32_t chunkCountY = 0;
+    uint32_t chunkCountZ = 0;
+
+    // Set by the pass scheduler: no other worker touches this chunk's write
+    // halo during the pass, so moves claim their target (empty in both READ
+    // and WRITE) and the first writer of a voxel wins. Without it, writes race
+    // exactly like the shader does.
+    bool conflictFree = false;
+
+    // Optional liquid surface cache (see LiquidSurfaceCache). When set,
+    // GetLiquidColumnHeight is a single load, and every write that changes a
+    // column's liquid/solid layout flags that column for the next rebuild.
+    const uint16_t* liquidSurface = nullptr;
+    uint8_t* liquidColumnDirty = nullptr;
+
+    // Optional per-chunk dirty brick masks (see SimulationConstants.h). Every
+    // voxel that ends up different from READ sets its brick's bit; CPUSimulation
+    // turns them into sleep timers, the next tick's copy set and save regions.
+    uint64_t* dirtyBricks = nullptr;
+
+    // Optional per-chunk mask of the bricks to simulate (nullptr = whole chunk).
+    // Voxels in other bricks keep the value the READ -> WRITE copy gave them.
+    const uint64_t* simulateBricks = nullptr;
+};
+
+// Per-worker counters, summed by CPUSimulation after each tick
+struct CPUPhysicsStats {
+    uint64_t voxelsProcessed = 0;   // Non-air voxels evaluated
+    uint64_t voxelsMoved = 0;       // Voxels that changed position
+    int64_t reactionMassDelta = 0;  // Non-air voxels created minus destroyed by reactions
+    uint64_t voxelsExploded = 0;    // Voxels written by the explosion pass
+
+    void Accumulate(const CPUPhysicsStats& other) {
+        voxelsProcessed += other.voxelsProcessed;
+        voxelsMoved += other.voxelsMoved;
+        reactionMassDelta += other.reactionMassDelta;
+        voxelsExploded += other.voxelsExploded;
+    }
+};
+
+// Y of the top of the liquid column starting at (x, y, z), scanning READ upward
+// until the first solid (same as GetLiquidColumnHeight in CS_GravityChunk.hlsl)
+int32_t GetLiquidColumnHeight(const CPUPhysicsContext& ctx, int32_t x, int32_t y, int32_t z);
+
+// Flag column (x, z) of the liquid surface cache for a rebuild before the next tick
+inline void MarkLiquidColumnDirty(const CPUPhysicsContext& ctx, uint32_t x, uint32_t z) {
+    if (ctx.liquidColumnDirty) {
+        // Chunks stacked in Y share columns and may run in the same pass
+        std::atomic_ref<uint8_t>(ctx.liquidColumnDirty[z * ctx.gridSizeX + x]).store(1, std::memory_order_relaxed);
+    }
+}
+
+// Record that voxel (x, y, z) now differs from READ (dirty brick tracking)
+inline void MarkVoxelChanged(const CPUPhysicsContext& ctx, uint32_t x, uint32_t y, uint32_t z) {
+    if (!ctx.dirtyBricks) {
+        return;
+    }
+    uint64_t bit = 1ull << LocalBrickIndex(x % CHUNK_SIZE, y % CHUNK_SIZE, z % CHUNK_SIZE);
+    uint32_t chunkIndex = ((z / CHUNK_SIZE) * ctx.chunkCountY + y / CHUNK_SIZE) * ctx.chunkCountX + x / CHUNK_SIZE;
+    std::atomic_ref<uint64_t> bricks(ctx.dirtyBricks[chunkIndex]);
+    // Most changes hit a brick that is already flagged; skip the locked OR then
+    if (!(bricks.load(std::memory_order_relaxed) & bit)) {
+        bricks.fetch_or(bit, std::memory_order_relaxed);
+    }
+}
+
+// Simulate the voxels of the chunk at chunkIndex (linear chunk index, X fastest)
+// that lie in its simulateBricks mask.
+// Detonations are appended to `explosions` and applied later by ExplosionQueue.
+void SimulateChunk(const CPUPhysicsContext& ctx, uint32_t chunkIndex, CPUPhysicsStats& stats,
+                   std::vector<ExplosionEvent>& explosions);
+
+} // namespace VENPOD::Simulation
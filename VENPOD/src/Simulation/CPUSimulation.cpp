@@ -0,0 +1,787 @@
+#include "CPUSimulation.h"
+#include "MaterialTraits.h"
+#include "../Utils/BitPacking.h"
+#include "../Utils/MortonCode.h"
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cstring>
+
+namespace VENPOD::Simulation {
+
+// Voxels copied per ParallelFor item in the READ -> WRITE copy
+static constexpr uint32_t COPY_BLOCK_VOXELS = 64 * 1024;
+
+Result<void> CPUSimulation::Initialize(const CPUSimulationConfig& config) {
+    if (config.gridSizeX == 0 || config.gridSizeY == 0 || config.gridSizeZ == 0) {
+        return Error("Invalid CPU simulation grid size {}x{}x{}",
+            config.gridSizeX, config.gridSizeY, config.gridSizeZ);
+    }
+    if (config.kernelMode == CPUKernelMode::Bitboard && config.scheduleMode != CPUScheduleMode::Checkerboard) {
+        return Error("Bitboard kernel requires checkerboard scheduling");
+    }
+    if (config.chunkSleepTicks > 255) {
+        return Error("chunkSleepTicks must be at most 255, got {}", config.chunkSleepTicks);
+    }
+    if (config.liquidSurfaceCache && config.gridSizeY > 65536) {
+        return Error("Liquid surface cache supports at most 65536 voxels in Y, got {}", config.gridSizeY);
+    }
+
+    m_config = config;
+    m_chunkCountX = (config.gridSizeX + CHUNK_SIZE - 1) / CHUNK_SIZE;
+    m_chunkCountY = (config.gridSizeY + CHUNK_SIZE - 1) / CHUNK_SIZE;
+    m_chunkCountZ = (config.gridSizeZ + CHUNK_SIZE - 1) / CHUNK_SIZE;
+
+    uint32_t totalVoxels = GetTotalVoxels();
+    m_voxelBuffers[0].assign(totalVoxels, 0);
+    m_voxelBuffers[1].assign(totalVoxels, 0);
+    m_readBufferIndex = 0;
+
+    m_threadPool.Initialize(config.workerCount);
+    m_workerStats.resize(m_threadPool.GetWorkerCount());
+    m_workerColumnCounts.resize(m_threadPool.GetWorkerCount());
+    m_explosionQueue.Initialize(config.gridSizeX, config.gridSizeY, config.gridSizeZ, m_threadPool.GetWorkerCount());
+
+    m_chunkVoxelCounts.assign(GetTotalChunks(), 0);
+    m_activeChunks.reserve(GetTotalChunks());
+
+    if (config.kernelMode == CPUKernelMode::Bitboard) {
+        m_bitboardKernel.Initialize(config.gridSizeX, config.gridSizeY, config.gridSizeZ);
+        m_chunkBitboardOnly.assign(GetTotalChunks(), 0);
+        m_chunkEligible.assign(GetTotalChunks(), 0);
+        if (config.chunkSleepTicks > 0) {
+            m_chunkPlaneBricks.assign(GetTotalChunks(), 0);
+        }
+        m_scalarChunks.reserve(GetTotalChunks());
+    }
+
+    if (TracksLiquidColumns()) {
+        m_liquidSurface.Initialize(config.gridSizeX, config.gridSizeY, config.gridSizeZ, config.liquidSurfaceCache);
+    }
+
+    if (config.chunkSleepTicks > 0) {
+        m_chunkDirtyBricks.assign(GetTotalChunks(), 0);
+        m_chunkCopyBricks.assign(GetTotalChunks(), 0);
+        m_chunkUnsavedBricks.assign(GetTotalChunks(), 0);
+        m_chunkAwakeBricks.assign(GetTotalChunks(), ~0ull);
+        m_chunkSimBricks.assign(GetTotalChunks(), 0);
+        m_dilateScratch[0].assign(GetTotalChunks(), 0);
+        m_dilateScratch[1].assign(GetTotalChunks(), 0);
+        m_brickSleepTimers.assign(static_cast<size_t>(GetTotalChunks()) * CHUNK_BRICK_COUNT, 0);
+        m_chunkNeedsScan.assign(GetTotalChunks(), 1);
+        m_chunkRestless.assign(GetTotalChunks(), 0);
+        m_copyChunks.reserve(GetTotalChunks());
+    }
+    m_fullCopyPending = true;
+    m_fullPlaneBuildPending = true;
+
+    m_stats = {};
+    m_initialized = true;
+
+    uint64_t totalMemoryMB = (static_cast<uint64_t>(totalVoxels) * sizeof(uint32_t) * 2) / (1024 * 1024);
+    spdlog::info("CPUSimulation initialized: {}x{}x{} grid ({} MB), {} chunks, {} workers, {} scheduling, {} kernel",
+        m_config.gridSizeX, m_config.gridSizeY, m_config.gridSizeZ, totalMemoryMB,
+        GetTotalChunks(), m_threadPool.GetWorkerCount(),
+        m_config.scheduleMode == CPUScheduleMode::Checkerboard ? "checkerboard" : "unordered",
+        m_config.kernelMode == CPUKernelMode::Bitboard ? "bitboard" : "scalar");
+
+    return {};
+}
+
+void CPUSimulation::Shutdown() {
+    m_threadPool.Shutdown();
+    m_bitboardKernel.Shutdown();
+    m_liquidSurface.Shutdown();
+    m_explosionQueue.Shutdown();
+    m_voxelBuffers[0].clear();
+    m_voxelBuffers[0].shrink_to_fit();
+    m_voxelBuffers[1].clear();
+    m_voxelBuffers[1].shrink_to_fit();
+    m_chunkVoxelCounts.clear();
+    m_activeChunks.clear();
+    m_chunkBitboardOnly.clear();
+    m_chunkPlaneBricks.clear();
+    m_chunkEligible.clear();
+    m_scalarChunks.clear();
+    m_workerStats.clear();
+    m_workerColumnCounts.clear();
+    m_chunkDirtyBricks.clear();
+    m_chunkCopyBricks.clear();
+    m_chunkUnsavedBricks.clear();
+    m_chunkAwakeBricks.clear();
+    m_chunkSimBricks.clear();
+    m_dilateScratch[0].clear();
+    m_dilateScratch[1].clear();
+    m_brickSleepTimers.clear();
+    m_chunkNeedsScan.clear();
+    m_chunkRestless.clear();
+    m_copyChunks.clear();
+    m_initialized = false;
+}
+
+uint32_t CPUSimulation::GetVoxel(uint32_t x, uint32_t y, uint32_t z) const {
+    if (x >= m_config.gridSizeX || y >= m_config.gridSizeY || z >= m_config.gridSizeZ) {
+        return Utils::PackVoxel(Utils::Material::Bedrock, 0, 0, 0);
+    }
+    return GetReadBuffer()[Utils::LinearIndex3D(x, y, z, m_config.gridSizeX, m_config.gridSizeY)];
+}
+
+void CPUSimulation::SetVoxel(uint32_t x, uint32_t y, uint32_t z, uint32_t voxel) {
+    if (x >= m_config.gridSizeX || y >= m_config.gridSizeY || z >= m_config.gridSizeZ) {
+        return;
+    }
+    GetReadBuffer()[Utils::LinearIndex3D(x, y, z, m_config.gridSizeX, m_config.gridSizeY)] = voxel;
+    if (TracksLiquidColumns()) {
+        m_liquidSurface.MarkColumnDirty(x, z);
+    }
+    if (m_config.chunkSleepTicks > 0) {
+        WakeAroundVoxel(x, y, z);
+    }
+}
+
+void CPUSimulation::InvalidateCaches() {
+    if (m_config.liquidSurfaceCache) {
+        m_liquidSurface.MarkAllDirty();
+    }
+    if (m_config.chunkSleepTicks > 0) {
+        std::fill(m_chunkNeedsScan.begin(), m_chunkNeedsScan.end(), 1);
+        std::fill(m_brickSleepTimers.begin(), m_brickSleepTimers.end(), 0);
+        std::fill(m_chunkAwakeBricks.begin(), m_chunkAwakeBricks.end(), ~0ull);
+        std::fill(m_chunkUnsavedBricks.begin(), m_chunkUnsavedBricks.end(), ~0ull);
+    }
+    m_fullCopyPending = true;
+    m_fullPlaneBuildPending = true;
+}
+
+void CPUSimulation::CollectDirtyRegions(std::vector<CPUDirtyRegion>& out) {
+    const bool tracked = m_config.chunkSleepTicks > 0;
+    for (uint32_t i = 0; i < GetTotalChunks(); ++i) {
+        uint64_t bricks = tracked ? m_chunkUnsavedBricks[i] : ~0ull;
+        if (bricks == 0) {
+            continue;
+        }
+        if (tracked) {
+            m_chunkUnsavedBricks[i] = 0;
+        }
+
+        CPUDirtyRegion region;
+        region.chunkIndex = i;
+        region.bricks = bricks;
+        uint32_t lo[3] = { CHUNK_BRICKS_PER_AXIS, CHUNK_BRICKS_PER_AXIS, CHUNK_BRICKS_PER_AXIS };
+        uint32_t hi[3] = { 0, 0, 0 };
+        for (uint64_t remaining = bricks; remaining; remaining &= remaining - 1) {
+            uint32_t b = static_cast<uint32_t>(std::countr_zero(remaining));
+            uint32_t brick[3] = { b % CHUNK_BRICKS_PER_AXIS, (b / CHUNK_BRICKS_PER_AXIS) % CHUNK_BRICKS_PER_AXIS,
+                                  b / (CHUNK_BRICKS_PER_AXIS * CHUNK_BRICKS_PER_AXIS) };
+            for (uint32_t axis = 0; axis < 3; ++axis) {
+                lo[axis] = std::min(lo[axis], brick[axis]);
+                hi[axis] = std::max(hi[axis], brick[axis]);
+            }
+        }
+
+        uint32_t baseX = (i % m_chunkCountX) * CHUNK_SIZE;
+        uint32_t baseY = ((i / m_chunkCountX) % m_chunkCountY) * CHUNK_SIZE;
+        uint32_t baseZ = (i / (m_chunkCountX * m_chunkCountY)) * CHUNK_SIZE;
+        region.minX = baseX + lo[0] * BRICK_SIZE;
+        region.minY = baseY + lo[1] * BRICK_SIZE;
+        region.minZ = baseZ + lo[2] * BRICK_SIZE;
+        region.maxX = std::min(baseX + (hi[0] + 1) * BRICK_SIZE, m_config.gridSizeX) - 1;
+        region.maxY = std::min(baseY + (hi[1] + 1) * BRICK_SIZE, m_config.gridSizeY) - 1;
+        region.maxZ = std::min(baseZ + (hi[2] + 1) * BRICK_SIZE, m_config.gridSizeZ) - 1;
+        // Bricks past the edge of a partial chunk hold no voxels
+        if (region.minX > region.maxX || region.minY > region.maxY || region.minZ > region.maxZ) {
+            continue;
+        }
+        out.push_back(region);
+    }
+}
+
+void CPUSimulation::WakeAroundVoxel(uint32_t x, uint32_t y, uint32_t z) {
+    uint32_t chunkIndex = ((z / CHUNK_SIZE) * m_chunkCountY + y / CHUNK_SIZE) * m_chunkCountX + x / CHUNK_SIZE;
+    uint64_t bit = 1ull << LocalBrickIndex(x % CHUNK_SIZE, y % CHUNK_SIZE, z % CHUNK_SIZE);
+    m_chunkNeedsScan[chunkIndex] = 1;
+    m_chunkCopyBricks[chunkIndex] |= bit;
+    m_chunkUnsavedBricks[chunkIndex] |= bit;
+    if (!m_chunkPlaneBricks.empty()) {
+        m_chunkPlaneBricks[chunkIndex] |= bit;
+    }
+
+    // Every brick within one voxel of (x, y, z), in this chunk or its neighbours
+    for (int32_t dz = -1; dz <= 1; ++dz) {
+        for (int32_t dy = -1; dy <= 1; ++dy) {
+            for (int32_t dx = -1; dx <= 1; ++dx) {
+                int64_t nx = static_cast<int64_t>(x) + dx;
+                int64_t ny = static_cast<int64_t>(y) + dy;
+                int64_t nz = static_cast<int64_t>(z) + dz;
+                if (nx < 0 || ny < 0 || nz < 0 || nx >= m_config.gridSizeX || ny >= m_config.gridSizeY ||
+                    nz >= m_config.gridSizeZ) {
+                    continue;
+                }
+                uint32_t ux = static_cast<uint32_t>(nx), uy = static_cast<uint32_t>(ny), uz = static_cast<uint32_t>(nz);
+                uint32_t neighbour = ((uz / CHUNK_SIZE) * m_chunkCountY + uy / CHUNK_SIZE) * m_chunkCountX + ux / CHUNK_SIZE;
+                uint32_t brick = LocalBrickIndex(ux % CHUNK_SIZE, uy % CHUNK_SIZE, uz % CHUNK_SIZE);
+                m_brickSleepTimers[static_cast<size_t>(neighbour) * CHUNK_BRICK_COUNT + brick] = 0;
+                m_chunkAwakeBricks[neighbour] |= 1ull << brick;
+            }
+        }
+    }
+}
+
+void CPUSimulation::WakeLiquidColumns() {
+    const uint8_t* columnDirty = m_liquidSurface.GetDirtyFlags();
+    const uint32_t* voxels = GetReadBuffer().data();
+    const uint32_t sizeX = m_config.gridSizeX;
+    const uint32_t sizeY = m_config.gridSizeY;
+    const uint32_t sizeZ = m_config.gridSizeZ;
+
+    // One chunk column per item, so every worker owns the chunks it wakes
+    m_threadPool.ParallelFor(m_chunkCountX * m_chunkCountZ, [&](uint32_t item, uint32_t) {
+        uint32_t cx = item % m_chunkCountX;
+        uint32_t cz = item / m_chunkCountX;
+        uint32_t baseX = cx * CHUNK_SIZE;
+        uint32_t baseZ = cz * CHUNK_SIZE;
+        uint32_t endX = std::min(baseX + CHUNK_SIZE, sizeX);
+        uint32_t endZ = std::min(baseZ + CHUNK_SIZE, sizeZ);
+
+        // Brick columns (bit = bx + bz * 4) holding a changed column or one beside it
+        uint32_t brickColumns = 0;
+        for (uint32_t z = baseZ > 0 ? baseZ - 1 : 0; z < std::min(endZ + 1, sizeZ); ++z) {
+            for (uint32_t x = baseX > 0 ? baseX - 1 : 0; x < std::min(endX + 1, sizeX); ++x) {
+                if (!columnDirty[z * sizeX + x]) {
+                    continue;
+                }
+                const int32_t offsets[5][2] = { {0, 0}, {1, 0}, {-1, 0}, {0, 1}, {0, -1} };
+                for (const auto& offset : offsets) {
+                    int64_t nx = static_cast<int64_t>(x) + offset[0];
+                    int64_t nz = static_cast<int64_t>(z) + offset[1];
+                    if (nx < baseX || nx >= endX || nz < baseZ || nz >= endZ) {
+                        continue;
+                    }
+                    uint32_t bx = static_cast<uint32_t>(nx - baseX) / BRICK_SIZE;
+                    uint32_t bz = static_cast<uint32_t>(nz - baseZ) / BRICK_SIZE;
+                    brickColumns |= 1u << (bx + bz * CHUNK_BRICKS_PER_AXIS);
+                }
+            }
+        }
+        if (brickColumns == 0) {
+            return;
+        }
+
+        // Only a liquid voxel with an empty cell beside it can spread sideways
+        auto emptyAt = [&](int64_t x, uint32_t y, int64_t z) {
+            return x >= 0 && z >= 0 && x < sizeX && z < sizeZ &&
+                   Utils::UnpackMaterial(voxels[Utils::LinearIndex3D(static_cast<uint32_t>(x), y,
+                       static_cast<uint32_t>(z), sizeX, sizeY)]) == Utils::Material::Air;
+        };
+        auto canSpread = [&](uint32_t x, uint32_t y, uint32_t z) {
+            return HasMaterialFlag(Utils::UnpackMaterial(voxels[Utils::LinearIndex3D(x, y, z, sizeX, sizeY)]),
+                                   MaterialFlag::Liquid) &&
+                   (emptyAt(int64_t{x} + 1, y, z) || emptyAt(int64_t{x} - 1, y, z) ||
+                    emptyAt(x, y, int64_t{z} + 1) || emptyAt(x, y, int64_t{z} - 1));
+        };
+
+        // Wake the sleeping bricks of those brick columns holding liquid that can
+        // spread. Awake bricks run this tick and any later change to the column
+        // flags it again, so they need no scan.
+        for (uint32_t cy = 0; cy < m_chunkCountY; ++cy) {
+            uint32_t chunkIndex = (cz * m_chunkCountY + cy) * m_chunkCountX + cx;
+            uint8_t* timers = &m_brickSleepTimers[static_cast<size_t>(chunkIndex) * CHUNK_BRICK_COUNT];
+            for (uint32_t columns = brickColumns; columns; columns &= columns - 1) {
+                uint32_t column = static_cast<uint32_t>(std::countr_zero(columns));
+                uint32_t x0 = baseX + (column % CHUNK_BRICKS_PER_AXIS) * BRICK_SIZE;
+                uint32_t z0 = baseZ + (column / CHUNK_BRICKS_PER_AXIS) * BRICK_SIZE;
+                uint32_t x1 = std::min(x0 + BRICK_SIZE, sizeX);
+                uint32_t z1 = std::min(z0 + BRICK_SIZE, sizeZ);
+
+                for (uint32_t by = 0; by < CHUNK_BRICKS_PER_AXIS; ++by) {
+                    uint32_t brick = LocalBrickIndex(x0 - baseX, by * BRICK_SIZE, z0 - baseZ);
+                    if (m_chunkAwakeBricks[chunkIndex] & (1ull << brick)) {
+                        continue;
+                    }
+                    uint32_t y0 = cy * CHUNK_SIZE + by * BRICK_SIZE;
+                    uint32_t y1 = std::min(y0 + BRICK_SIZE, sizeY);
+                    bool spread = false;
+                    for (uint32_t z = z0; z < z1 && !spread; ++z) {
+                        for (uint32_t y = y0; y < y1 && !spread; ++y) {
+                            for (uint32_t x = x0; x < x1 && !spread; ++x) {
+                                spread = canSpread(x, y, z);
+                            }
+                        }
+                    }
+                    if (spread) {
+                        timers[brick] = 0;
+                        m_chunkAwakeBricks[chunkIndex] |= 1ull << brick;
+                    }
+                }
+            }
+        }
+    });
+
+    // Without the surface cache nothing else consumes the flags
+    if (!m_config.liquidSurfaceCache) {
+        m_liquidSurface.ClearAllDirty();
+    }
+}
+
+namespace {
+
+// Brick mask planes (bit = bx + by * 4 + bz * 16)
+constexpr uint64_t kBricksX0 = 0x1111111111111111ull;   // bx == 0
+constexpr uint64_t kBricksX3 = 0x8888888888888888ull;   // bx == 3
+constexpr uint64_t kBricksY0 = 0x000F000F000F000Full;   // by == 0
+constexpr uint64_t kBricksY3 = 0xF000F000F000F000ull;   // by == 3
+constexpr uint64_t kBricksZ0 = 0x000000000000FFFFull;   // bz == 0
+constexpr uint64_t kBricksZ3 = 0xFFFF000000000000ull;   // bz == 3
+
+} // namespace
+
+void CPUSimulation::UpdateChunkSleep() {
+    const uint32_t chunkCount = GetTotalChunks();
+    const uint32_t strideY = m_chunkCountX;
+    const uint32_t strideZ = m_chunkCountX * m_chunkCountY;
+
+    // ===== Pass 1: hand this tick's dirty bricks to the copy, scan and save sets =====
+    for (uint32_t i = 0; i < chunkCount; ++i) {
+        uint64_t dirty = m_chunkDirtyBricks[i];
+        if (dirty) {
+            m_chunkCopyBricks[i] |= dirty;
+            m_chunkUnsavedBricks[i] |= dirty;
+            m_chunkNeedsScan[i] = 1;
+            if (!m_chunkPlaneBricks.empty()) {
+                m_chunkPlaneBricks[i] |= dirty;
+            }
+        }
+    }
+
+    // ===== Pass 2: wake-up chain =====
+    // A change can unblock voxels one step away, so every brick touching a
+    // dirty brick wakes, including bricks across chunk faces, edges and
+    // corners. The 3x3x3 dilation is done one axis at a time.
+    std::vector<uint64_t>& dilatedX = m_dilateScratch[0];
+    std::vector<uint64_t>& dilatedXY = m_dilateScratch[1];
+    for (uint32_t i = 0; i < chunkCount; ++i) {
+        uint32_t cx = i % m_chunkCountX;
+        uint64_t m = m_chunkDirtyBricks[i];
+        uint64_t d = m | ((m << 1) & ~kBricksX0) | ((m >> 1) & ~kBricksX3);
+        if (cx > 0) d |= (m_chunkDirtyBricks[i - 1] & kBricksX3) >> 3;
+        if (cx + 1 < m_chunkCountX) d |= (m_chunkDirtyBricks[i + 1] & kBricksX0) << 3;
+        dilatedX[i] = d;
+    }
+    for (uint32_t i = 0; i < chunkCount; ++i) {
+        uint32_t cy = (i / m_chunkCountX) % m_chunkCountY;
+        uint64_t m = dilatedX[i];
+        uint64_t d = m | ((m << 4) & ~kBricksY0) | ((m >> 4) & ~kBricksY3);
+        if (cy > 0) d |= (dilatedX[i - strideY] & kBricksY3) >> 12;
+        if (cy + 1 < m_chunkCountY) d |= (dilatedX[i + strideY] & kBricksY0) << 12;
+        dilatedXY[i] = d;
+    }
+
+    // ===== Pass 3: woken bricks restart their timer, the rest age =====
+    const uint8_t sleepTicks = static_cast<uint8_t>(m_config.chunkSleepTicks);
+    for (uint32_t i = 0; i < chunkCount; ++i) {
+        uint32_t cz = i / strideZ;
+        uint64_t m = dilatedXY[i];
+        uint64_t woken = m | (m << 16) | (m >> 16);
+        if (cz > 0) woken |= (dilatedXY[i - strideZ] & kBricksZ3) >> 48;
+        if (cz + 1 < m_chunkCountZ) woken |= (dilatedXY[i + strideZ] & kBricksZ0) << 48;
+
+        m_chunkDirtyBricks[i] = 0;
+        // Bricks outside both masks are already asleep with saturated timers
+        if ((woken | m_chunkAwakeBricks[i]) == 0) {
+            continue;
+        }
+
+        uint8_t* timers = &m_brickSleepTimers[static_cast<size_t>(i) * CHUNK_BRICK_COUNT];
+        uint64_t awake = 0;
+        for (uint32_t b = 0; b < CHUNK_BRICK_COUNT; ++b) {
+            if (woken & (1ull << b)) {
+                timers[b] = 0;
+            } else if (timers[b] < sleepTicks) {
+                timers[b]++;
+            }
+            if (timers[b] < sleepTicks) {
+                awake |= 1ull << b;
+            }
+        }
+        m_chunkAwakeBricks[i] = awake;
+    }
+}
+
+uint64_t CPUSimulation::CopyReadToWrite() {
+    const uint32_t* readData = GetReadBuffer().data();
+    uint32_t* writeData = GetWriteBuffer().data();
+
+    if (m_config.chunkSleepTicks == 0 || m_fullCopyPending) {
+        uint32_t totalVoxels = GetTotalVoxels();
+        uint32_t copyBlocks = (totalVoxels + COPY_BLOCK_VOXELS - 1) / COPY_BLOCK_VOXELS;
+        m_threadPool.ParallelFor(copyBlocks, [=](uint32_t block, uint32_t) {
+            uint32_t begin = block * COPY_BLOCK_VOXELS;
+            uint32_t count = std::min(COPY_BLOCK_VOXELS, totalVoxels - begin);
+            std::memcpy(writeData + begin, readData + begin, count * sizeof(uint32_t));
+        });
+        std::fill(m_chunkCopyBricks.begin(), m_chunkCopyBricks.end(), 0);
+        m_fullCopyPending = false;
+        return totalVoxels;
+    }
+
+    // WRITE holds the state before the last tick, so it only differs from
+    // READ inside the bricks that tick (or SetVoxel since) changed
+    m_copyChunks.clear();
+    uint64_t copied = 0;
+    for (uint32_t i = 0; i < GetTotalChunks(); ++i) {
+        if (m_chunkCopyBricks[i]) {
+            m_copyChunks.push_back(i);
+            copied += static_cast<uint64_t>(std::popcount(m_chunkCopyBricks[i])) * BRICK_SIZE * BRICK_SIZE * BRICK_SIZE;
+        }
+    }
+
+    m_threadPool.ParallelFor(static_cast<uint32_t>(m_copyChunks.size()), [&](uint32_t item, uint32_t) {
+        uint32_t chunkIndex = m_copyChunks[item];
+        uint64_t bricks = m_chunkCopyBricks[chunkIndex];
+        m_chunkCopyBricks[chunkIndex] = 0;
+
+        uint32_t baseX = (chunkIndex % m_chunkCountX) * CHUNK_SIZE;
+        uint32_t baseY = ((chunkIndex / m_chunkCountX) % m_chunkCountY) * CHUNK_SIZE;
+        uint32_t baseZ = (chunkIndex / (m_chunkCountX * m_chunkCountY)) * CHUNK_SIZE;
+        uint32_t endX = std::min(baseX + CHUNK_SIZE, m_config.gridSizeX);
+        uint32_t endY = std::min(baseY + CHUNK_SIZE, m_config.gridSizeY);
+        uint32_t endZ = std::min(baseZ + CHUNK_SIZE, m_config.gridSizeZ);
+
+        for (uint32_t z = baseZ; z < endZ; ++z) {
+            for (uint32_t y = baseY; y < endY; ++y) {
+                uint32_t rowBricks = static_cast<uint32_t>(bricks >> LocalBrickIndex(0, y - baseY, z - baseZ)) &
+                                     ((1u << CHUNK_BRICKS_PER_AXIS) - 1);
+                // Copy each run of adjacent bricks in the row as one span
+                while (rowBricks) {
+                    uint32_t first = static_cast<uint32_t>(std::countr_zero(rowBricks));
+                    uint32_t run = static_cast<uint32_t>(std::countr_one(rowBricks >> first));
+                    rowBricks &= ~(((1u << run) - 1) << first);
+
+                    uint32_t x0 = baseX + first * BRICK_SIZE;
+                    uint32_t x1 = std::min(x0 + run * BRICK_SIZE, endX);
+                    if (x0 >= x1) {
+                        continue;
+                    }
+                    uint32_t offset = Utils::LinearIndex3D(x0, y, z, m_config.gridSizeX, m_config.gridSizeY);
+                    std::memcpy(writeData + offset, readData + offset, (x1 - x0) * sizeof(uint32_t));
+                }
+            }
+        }
+    });
+    return copied;
+}
+
+uint32_t CPUSimulation::CountChunkVoxels(const std::vector<uint32_t>& voxels, uint32_t chunkIndex, bool stopAtFirst,
+                                        bool* outBitboardOnly, bool* outRestless) const {
+    uint32_t cx = chunkIndex % m_chunkCountX;
+    uint32_t cy = (chunkIndex / m_chunkCountX) % m_chunkCountY;
+    uint32_t cz = chunkIndex / (m_chunkCountX * m_chunkCountY);
+
+    uint32_t baseX = cx * CHUNK_SIZE;
+    uint32_t baseY = cy * CHUNK_SIZE;
+    uint32_t baseZ = cz * CHUNK_SIZE;
+    uint32_t endX = std::min(baseX + CHUNK_SIZE, m_config.gridSizeX);
+    uint32_t endY = std::min(baseY + CHUNK_SIZE, m_config.gridSizeY);
+    uint32_t endZ = std::min(baseZ + CHUNK_SIZE, m_config.gridSizeZ);
+
+    uint32_t count = 0;
+    bool bitboardOnly = true;
+    bool restless = false;
+    for (uint32_t z = baseZ; z < endZ; ++z) {
+        for (uint32_t y = baseY; y < endY; ++y) {
+            const uint32_t* row = &voxels[Utils::LinearIndex3D(baseX, y, z, m_config.gridSizeX, m_config.gridSizeY)];
+            for (uint32_t x = 0; x < endX - baseX; ++x) {
+                uint8_t mat = Utils::UnpackMaterial(row[x]);
+                count += mat != Utils::Material::Air ? 1 : 0;
+                if (outBitboardOnly) {
+                    bitboardOnly = bitboardOnly && IsBitboardMaterial(mat);
+                }
+                if (outRestless) {
+                    restless = restless || HasMaterialFlag(mat, MaterialFlag::Restless);
+                }
+            }
+            if (stopAtFirst && count > 0) {
+                return count;
+            }
+        }
+    }
+    if (outBitboardOnly) {
+        *outBitboardOnly = bitboardOnly;
+    }
+    if (outRestless) {
+        *outRestless = restless;
+    }
+    return count;
+}
+
+uint64_t CPUSimulation::ScanActiveChunks(bool countVoxels) {
+    const std::vector<uint32_t>& voxels = GetReadBuffer();
+    const bool bitboard = m_config.kernelMode == CPUKernelMode::Bitboard;
+    const bool trackSleep = m_config.chunkSleepTicks > 0;
+    // Material classification (bitboard eligibility, restless materials) needs every voxel
+    const bool stopAtFirst = !countVoxels && !bitboard && !trackSleep;
+
+    m_threadPool.ParallelFor(GetTotalChunks(), [&](uint32_t chunkIndex, uint32_t) {
+        // With sleep tracking, chunks nothing wrote to still hold last tick's results
+        if (trackSleep && !m_chunkNeedsScan[chunkIndex]) {
+            return;
+        }
+        bool bitboardOnly = true;
+        bool restless = false;
+        m_chunkVoxelCounts[chunkIndex] = CountChunkVoxels(voxels, chunkIndex, stopAtFirst,
+            bitboard ? &bitboardOnly : nullptr, trackSleep ? &restless : nullptr);
+        if (bitboard) {
+            m_chunkBitboardOnly[chunkIndex] = bitboardOnly ? 1 : 0;
+        }
+        if (trackSleep) {
+            m_chunkRestless[chunkIndex] = restless ? 1 : 0;
+            m_chunkNeedsScan[chunkIndex] = 0;
+        }
+    });
+
+    uint64_t total = 0;
+    m_activeChunks.clear();
+    m_nonEmptyChunks = 0;
+    for (uint32_t i = 0; i < GetTotalChunks(); ++i) {
+        if (m_chunkVoxelCounts[i] == 0) {
+            continue;
+        }
+        total += m_chunkVoxelCounts[i];
+        ++m_nonEmptyChunks;
+        if (!trackSleep) {
+            m_activeChunks.push_back(i);
+            continue;
+        }
+        // Restless materials change without anything waking them, so their chunks run whole
+        m_chunkSimBricks[i] = m_chunkRestless[i] ? ~0ull : m_chunkAwakeBricks[i];
+        if (m_chunkSimBricks[i] != 0) {
+            m_activeChunks.push_back(i);
+        }
+    }
+    return total;
+}
+
+uint64_t CPUSimulation::CountVoxels(const std::vector<uint32_t>& voxels) {
+    m_threadPool.ParallelFor(GetTotalChunks(), [&](uint32_t chunkIndex, uint32_t) {
+        m_chunkVoxelCounts[chunkIndex] = CountChunkVoxels(voxels, chunkIndex, false);
+    });
+
+    uint64_t total = 0;
+    for (uint32_t count : m_chunkVoxelCounts) {
+        total += count;
+    }
+    return total;
+}
+
+void CPUSimulation::SimulateChunks(const CPUPhysicsContext& ctx, const std::vector<uint32_t>& chunks) {
+    m_threadPool.ParallelFor(static_cast<uint32_t>(chunks.size()),
+        [this, &ctx, &chunks](uint32_t item, uint32_t worker) {
+            SimulateChunk(ctx, chunks[item], m_workerStats[worker], m_explosionQueue.GetWorkerEvents(worker));
+        });
+}
+
+void CPUSimulation::ApplyExplosions(const CPUPhysicsContext& ctx) {
+    uint32_t tileCount = m_explosionQueue.Resolve();
+    if (tileCount == 0) {
+        return;
+    }
+    // Every tile is one chunk, so workers never write the same voxel
+    m_threadPool.ParallelFor(tileCount, [this, &ctx](uint32_t tile, uint32_t worker) {
+        m_explosionQueue.ApplyTile(ctx, tile, worker, m_workerStats[worker]);
+    });
+}
+
+void CPUSimulation::RunBitboardStep(const CPUPhysicsContext& ctx) {
+    // Planes must match READ before any chunk moves. With dirty tracking they
+    // persist between ticks and only bricks changed since the last build are
+    // decoded again, so sleeping bricks cost nothing here
+    if (m_chunkPlaneBricks.empty() || m_fullPlaneBuildPending) {
+        m_threadPool.ParallelFor(m_config.gridSizeZ, [&](uint32_t z, uint32_t) {
+            m_bitboardKernel.BuildSlice(ctx.voxelsIn, z, m_chunkVoxelCounts.data(), m_chunkCountX, m_chunkCountY);
+        });
+        m_fullPlaneBuildPending = false;
+    } else {
+        m_threadPool.ParallelFor(m_config.gridSizeZ, [&](uint32_t z, uint32_t) {
+            m_bitboardKernel.UpdateSlice(ctx.voxelsIn, z, m_chunkPlaneBricks.data(), m_chunkCountX, m_chunkCountY);
+        });
+    }
+    std::fill(m_chunkPlaneBricks.begin(), m_chunkPlaneBricks.end(), 0);
+
+    // A chunk is eligible when it and its face neighbours hold only bitboard
+    // materials, so no reaction can reach its sand or water this tick
+    auto bitboardOnlyAt = [&](int32_t cx, int32_t cy, int32_t cz) {
+        if (cx < 0 || cy < 0 || cz < 0 || cx >= static_cast<int32_t>(m_chunkCountX) ||
+            cy >= static_cast<int32_t>(m_chunkCountY) || cz >= static_cast<int32_t>(m_chunkCountZ)) {
+            return true;
+        }
+        return m_chunkBitboardOnly[(cz * m_chunkCountY + cy) * m_chunkCountX + cx] != 0;
+    };
+
+    std::fill(m_chunkEligible.begin(), m_chunkEligible.end(), 0);
+    m_scalarChunks.clear();
+    for (uint32_t chunkIndex : m_activeChunks) {
+        int32_t cx = static_cast<int32_t>(chunkIndex % m_chunkCountX);
+        int32_t cy = static_cast<int32_t>((chunkIndex / m_chunkCountX) % m_chunkCountY);
+        int32_t cz = static_cast<int32_t>(chunkIndex / (m_chunkCountX * m_chunkCountY));
+
+        bool eligible = bitboardOnlyAt(cx, cy, cz) &&
+                        bitboardOnlyAt(cx - 1, cy, cz) && bitboardOnlyAt(cx + 1, cy, cz) &&
+                        bitboardOnlyAt(cx, cy - 1, cz) && bitboardOnlyAt(cx, cy + 1, cz) &&
+                        bitboardOnlyAt(cx, cy, cz - 1) && bitboardOnlyAt(cx, cy, cz + 1);
+        m_chunkEligible[chunkIndex] = eligible ? 1 : 0;
+        if (!eligible) {
+            m_scalarChunks.push_back(chunkIndex);
+        }
+    }
+
+    // Moves reach one voxel in Z, so chunk layers of the same parity never
+    // touch each other's rows: even layers first, then odd layers
+    for (uint32_t parity = 0; parity < 2; ++parity) {
+        uint32_t layerCount = (m_chunkCountZ + 1 - parity) / 2;
+        m_threadPool.ParallelFor(layerCount, [&](uint32_t item, uint32_t worker) {
+            uint32_t cz = item * 2 + parity;
+            uint32_t zBegin = cz * CHUNK_SIZE;
+            uint32_t zEnd = std::min(zBegin + CHUNK_SIZE, m_config.gridSizeZ);
+            m_bitboardKernel.SimulateSlices(ctx, m_chunkEligible.data(), zBegin, zEnd, m_workerStats[worker]);
+        });
+    }
+}
+
+void CPUSimulation::Step(uint32_t frameIndex) {
+    if (!m_initialized) {
+        return;
+    }
+
+    auto startTime = std::chrono::steady_clock::now();
+
+    if (m_config.chunkSleepTicks > 0) {
+        WakeLiquidColumns();
+    }
+
+    // ===== STEP 1: Scan for non-empty chunks =====
+    uint64_t massBefore = ScanActiveChunks(m_config.validateMass);
+
+    // ===== STEP 2: Copy READ -> WRITE (voxels that don't move keep their value) =====
+    const uint32_t* readData = GetReadBuffer().data();
+    uint32_t* writeData = GetWriteBuffer().data();
+    uint64_t voxelsCopied = CopyReadToWrite();
+
+    // ===== STEP 3: Refresh liquid surface columns changed by the last tick =====
+    uint32_t liquidColumnsRebuilt = 0;
+    if (m_config.liquidSurfaceCache) {
+        std::fill(m_workerColumnCounts.begin(), m_workerColumnCounts.end(), 0);
+        m_threadPool.ParallelFor(m_config.gridSizeZ, [&](uint32_t z, uint32_t worker) {
+            m_workerColumnCounts[worker] += m_liquidSurface.RebuildSlice(readData, z);
+        });
+        for (uint32_t count : m_workerColumnCounts) {
+            liquidColumnsRebuilt += count;
+        }
+    }
+
+    // ===== STEP 4: Simulate active chunks =====
+    CPUPhysicsContext ctx;
+    ctx.voxelsIn = readData;
+    ctx.voxelsOut = writeData;
+    ctx.gridSizeX = m_config.gridSizeX;
+    ctx.gridSizeY = m_config.gridSizeY;
+    ctx.gridSizeZ = m_config.gridSizeZ;
+    ctx.frameIndex = frameIndex;
+    ctx.chunkCountX = m_chunkCountX;
+    ctx.chunkCountY = m_chunkCountY;
+    ctx.chunkCountZ = m_chunkCountZ;
+    ctx.conflictFree = m_config.scheduleMode == CPUScheduleMode::Checkerboard;
+    if (m_config.liquidSurfaceCache) {
+        ctx.liquidSurface = m_liquidSurface.GetSurfaceData();
+    }
+    if (TracksLiquidColumns()) {
+        ctx.liquidColumnDirty = m_liquidSurface.GetDirtyFlags();
+    }
+    if (m_config.chunkSleepTicks > 0) {
+        ctx.dirtyBricks = m_chunkDirtyBricks.data();
+        ctx.simulateBricks = m_chunkSimBricks.data();
+    }
+
+    std::fill(m_workerStats.begin(), m_workerStats.end(), CPUPhysicsStats{});
+
+    const std::vector<uint32_t>* scalarChunks = &m_activeChunks;
+    if (m_config.kernelMode == CPUKernelMode::Bitboard) {
+        RunBitboardStep(ctx);
+        scalarChunks = &m_scalarChunks;
+    }
+
+    if (m_config.scheduleMode == CPUScheduleMode::Checkerboard) {
+        // One pass per colour; each pass finishes before the next starts
+        m_passScheduler.Build(*scalarChunks, m_chunkCountX, m_chunkCountY);
+        for (uint32_t pass = 0; pass < PassScheduler::PASS_COUNT; ++pass) {
+            uint32_t color = PassScheduler::GetPassColor(frameIndex, pass);
+            SimulateChunks(ctx, m_passScheduler.GetChunksForColor(color));
+        }
+    } else {
+        SimulateChunks(ctx, m_activeChunks);
+    }
+
+    // Blasts detected during the passes, each affected voxel written once
+    ApplyExplosions(ctx);
+
+    CPUPhysicsStats totals;
+    for (const CPUPhysicsStats& workerStats : m_workerStats) {
+        totals.Accumulate(workerStats);
+    }
+
+    // ===== STEP 5: Mass conservation check =====
+    // Moves never create or destroy voxels, so the only legal change in the
+    // non-air count is what the reactions reported
+    if (m_config.validateMass) {
+        uint64_t massAfter = CountVoxels(GetWriteBuffer());
+        int64_t expected = static_cast<int64_t>(massBefore) + totals.reactionMassDelta;
+
+        m_stats.massBefore = massBefore;
+        m_stats.massAfter = massAfter;
+        m_stats.reactionMassDelta = totals.reactionMassDelta;
+        m_stats.massConserved = static_cast<int64_t>(massAfter) == expected;
+
+        if (!m_stats.massConserved) {
+            m_stats.massViolationTicks++;
+            // Unordered mode races by design; only report for the conflict-free scheduler
+            if (m_config.scheduleMode == CPUScheduleMode::Checkerboard) {
+                spdlog::warn("CPUSimulation: mass not conserved on tick {} ({} -> {}, expected {})",
+                    m_stats.tickIndex, massBefore, massAfter, expected);
+            }
+        }
+    }
+
+    // ===== STEP 6: Swap so the result becomes the next READ buffer =====
+    SwapBuffers();
+
+    // ===== STEP 7: Put unchanged bricks to sleep, wake neighbours of changes =====
+    if (m_config.chunkSleepTicks > 0) {
+        UpdateChunkSleep();
+    }
+
+    auto endTime = std::chrono::steady_clock::now();
+    double elapsedMs = std::chrono::duration<double, std::milli>(endTime - startTime).count();
+
+    m_stats.tickIndex++;
+    m_stats.activeChunks = static_cast<uint32_t>(m_activeChunks.size());
+    m_stats.nonEmptyChunks = m_nonEmptyChunks;
+    m_stats.sleepingChunks = m_nonEmptyChunks - m_stats.activeChunks;
+    m_stats.sleepingChunkRatio = m_nonEmptyChunks > 0
+        ? static_cast<float>(m_stats.sleepingChunks) / static_cast<float>(m_nonEmptyChunks) : 0.0f;
+    m_stats.simulatedBricks = 0;
+    for (uint32_t chunkIndex : m_activeChunks) {
+        m_stats.simulatedBricks += m_config.chunkSleepTicks > 0
+            ? static_cast<uint32_t>(std::popcount(m_chunkSimBricks[chunkIndex])) : CHUNK_BRICK_COUNT;
+    }
+    m_stats.voxelsCopied = voxelsCopied;
+    m_stats.bitboardChunks = static_cast<uint32_t>(m_activeChunks.size() - scalarChunks->size());
+    m_stats.voxelsProcessed = totals.voxelsProcessed;
+    m_stats.voxelsMoved = totals.voxelsMoved;
+    m_stats.liquidColumnsRebuilt = liquidColumnsRebuilt;
+    m_stats.detonations = m_explosionQueue.GetDetonationCount();
+    m_stats.voxelsExploded = totals.voxelsExploded;
+    m_stats.lastTickMs = elapsedMs;
+    m_stats.voxelsPerSecond = elapsedMs > 0.0 ? totals.voxelsProcessed / (elapsedMs / 1000.0) : 0.0;
+}
+
+} // namespace VENPOD::Simulation
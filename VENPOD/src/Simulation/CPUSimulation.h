@@ -0,0 +1,204 @@
+#pragma once
+
+// =============================================================================
+// VENPOD CPU Simulation - Multithreaded CPU backend for the voxel physics
+// Runs the same tick as the GPU path (scan -> copy READ to WRITE -> per-chunk
+// physics -> swap) on a thread pool, without any D3D12 dependency. Used for
+// headless runs, benchmarking and GPU-less machines.
+// =============================================================================
+
+#include <cstdint>
+#include <vector>
+#include "CPUPhysicsKernel.h"
+#include "BitboardKernel.h"
+#include "PassScheduler.h"
+#include "LiquidSurfaceCache.h"
+#include "ExplosionQueue.h"
+#include "../Core/ThreadPool.h"
+#include "../Utils/Result.h"
+
+namespace VENPOD::Simulation {
+
+// How active chunks are distributed across workers
+enum class CPUScheduleMode : uint8_t {
+    Unordered,      // All chunks at once; racing writes like the GPU path
+    Checkerboard    // 8 colour passes with disjoint write sets (conserves mass)
+};
+
+// Which kernel simulates chunks that only hold sand, water and inert solids
+enum class CPUKernelMode : uint8_t {
+    Scalar,         // Per-voxel port of CS_GravityChunk for every chunk
+    Bitboard        // Word-parallel sand/water step where possible (needs Checkerboard)
+};
+
+// CPU world configuration
+struct CPUSimulationConfig {
+    uint32_t gridSizeX = 256;
+    uint32_t gridSizeY = 256;
+    uint32_t gridSizeZ = 256;
+    uint32_t workerCount = 0;   // 0 = hardware concurrency
+    CPUScheduleMode scheduleMode = CPUScheduleMode::Checkerboard;
+    CPUKernelMode kernelMode = CPUKernelMode::Scalar;
+    bool validateMass = true;   // Count voxels before/after every tick
+    bool liquidSurfaceCache = true;  // O(1) liquid column heights, rebuilt only for changed columns
+    uint32_t chunkSleepTicks = 8;    // Quiet ticks before a brick/chunk sleeps (1-255), 0 = no dirty tracking
+};
+
+// Voxels changed since the last CollectDirtyRegions call, one entry per chunk
+struct CPUDirtyRegion {
+    uint32_t chunkIndex = 0;
+    uint64_t bricks = 0;            // Changed bricks (bit = bx + by * 4 + bz * 16)
+    uint32_t minX = 0, minY = 0, minZ = 0;  // Voxel bounds of those bricks, inclusive
+    uint32_t maxX = 0, maxY = 0, maxZ = 0;
+};
+
+// Stats from the most recent tick
+struct CPUSimulationStats {
+    uint64_t tickIndex = 0;
+    uint32_t activeChunks = 0;       // Chunks simulated this tick
+    uint32_t nonEmptyChunks = 0;     // Chunks holding at least one voxel
+    uint32_t sleepingChunks = 0;     // Non-empty chunks skipped because nothing in or around them changed
+    float sleepingChunkRatio = 0.0f; // sleepingChunks / nonEmptyChunks
+    uint32_t simulatedBricks = 0;    // 4³ bricks iterated inside the active chunks
+    uint64_t voxelsCopied = 0;       // Voxels moved by the READ -> WRITE copy
+    uint32_t bitboardChunks = 0;     // Of those, chunks handled by the bitboard kernel
+    uint64_t voxelsProcessed = 0;    // Non-air voxels evaluated
+    uint64_t voxelsMoved = 0;
+    uint32_t liquidColumnsRebuilt = 0;  // Liquid surface cache columns refreshed before the tick
+    uint32_t detonations = 0;        // Gunpowder voxels that detonated
+    uint64_t voxelsExploded = 0;     // Voxels written by the explosion pass (each at most once)
+    double lastTickMs = 0.0;
+    double voxelsPerSecond = 0.0;
+
+    // Mass conservation (only filled when validateMass is set)
+    uint64_t massBefore = 0;         // Non-air voxels before the tick
+    uint64_t massAfter = 0;          // Non-air voxels after the tick
+    int64_t reactionMassDelta = 0;   // Expected change from reactions (fire, explosions...)
+    bool massConserved = true;       // massAfter == massBefore + reactionMassDelta
+    uint64_t massViolationTicks = 0; // Ticks that failed the check since Initialize
+};
+
+class CPUSimulation {
+public:
+    CPUSimulation() = default;
+    ~CPUSimulation() = default;
+
+    // Non-copyable
+    CPUSimulation(const CPUSimulation&) = delete;
+    CPUSimulation& operator=(const CPUSimulation&) = delete;
+
+    Result<void> Initialize(const CPUSimulationConfig& config = {});
+    void Shutdown();
+
+    // Advance the simulation by one tick (frameIndex seeds the per-voxel RNG)
+    void Step(uint32_t frameIndex);
+
+    // Swap ping-pong buffers (Step does this after physics)
+    void SwapBuffers() { m_readBufferIndex = 1 - m_readBufferIndex; }
+
+    // Current read/write buffers
+    std::vector<uint32_t>& GetReadBuffer() { return m_voxelBuffers[m_readBufferIndex]; }
+    std::vector<uint32_t>& GetWriteBuffer() { return m_voxelBuffers[1 - m_readBufferIndex]; }
+    const std::vector<uint32_t>& GetReadBuffer() const { return m_voxelBuffers[m_readBufferIndex]; }
+    const std::vector<uint32_t>& GetWriteBuffer() const { return m_voxelBuffers[1 - m_readBufferIndex]; }
+
+    // Direct voxel access on the READ buffer (for seeding worlds between ticks).
+    // Edits made through GetReadBuffer() instead must call InvalidateCaches().
+    uint32_t GetVoxel(uint32_t x, uint32_t y, uint32_t z) const;
+    void SetVoxel(uint32_t x, uint32_t y, uint32_t z, uint32_t voxel);
+    void InvalidateCaches();
+
+    // Append the bricks changed since the previous call (by ticks or SetVoxel)
+    // and clear them. Used to limit chunk re-uploads and saves to what changed.
+    // Without dirty tracking (chunkSleepTicks == 0) every chunk is reported.
+    void CollectDirtyRegions(std::vector<CPUDirtyRegion>& out);
+
+    // Grid properties
+    uint32_t GetGridSizeX() const { return m_config.gridSizeX; }
+    uint32_t GetGridSizeY() const { return m_config.gridSizeY; }
+    uint32_t GetGridSizeZ() const { return m_config.gridSizeZ; }
+    uint32_t GetTotalVoxels() const { return m_config.gridSizeX * m_config.gridSizeY * m_config.gridSizeZ; }
+    uint32_t GetTotalChunks() const { return m_chunkCountX * m_chunkCountY * m_chunkCountZ; }
+    uint32_t GetWorkerCount() const { return m_threadPool.GetWorkerCount(); }
+
+    const CPUSimulationStats& GetStats() const { return m_stats; }
+
+private:
+    // Collect every chunk with at least one non-air voxel (same rule as CS_ChunkScanner).
+    // With countVoxels the scan also fills m_chunkVoxelCounts and returns the total.
+    uint64_t ScanActiveChunks(bool countVoxels);
+    uint64_t CountVoxels(const std::vector<uint32_t>& voxels);
+    uint32_t CountChunkVoxels(const std::vector<uint32_t>& voxels, uint32_t chunkIndex, bool stopAtFirst,
+                              bool* outBitboardOnly = nullptr, bool* outRestless = nullptr) const;
+
+    // Copy READ -> WRITE: the whole grid after external edits, otherwise only
+    // the bricks that differ (changed by the last tick or by SetVoxel)
+    uint64_t CopyReadToWrite();
+
+    // Chunk sleep (plan.md §3.3): dilate this tick's dirty bricks by one brick,
+    // across chunk faces, edges and corners (the wake-up chain), reset their
+    // sleep timers and age the rest
+    void UpdateChunkSleep();
+    void WakeAroundVoxel(uint32_t x, uint32_t y, uint32_t z);
+    // The pressure rule reads whole liquid columns, so a change far up a
+    // column moves a resting pool below it: wake the bricks holding liquid
+    // that can spread sideways in every column whose liquid layout changed
+    // since the last tick, and in the columns beside it
+    void WakeLiquidColumns();
+    // Column dirty flags are kept for the liquid surface cache or chunk sleep
+    bool TracksLiquidColumns() const { return m_config.liquidSurfaceCache || m_config.chunkSleepTicks > 0; }
+
+    // Bitboard mode: bring the planes up to date, pick eligible chunks and run the bitboard step.
+    // Leaves the chunks that still need the scalar kernel in m_scalarChunks.
+    void RunBitboardStep(const CPUPhysicsContext& ctx);
+
+    void SimulateChunks(const CPUPhysicsContext& ctx, const std::vector<uint32_t>& chunks);
+
+    // Resolve the blasts queued during the chunk passes and apply them
+    void ApplyExplosions(const CPUPhysicsContext& ctx);
+
+    CPUSimulationConfig m_config;
+    uint32_t m_chunkCountX = 0;
+    uint32_t m_chunkCountY = 0;
+    uint32_t m_chunkCountZ = 0;
+
+    // Ping-pong voxel buffers (read from one, write to other)
+    std::vector<uint32_t> m_voxelBuffers[2];
+    uint32_t m_readBufferIndex = 0;
+
+    ThreadPool m_threadPool;
+    PassScheduler m_passScheduler;
+    BitboardKernel m_bitboardKernel;
+    LiquidSurfaceCache m_liquidSurface;
+    ExplosionQueue m_explosionQueue;
+
+    // Per-tick scratch
+    std::vector<uint32_t> m_chunkVoxelCounts;    // Non-air count per chunk (>0 when non-empty), filled in parallel
+    std::vector<uint32_t> m_activeChunks;        // Compacted chunk indices
+    std::vector<uint8_t> m_chunkBitboardOnly;    // Chunk holds only bitboard materials (bitboard mode)
+    std::vector<uint8_t> m_chunkEligible;        // Chunk simulated by the bitboard kernel this tick
+    std::vector<uint64_t> m_chunkPlaneBricks;    // Bricks changed since the bitboard planes were built (with sleep)
+    bool m_fullPlaneBuildPending = true;         // Planes don't match READ: build every row
+    std::vector<uint32_t> m_scalarChunks;        // Active chunks left for the scalar kernel
+    std::vector<CPUPhysicsStats> m_workerStats;  // One per pool worker
+    std::vector<uint32_t> m_workerColumnCounts;  // Liquid surface columns rebuilt, one per pool worker
+
+    // Dirty tracking and sleep state (only when chunkSleepTicks > 0), brick masks per chunk
+    std::vector<uint64_t> m_chunkDirtyBricks;    // Written by the kernels this tick
+    std::vector<uint64_t> m_chunkCopyBricks;     // Differ between READ and WRITE before the next copy
+    std::vector<uint64_t> m_chunkUnsavedBricks;  // Changed since the last CollectDirtyRegions
+    std::vector<uint64_t> m_chunkAwakeBricks;    // Sleep timer below chunkSleepTicks
+    std::vector<uint64_t> m_chunkSimBricks;      // Bricks simulated this tick (all for restless chunks)
+    std::vector<uint64_t> m_dilateScratch[2];
+    std::vector<uint8_t> m_brickSleepTimers;     // CHUNK_BRICK_COUNT per chunk, ticks since last woken
+    std::vector<uint8_t> m_chunkNeedsScan;       // Contents changed since the last scan
+    std::vector<uint8_t> m_chunkRestless;        // Holds materials that change on their own (fire, acid...)
+    std::vector<uint32_t> m_copyChunks;          // Chunks with bricks to copy this tick
+    bool m_fullCopyPending = true;               // READ was edited directly: copy everything
+    uint32_t m_nonEmptyChunks = 0;
+
+    CPUSimulationStats m_stats;
+    bool m_initialized = false;
+};
+
+} // namespace VENPOD::Simulation
@@ -1,6 +1,7 @@
 #include "Chunk.h"
 #include "../Graphics/RHI/d3dx12.h"
 #include <spdlog/spdlog.h>
+#include <algorithm>
 #include <format>
 
 namespace VENPOD::Simulation {
@@ -18,12 +19,19 @@ struct alignas(16) ChunkConstants {
 Chunk::Chunk(Chunk&& other) noexcept
     : m_coord(other.m_coord)
     , m_state(other.m_state)
+    , m_uniform(other.m_uniform)
+    , m_readbackPending(other.m_readbackPending)
     , m_voxelBuffer(std::move(other.m_voxelBuffer))
     , m_voxelSRV(other.m_voxelSRV)
     , m_voxelUAV(other.m_voxelUAV)
     , m_heapManager(other.m_heapManager)
+    , m_cpuVoxels(std::move(other.m_cpuVoxels))
+    , m_uploadStaging(std::move(other.m_uploadStaging))
+    , m_readback(std::move(other.m_readback))
 {
     other.m_state = ChunkState::Ungenerated;
+    other.m_uniform = false;
+    other.m_readbackPending = false;
     other.m_voxelSRV.Invalidate();
     other.m_voxelUAV.Invalidate();
     other.m_heapManager = nullptr;
@@ -35,12 +43,19 @@ Chunk& Chunk::operator=(Chunk&& other) noexcept {
 
         m_coord = other.m_coord;
         m_state = other.m_state;
+        m_uniform = other.m_uniform;
+        m_readbackPending = other.m_readbackPending;
         m_voxelBuffer = std::move(other.m_voxelBuffer);
         m_voxelSRV = other.m_voxelSRV;
         m_voxelUAV = other.m_voxelUAV;
         m_heapManager = other.m_heapManager;
+        m_cpuVoxels = std::move(other.m_cpuVoxels);
+        m_uploadStaging = std::move(other.m_uploadStaging);
+        m_readback = std::move(other.m_readback);
 
         other.m_state = ChunkState::Ungenerated;
+        other.m_uniform = false;
+        other.m_readbackPending = false;
         other.m_voxelSRV.Invalidate();
         other.m_voxelUAV.Invalidate();
         other.m_heapManager = nullptr;
@@ -59,8 +74,110 @@ Result<void> Chunk::Initialize(
     }
 
     m_coord = coord;
-    m_heapManager = &heapManager;
     m_state = ChunkState::Ungenerated;
+    m_uniform = false;
+    m_readbackPending = false;
+
+    // Pooled chunk: reuse the buffer and descriptors it already owns
+    if (HasVoxelBuffer()) {
+        return {};
+    }
+
+    return CreateVoxelBuffer(device, heapManager, debugNamePrefix);
+}
+
+void Chunk::InitializeUniform(const ChunkCoord& coord, uint32_t voxel, uint32_t worldSeed) {
+    m_coord = coord;
+
+    int32_t originX, originY, originZ;
+    GetWorldOrigin(originX, originY, originZ);
+    PalettedVoxels uniform;
+    uniform.SetVariantOrigin(originX, originY, originZ, worldSeed);
+    uniform.Initialize(INFINITE_CHUNK_SIZE, voxel);
+    m_cpuVoxels.Reset(std::move(uniform));
+
+    // Nothing to dispatch - the single value is the generated result
+    m_state = ChunkState::Generated;
+    m_uniform = true;
+
+    spdlog::debug("Chunk[{},{},{}] uniform - voxel 0x{:08X}, no GPU buffer",
+        coord.x, coord.y, coord.z, voxel);
+}
+
+Result<void> Chunk::Materialize(
+    ID3D12Device* device,
+    ID3D12GraphicsCommandList* cmdList,
+    Graphics::DescriptorHeapManager& heapManager)
+{
+    if (!m_uniform) {
+        return {};  // Already has a full buffer
+    }
+    if (!device || !cmdList) {
+        return Error("Chunk::Materialize - null parameters");
+    }
+
+    // A pooled chunk may still own an idle buffer from its previous coordinate
+    if (!HasVoxelBuffer()) {
+        auto result = CreateVoxelBuffer(device, heapManager, "InfiniteChunk");
+        if (!result) {
+            return Error("Failed to materialize chunk [{},{},{}]: {}",
+                m_coord.x, m_coord.y, m_coord.z, result.error());
+        }
+    }
+
+    // Decoding restores the generator's per-voxel variants exactly
+    auto result = UploadCPUVoxels(device, cmdList);
+    if (!result) {
+        return result;
+    }
+    m_uniform = false;
+    return {};
+}
+
+void Chunk::TakeVoxelBuffer(Chunk& other) {
+    if (this == &other || HasVoxelBuffer() || !other.HasVoxelBuffer()) {
+        return;
+    }
+    m_voxelBuffer = std::move(other.m_voxelBuffer);
+    m_voxelSRV = other.m_voxelSRV;
+    m_voxelUAV = other.m_voxelUAV;
+    m_heapManager = other.m_heapManager;
+
+    other.m_voxelSRV.Invalidate();
+    other.m_voxelUAV.Invalidate();
+    other.m_heapManager = nullptr;
+    other.m_readback.Reset();
+}
+
+Result<void> Chunk::AttachVoxelBuffer(ID3D12Device* device, Graphics::DescriptorHeapManager& heapManager) {
+    if (!device) {
+        return Error("Chunk::AttachVoxelBuffer - device is null");
+    }
+    if (HasVoxelBuffer()) {
+        return {};
+    }
+    return CreateVoxelBuffer(device, heapManager, "InfiniteChunk");
+}
+
+bool Chunk::PredictUniform(const ChunkCoord& coord, uint32_t& outVoxel) {
+    int32_t originX, originY, originZ;
+    coord.GetWorldOrigin(originX, originY, originZ, INFINITE_CHUNK_SIZE);
+
+    // Entirely above the highest possible terrain and above the sea: all air
+    if (originY >= std::max(GENERATED_MAX_TERRAIN_HEIGHT, GENERATED_SEA_LEVEL)) {
+        outVoxel = 0;
+        return true;
+    }
+    return false;
+}
+
+Result<void> Chunk::CreateVoxelBuffer(
+    ID3D12Device* device,
+    Graphics::DescriptorHeapManager& heapManager,
+    const char* debugNamePrefix)
+{
+    const ChunkCoord& coord = m_coord;
+    m_heapManager = &heapManager;
 
     // Create debug name
     std::string bufferName = std::format("{}[{},{},{}]_VoxelBuffer",
@@ -139,10 +256,25 @@ void Chunk::Shutdown() {
     }
 
     m_voxelBuffer.Shutdown();
+    m_cpuVoxels.Reset();
+    m_uploadStaging.Reset();
+    m_readback.Reset();
     m_state = ChunkState::Ungenerated;
+    m_uniform = false;
+    m_readbackPending = false;
     m_heapManager = nullptr;
 }
 
+void Chunk::Recycle() {
+    m_coord = ChunkCoord{};
+    m_state = ChunkState::Ungenerated;
+    m_uniform = false;
+    m_readbackPending = false;
+    m_cpuVoxels.Reset();
+    m_uploadStaging.Reset();
+    m_readback.Reset();
+}
+
 Result<void> Chunk::Generate(
     ID3D12Device* device,
     ID3D12GraphicsCommandList* cmdList,
@@ -207,12 +339,8 @@ Result<void> Chunk::Generate(
     constantBuffer->Unmap(0, nullptr);
 
     // ===== STEP 4: Transition voxel buffer to UAV state =====
-    D3D12_RESOURCE_BARRIER barrierToUAV = CD3DX12_RESOURCE_BARRIER::Transition(
-        m_voxelBuffer.GetResource(),
-        D3D12_RESOURCE_STATE_COMMON,
-        D3D12_RESOURCE_STATE_UNORDERED_ACCESS
-    );
-    cmdList->ResourceBarrier(1, &barrierToUAV);
+    // Tracked by the buffer: a recycled chunk's buffer is already in UAV state
+    m_voxelBuffer.TransitionTo(cmdList, D3D12_RESOURCE_STATE_UNORDERED_ACCESS);
 
     // ===== STEP 5: Bind compute pipeline and root signature =====
     cmdList->SetPipelineState(generationPSO);
@@ -244,4 +372,134 @@ Result<void> Chunk::Generate(
     return {};
 }
 
+void Chunk::SetCPUVoxels(const uint32_t* voxels, uint32_t worldSeed) {
+    int32_t originX, originY, originZ;
+    GetWorldOrigin(originX, originY, originZ);
+
+    // Fresh storage: a snapshot pinning the old voxels keeps them
+    PalettedVoxels encoded;
+    encoded.SetVariantOrigin(originX, originY, originZ, worldSeed);
+    encoded.Initialize(INFINITE_CHUNK_SIZE);
+    encoded.Encode(voxels);
+
+    spdlog::debug("Chunk[{},{},{}] CPU voxels - {} bits/voxel, {} palette entries, {:.1f} KB",
+        m_coord.x, m_coord.y, m_coord.z,
+        encoded.GetBitsPerIndex(), encoded.GetPaletteSize(),
+        encoded.GetResidentBytes() / 1024.0f);
+    m_cpuVoxels.Reset(std::move(encoded));
+}
+
+Result<void> Chunk::UploadCPUVoxels(ID3D12Device* device, ID3D12GraphicsCommandList* cmdList) {
+    if (!device || !cmdList) {
+        return Error("Chunk::UploadCPUVoxels - null parameters");
+    }
+    if (!m_cpuVoxels.IsInitialized()) {
+        return Error("Chunk[{},{},{}] has no CPU voxels to upload", m_coord.x, m_coord.y, m_coord.z);
+    }
+    // The staging buffer holds exactly one chunk
+    if (m_cpuVoxels.Get().GetVoxelCount() != GetVoxelCount()) {
+        return Error("Chunk[{},{},{}] CPU voxels hold {} voxels, expected {}", m_coord.x, m_coord.y, m_coord.z,
+            m_cpuVoxels.Get().GetVoxelCount(), GetVoxelCount());
+    }
+
+    // ===== STEP 1: Create upload heap staging buffer (1 MB) =====
+    if (!m_uploadStaging) {
+        D3D12_HEAP_PROPERTIES uploadHeapProps = CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_UPLOAD);
+        D3D12_RESOURCE_DESC bufferDesc = CD3DX12_RESOURCE_DESC::Buffer(GetBufferSize());
+
+        HRESULT hr = device->CreateCommittedResource(
+            &uploadHeapProps,
+            D3D12_HEAP_FLAG_NONE,
+            &bufferDesc,
+            D3D12_RESOURCE_STATE_GENERIC_READ,
+            nullptr,
+            IID_PPV_ARGS(&m_uploadStaging)
+        );
+
+        if (FAILED(hr)) {
+            return Error("Failed to create upload staging buffer for chunk voxels");
+        }
+    }
+
+    // ===== STEP 2: Decode straight into the mapped staging memory =====
+    void* mappedData = nullptr;
+    D3D12_RANGE readRange = {0, 0};
+    if (FAILED(m_uploadStaging->Map(0, &readRange, &mappedData))) {
+        return Error("Failed to map chunk upload staging buffer");
+    }
+    m_cpuVoxels.Get().Decode(static_cast<uint32_t*>(mappedData));
+    m_uploadStaging->Unmap(0, nullptr);
+
+    // ===== STEP 3: Copy into the GPU voxel buffer =====
+    m_voxelBuffer.TransitionTo(cmdList, D3D12_RESOURCE_STATE_COPY_DEST);
+    cmdList->CopyBufferRegion(m_voxelBuffer.GetResource(), 0, m_uploadStaging.Get(), 0, GetBufferSize());
+    m_voxelBuffer.TransitionTo(cmdList, D3D12_RESOURCE_STATE_UNORDERED_ACCESS);
+
+    m_state = ChunkState::Generated;
+    return {};
+}
+
+Result<void> Chunk::RecordReadback(ID3D12Device* device, ID3D12GraphicsCommandList* cmdList) {
+    if (!device || !cmdList) {
+        return Error("Chunk::RecordReadback - null parameters");
+    }
+    if (m_uniform || !HasVoxelBuffer()) {
+        return Error("Chunk[{},{},{}] has no GPU voxels to read back", m_coord.x, m_coord.y, m_coord.z);
+    }
+
+    // ===== STEP 1: Create readback heap buffer (1 MB) =====
+    if (!m_readback) {
+        D3D12_HEAP_PROPERTIES readbackHeapProps = CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_READBACK);
+        D3D12_RESOURCE_DESC bufferDesc = CD3DX12_RESOURCE_DESC::Buffer(GetBufferSize());
+
+        HRESULT hr = device->CreateCommittedResource(
+            &readbackHeapProps,
+            D3D12_HEAP_FLAG_NONE,
+            &bufferDesc,
+            D3D12_RESOURCE_STATE_COPY_DEST,
+            nullptr,
+            IID_PPV_ARGS(&m_readback)
+        );
+
+        if (FAILED(hr)) {
+            return Error("Failed to create readback buffer for chunk voxels");
+        }
+    }
+
+    // ===== STEP 2: Copy the GPU voxel buffer out =====
+    m_voxelBuffer.TransitionTo(cmdList, D3D12_RESOURCE_STATE_COPY_SOURCE);
+    cmdList->CopyBufferRegion(m_readback.Get(), 0, m_voxelBuffer.GetResource(), 0, GetBufferSize());
+    m_voxelBuffer.TransitionTo(cmdList, D3D12_RESOURCE_STATE_UNORDERED_ACCESS);
+
+    // Writes after the copy must mark the chunk again
+    if (m_state == ChunkState::Dirty) {
+        m_state = ChunkState::Generated;
+    }
+    m_readbackPending = true;
+    return {};
+}
+
+Result<void> Chunk::ResolveReadback(uint32_t worldSeed) {
+    if (!m_readbackPending) {
+        return {};
+    }
+    m_readbackPending = false;
+
+    void* mappedData = nullptr;
+    D3D12_RANGE readRange = {0, static_cast<SIZE_T>(GetBufferSize())};
+    if (FAILED(m_readback->Map(0, &readRange, &mappedData))) {
+        return Error("Failed to map chunk readback buffer");
+    }
+    const uint32_t* voxels = static_cast<const uint32_t*>(mappedData);
+    if (HasCPUVoxels()) {
+        // An edit: a snapshot pinning the old voxels keeps them
+        EditCPUVoxels().Encode(voxels);
+    } else {
+        SetCPUVoxels(voxels, worldSeed);
+    }
+    D3D12_RANGE writeRange = {0, 0};
+    m_readback->Unmap(0, &writeRange);
+    return {};
+}
+
 } // namespace VENPOD::Simulation
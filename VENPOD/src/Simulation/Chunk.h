@@ -2,12 +2,20 @@
 
 // =============================================================================
 // VENPOD Chunk - Individual 64³ voxel region for infinite world
-// Each chunk holds its own voxel buffer and generation state
+// Each loaded chunk's voxels live in a palette-compressed CPU copy (see
+// PalettedVoxels.h), shared copy-on-write with snapshot saves (see
+// ChunkSnapshot.h). A GPU voxel buffer is decoded from it only while the
+// chunk is in the render window, and goes back to the ChunkPool when it leaves.
 // =============================================================================
 
 #include <d3d12.h>
+#include <wrl/client.h>
 #include <cstdint>
+#include <utility>
 #include "ChunkCoord.h"
+#include "ChunkSnapshot.h"
+#include "PalettedVoxels.h"
+#include "TerrainGenerator.h"
 #include "../Graphics/RHI/GPUBuffer.h"
 #include "../Graphics/RHI/DescriptorHeap.h"
 #include "../Utils/Result.h"
@@ -39,7 +47,8 @@ public:
     Chunk(Chunk&& other) noexcept;
     Chunk& operator=(Chunk&& other) noexcept;
 
-    // Initialize chunk (allocate GPU buffer)
+    // Initialize chunk (allocate GPU buffer). A recycled chunk that still owns
+    // its buffer (see ChunkPool) keeps it and only takes the new coordinate.
     Result<void> Initialize(
         ID3D12Device* device,
         Graphics::DescriptorHeapManager& heapManager,
@@ -47,8 +56,31 @@ public:
         const char* debugNamePrefix = "Chunk"
     );
 
+    // Initialize a uniform chunk: every voxel is `voxel` (with the generator's
+    // procedural variants). No GPU buffer or descriptors are allocated; physics,
+    // scanning and raymarching skip the chunk until Materialize() on first write.
+    // A recycled chunk's idle GPU buffer is kept but ignored.
+    void InitializeUniform(const ChunkCoord& coord, uint32_t voxel, uint32_t worldSeed);
+
+    // Allocate the GPU voxel buffer of a uniform chunk and upload its voxels
+    Result<void> Materialize(
+        ID3D12Device* device,
+        ID3D12GraphicsCommandList* cmdList,
+        Graphics::DescriptorHeapManager& heapManager
+    );
+
+    // True when CS_GenerateChunk would fill the whole chunk with one voxel
+    // value (ignoring variants), decided from the global terrain bounds alone:
+    // only sky above the height clamp. CPU generation predicts from each
+    // column's heights (PredictUniformChunk) and encodes the rest.
+    static bool PredictUniform(const ChunkCoord& coord, uint32_t& outVoxel);
+
     void Shutdown();
 
+    // Reset for reuse by another coordinate, keeping the GPU buffer and its
+    // descriptors (content becomes stale until the next Generate/upload)
+    void Recycle();
+
     // Generate chunk using compute shader
     // This dispatches CS_GenerateChunk.hlsl with world offset
     Result<void> Generate(
@@ -59,15 +91,77 @@ public:
         uint32_t worldSeed
     );
 
-    // Mark chunk as needing physics update
+    // ===== CPU-side voxels (palette-compressed) =====
+    // Encode a full 64³ packed voxel array into the CPU copy. Variants that
+    // match CS_GenerateChunk's Random3D(worldPos, worldSeed) cost no palette space.
+    void SetCPUVoxels(const uint32_t* voxels, uint32_t worldSeed);
+    // Adopt voxels already encoded for this chunk (e.g. by AsyncChunkGenerator)
+    void SetCPUVoxels(PalettedVoxels&& voxels) { m_cpuVoxels.Reset(std::move(voxels)); }
+
+    // Decode the CPU copy into a staging buffer and record its copy into the
+    // GPU voxel buffer. The staging buffer is kept until ReleaseUploadStaging()
+    // is called after the command list has executed.
+    Result<void> UploadCPUVoxels(ID3D12Device* device, ID3D12GraphicsCommandList* cmdList);
+    void ReleaseUploadStaging() { m_uploadStaging.Reset(); }
+
+    // ===== GPU readback (brush and physics writes, GPU generation) =====
+    // Record a copy of the GPU voxel buffer into a readback buffer (kept for
+    // the next readback). Leaves the Dirty state: writes recorded after this
+    // one mark the chunk dirty again.
+    Result<void> RecordReadback(ID3D12Device* device, ID3D12GraphicsCommandList* cmdList);
+    // Once that command list has executed: take the voxels into the CPU copy,
+    // through EditCPUVoxels() (an edit, saved at the next checkpoint), or as
+    // the first CPU copy of a chunk generated on the GPU
+    Result<void> ResolveReadback(uint32_t worldSeed);
+    bool IsReadbackPending() const { return m_readbackPending; }
+
+    // The CPU copy holds everything the GPU buffer does: the chunk can be
+    // saved and unloaded without losing a write
+    bool IsCPUVoxelsCurrent() const { return HasCPUVoxels() && m_state != ChunkState::Dirty && !m_readbackPending; }
+
+    // Resident bytes on the GPU (0 unless a buffer is allocated)
+    uint64_t GetGPUResidentBytes() const { return HasVoxelBuffer() ? GetBufferSize() : 0; }
+
+    // ===== Residency (see ChunkPool::ReleaseVoxelBuffer) =====
+    // Move the GPU voxel buffer and its descriptors over from `other`, which
+    // is left without one (and without its readback buffer). No-op when this
+    // chunk already has a buffer.
+    void TakeVoxelBuffer(Chunk& other);
+    // Create a voxel buffer for a loaded chunk that has none (it left the
+    // render window and came back); no-op when it has one. Content is stale
+    // until UploadCPUVoxels.
+    Result<void> AttachVoxelBuffer(ID3D12Device* device, Graphics::DescriptorHeapManager& heapManager);
+
+    bool HasCPUVoxels() const { return m_cpuVoxels.IsInitialized(); }
+    const PalettedVoxels& GetCPUVoxels() const { return m_cpuVoxels.Get(); }
+    // For edits: clones the voxels first while a snapshot save still pins them
+    PalettedVoxels& EditCPUVoxels() { return m_cpuVoxels.Edit(); }
+    // The current version, for a snapshot save
+    std::shared_ptr<const PalettedVoxels> PinCPUVoxels() const { return m_cpuVoxels.Pin(); }
+
+    // Mark chunk as written on the GPU (brush, physics): the CPU copy is
+    // stale until the buffer is read back
     void MarkDirty() { m_state = ChunkState::Dirty; }
 
+    // CPU voxels edited since the chunk's last save (autosave checkpoint or
+    // unload); unlike the Dirty state this survives the physics settling down
+    bool HasUnsavedChanges() const { return m_cpuVoxels.IsModified(); }
+    // Journal the CPU voxels if they have unsaved changes
+    Result<void> SaveCPUVoxels(RegionStore& store) { return m_cpuVoxels.JournalIfModified(store, m_coord); }
+
     // Getters
     const ChunkCoord& GetCoord() const { return m_coord; }
     ChunkState GetState() const { return m_state; }
     bool IsGenerated() const { return m_state == ChunkState::Generated || m_state == ChunkState::Dirty; }
     bool IsDirty() const { return m_state == ChunkState::Dirty; }
 
+    // Uniform chunks have no (valid) voxel buffer, SRV or UAV, and neither do
+    // chunks outside the render window
+    bool HasVoxelBuffer() const { return m_voxelBuffer.GetResource() != nullptr; }
+    bool IsUniform() const { return m_uniform; }
+    // Renderable and simulatable: a voxel buffer holding this chunk
+    bool IsGPUResident() const { return !m_uniform && HasVoxelBuffer(); }
+
     // Get world origin position (in voxel coordinates)
     void GetWorldOrigin(int32_t& outX, int32_t& outY, int32_t& outZ) const {
         m_coord.GetWorldOrigin(outX, outY, outZ, INFINITE_CHUNK_SIZE);
@@ -92,8 +186,17 @@ public:
     }
 
 private:
+    // GPU voxel buffer plus its shader-visible SRV and UAV
+    Result<void> CreateVoxelBuffer(
+        ID3D12Device* device,
+        Graphics::DescriptorHeapManager& heapManager,
+        const char* debugNamePrefix
+    );
+
     ChunkCoord m_coord;                   // Position in chunk grid
     ChunkState m_state = ChunkState::Ungenerated;
+    bool m_uniform = false;               // Single value in m_cpuVoxels, buffer unused
+    bool m_readbackPending = false;       // Recorded into m_readback, not yet resolved
 
     // GPU voxel buffer (64³ voxels = 1 MB)
     Graphics::GPUBuffer m_voxelBuffer;
@@ -103,6 +206,16 @@ private:
     Graphics::DescriptorHandle m_voxelUAV;  // For writing in compute shaders
 
     Graphics::DescriptorHeapManager* m_heapManager = nullptr;
+
+    // CPU copy of the voxels (~1-130 KB), empty until SetCPUVoxels or the
+    // first readback; the resident form, m_voxelBuffer only in the window
+    SharedVoxels m_cpuVoxels;
+
+    // Upload-heap staging for UploadCPUVoxels (alive until the copy has executed)
+    Microsoft::WRL::ComPtr<ID3D12Resource> m_uploadStaging;
+
+    // Readback-heap copy of m_voxelBuffer for RecordReadback / ResolveReadback
+    Microsoft::WRL::ComPtr<ID3D12Resource> m_readback;
 };
 
 } // namespace VENPOD::Simulation
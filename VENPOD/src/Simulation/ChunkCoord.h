@@ -2,7 +2,7 @@
 
 // =============================================================================
 // VENPOD Chunk Coordinate - Identifies chunks in infinite 3D grid
-// Used as hash map key for dynamic chunk loading/unloading
+// Used as hash map key for dynamic chunk loading/unloading (see ChunkCoordMap.h)
 // =============================================================================
 
 #include <cstdint>
@@ -45,14 +45,20 @@ struct ChunkCoord {
         outZ = z * static_cast<int32_t>(chunkSize);
     }
 
-    // Hash function for std::unordered_map
-    // Uses FNV-1a hash algorithm for good distribution
+    // Hash function for ChunkCoordMap and std::unordered_map
+    // Each axis is multiplied by its own odd 64-bit constant (as uint32, so small
+    // negative coordinates don't collapse onto sign-extension bits), then the
+    // murmur3 finalizer spreads every input bit over the low bits used as slots
     size_t Hash() const {
-        size_t hash = 2166136261u;
-        hash = (hash ^ static_cast<size_t>(x)) * 16777619u;
-        hash = (hash ^ static_cast<size_t>(y)) * 16777619u;
-        hash = (hash ^ static_cast<size_t>(z)) * 16777619u;
-        return hash;
+        uint64_t hash = static_cast<uint64_t>(static_cast<uint32_t>(x)) * 0x9E3779B97F4A7C15ull;
+        hash ^= static_cast<uint64_t>(static_cast<uint32_t>(y)) * 0xC2B2AE3D27D4EB4Full;
+        hash ^= static_cast<uint64_t>(static_cast<uint32_t>(z)) * 0x165667B19E3779F9ull;
+        hash ^= hash >> 33;
+        hash *= 0xFF51AFD7ED558CCDull;
+        hash ^= hash >> 33;
+        hash *= 0xC4CEB9FE1A85EC53ull;
+        hash ^= hash >> 33;
+        return static_cast<size_t>(hash);
     }
 
     // Convert world voxel position to chunk coordinate
@@ -0,0 +1,208 @@
+#pragma once
+
+// =============================================================================
+// VENPOD Chunk Coordinate Map - Open-addressing hash map keyed by ChunkCoord
+// Robin Hood linear probing over one flat slot array: a lookup touches a few
+// adjacent slots instead of chasing unordered_map bucket nodes, and backward-
+// shift deletion keeps probe sequences short without tombstones. The table
+// stays at most half full: nearly every lookup resolves in its home slot, so
+// the probe loop's branches stay predictable. Iteration yields
+// { coord, value } entries, so range-for with structured bindings works as it
+// does for std::unordered_map.
+// =============================================================================
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "ChunkCoord.h"
+
+namespace VENPOD::Simulation {
+
+template <typename T>
+class ChunkCoordMap {
+public:
+    struct Entry {
+        ChunkCoord coord;
+        T value{};
+    };
+
+    template <bool Const>
+    class Iterator {
+    public:
+        using MapType = std::conditional_t<Const, const ChunkCoordMap, ChunkCoordMap>;
+        using EntryType = std::conditional_t<Const, const Entry, Entry>;
+
+        Iterator(MapType* map, size_t slot) : m_map(map), m_slot(slot) { SkipEmpty(); }
+
+        EntryType& operator*() const { return m_map->m_slots[m_slot].entry; }
+        EntryType* operator->() const { return &m_map->m_slots[m_slot].entry; }
+        Iterator& operator++() { ++m_slot; SkipEmpty(); return *this; }
+        bool operator==(const Iterator& other) const { return m_slot == other.m_slot; }
+        bool operator!=(const Iterator& other) const { return m_slot != other.m_slot; }
+
+    private:
+        void SkipEmpty() {
+            while (m_slot < m_map->m_slots.size() && m_map->m_slots[m_slot].distance == 0) {
+                ++m_slot;
+            }
+        }
+
+        MapType* m_map;
+        size_t m_slot;
+    };
+
+    ChunkCoordMap() = default;
+
+    // ===== Lookup =====
+    T* Find(const ChunkCoord& coord) {
+        size_t slot = FindSlot(coord);
+        return slot != NOT_FOUND ? &m_slots[slot].entry.value : nullptr;
+    }
+    const T* Find(const ChunkCoord& coord) const {
+        size_t slot = FindSlot(coord);
+        return slot != NOT_FOUND ? &m_slots[slot].entry.value : nullptr;
+    }
+    bool Contains(const ChunkCoord& coord) const { return FindSlot(coord) != NOT_FOUND; }
+
+    // ===== Modification =====
+    // Insert or overwrite; returns true when the coordinate was new
+    bool Insert(const ChunkCoord& coord, T value) {
+        size_t slot = FindSlot(coord);
+        if (slot != NOT_FOUND) {
+            m_slots[slot].entry.value = std::move(value);
+            return false;
+        }
+        if ((m_size + 1) * MAX_LOAD_DEN > m_slots.size() * MAX_LOAD_NUM) {
+            Rehash(m_slots.empty() ? MIN_CAPACITY : m_slots.size() * 2);
+        }
+        InsertNew(Entry{ coord, std::move(value) });
+        ++m_size;
+        return true;
+    }
+
+    // Returns true when the coordinate was present
+    bool Erase(const ChunkCoord& coord) {
+        size_t slot = FindSlot(coord);
+        if (slot == NOT_FOUND) {
+            return false;
+        }
+
+        // Backward shift: pull following displaced entries one slot closer to home
+        size_t next = (slot + 1) & m_mask;
+        while (m_slots[next].distance > 1) {
+            m_slots[slot].entry = std::move(m_slots[next].entry);
+            m_slots[slot].distance = m_slots[next].distance - 1;
+            slot = next;
+            next = (next + 1) & m_mask;
+        }
+        m_slots[slot] = Slot{};
+        --m_size;
+        return true;
+    }
+
+    void Clear() {
+        m_slots.clear();
+        m_mask = 0;
+        m_size = 0;
+    }
+
+    // Pre-size for `count` entries so inserts up to it never rehash
+    void Reserve(size_t count) {
+        size_t capacity = MIN_CAPACITY;
+        while (count * MAX_LOAD_DEN > capacity * MAX_LOAD_NUM) {
+            capacity *= 2;
+        }
+        if (capacity > m_slots.size()) {
+            Rehash(capacity);
+        }
+    }
+
+    size_t Size() const { return m_size; }
+    bool Empty() const { return m_size == 0; }
+    size_t GetCapacity() const { return m_slots.size(); }
+
+    // Longest probe sequence (1 = every entry in its home slot)
+    uint32_t GetMaxProbeLength() const {
+        uint32_t longest = 0;
+        for (const Slot& slot : m_slots) {
+            longest = slot.distance > longest ? slot.distance : longest;
+        }
+        return longest;
+    }
+
+    Iterator<false> begin() { return Iterator<false>(this, 0); }
+    Iterator<false> end() { return Iterator<false>(this, m_slots.size()); }
+    Iterator<true> begin() const { return Iterator<true>(this, 0); }
+    Iterator<true> end() const { return Iterator<true>(this, m_slots.size()); }
+
+private:
+    static constexpr size_t NOT_FOUND = ~size_t(0);
+    static constexpr size_t MIN_CAPACITY = 16;
+    // Grow past 1/2 occupancy
+    static constexpr size_t MAX_LOAD_NUM = 1;
+    static constexpr size_t MAX_LOAD_DEN = 2;
+
+    struct Slot {
+        Entry entry;
+        uint32_t distance = 0;    // 0 = empty, else probe length + 1
+    };
+
+    size_t FindSlot(const ChunkCoord& coord) const {
+        if (m_size == 0) {
+            return NOT_FOUND;
+        }
+        size_t slot = coord.Hash() & m_mask;
+        // Stop at the first slot whose entry sits closer to home than we would
+        for (uint32_t distance = 1; ; ++distance) {
+            const Slot& candidate = m_slots[slot];
+            if (candidate.distance < distance) {
+                return NOT_FOUND;
+            }
+            if (candidate.entry.coord == coord) {
+                return slot;
+            }
+            slot = (slot + 1) & m_mask;
+        }
+    }
+
+    void InsertNew(Entry entry) {
+        size_t slot = entry.coord.Hash() & m_mask;
+        uint32_t distance = 1;
+        while (true) {
+            Slot& candidate = m_slots[slot];
+            if (candidate.distance == 0) {
+                candidate.entry = std::move(entry);
+                candidate.distance = distance;
+                return;
+            }
+            // Robin Hood: take the slot from an entry closer to its home
+            if (candidate.distance < distance) {
+                std::swap(candidate.entry, entry);
+                std::swap(candidate.distance, distance);
+            }
+            slot = (slot + 1) & m_mask;
+            ++distance;
+        }
+    }
+
+    void Rehash(size_t capacity) {
+        std::vector<Slot> oldSlots = std::move(m_slots);
+
+        m_slots.clear();
+        m_slots.resize(capacity);     // Default-constructed: values may be move-only
+        m_mask = capacity - 1;
+        for (Slot& slot : oldSlots) {
+            if (slot.distance != 0) {
+                InsertNew(std::move(slot.entry));
+            }
+        }
+    }
+
+    std::vector<Slot> m_slots;
+    size_t m_mask = 0;
+    size_t m_size = 0;
+};
+
+} // namespace VENPOD::Simulation
@@ -0,0 +1,106 @@
+#pragma once
+
+// =============================================================================
+// VENPOD Chunk Cylinder - The cylindrical chunk region loaded around a camera
+// A circle of radius `horizontal` in XZ (chunk units, squared-distance test
+// like the original loader) extruded ±`vertical` chunks in Y. When the
+// camera moves by a chunk, only the difference between the old and the new
+// cylinder changes: ForEachChunkEntering walks exactly that shell, one XZ row
+// at a time, so streaming cost scales with the boundary (~h·v per step)
+// instead of the whole (2h+1)²·(2v+1) volume.
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include "ChunkCoord.h"
+
+namespace VENPOD::Simulation {
+
+struct ChunkCylinder {
+    int32_t horizontal = 8;     // XZ radius in chunks
+    int32_t vertical = 2;       // ±Y extent in chunks
+
+    bool Contains(const ChunkCoord& center, const ChunkCoord& coord) const {
+        int64_t dx = static_cast<int64_t>(coord.x) - center.x;
+        int64_t dy = static_cast<int64_t>(coord.y) - center.y;
+        int64_t dz = static_cast<int64_t>(coord.z) - center.z;
+        return dx * dx + dz * dz <= static_cast<int64_t>(horizontal) * horizontal &&
+               std::llabs(dy) <= vertical;
+    }
+
+    // Half-width in Z of the row at X offset dx (|dx| <= horizontal)
+    int32_t RowHalfWidth(int64_t dx) const {
+        int64_t remaining = static_cast<int64_t>(horizontal) * horizontal - dx * dx;
+        int32_t width = static_cast<int32_t>(std::sqrt(static_cast<double>(remaining)));
+        // Correct float rounding either way so the row matches Contains exactly
+        while (static_cast<int64_t>(width + 1) * (width + 1) <= remaining) {
+            ++width;
+        }
+        while (static_cast<int64_t>(width) * width > remaining) {
+            --width;
+        }
+        return width;
+    }
+
+    // Chunks in the cylinder around `to` but not in the one around `from`
+    // (from == nullptr: the whole cylinder around `to`). Swap the centres to
+    // get the chunks leaving the cylinder.
+    template <typename Fn>
+    void ForEachChunkEntering(const ChunkCoord* from, const ChunkCoord& to, Fn&& fn) const {
+        // Columns shared with the old cylinder only gain the Y range of `to`
+        // outside the Y range of `from` - at most two runs
+        const int64_t newBottom = static_cast<int64_t>(to.y) - vertical;
+        const int64_t newTop = static_cast<int64_t>(to.y) + vertical;
+        const int64_t oldBottom = from ? static_cast<int64_t>(from->y) - vertical : 0;
+        const int64_t oldTop = from ? static_cast<int64_t>(from->y) + vertical : -1;
+        auto visitColumn = [&](int32_t x, int32_t z, bool insideOldColumn) {
+            if (!insideOldColumn) {
+                for (int64_t y = newBottom; y <= newTop; ++y) {
+                    fn(ChunkCoord{ x, static_cast<int32_t>(y), z });
+                }
+                return;
+            }
+            for (int64_t y = newBottom; y <= std::min(newTop, oldBottom - 1); ++y) {
+                fn(ChunkCoord{ x, static_cast<int32_t>(y), z });
+            }
+            for (int64_t y = std::max(newBottom, oldTop + 1); y <= newTop; ++y) {
+                fn(ChunkCoord{ x, static_cast<int32_t>(y), z });
+            }
+        };
+        const bool sameLayers = from && from->y == to.y;
+
+        for (int32_t dx = -horizontal; dx <= horizontal; ++dx) {
+            const int32_t x = to.x + dx;
+            const int32_t width = RowHalfWidth(dx);
+            int64_t newMin = static_cast<int64_t>(to.z) - width;
+            int64_t newMax = static_cast<int64_t>(to.z) + width;
+
+            // Same row of the old cylinder (empty when out of its X range)
+            int64_t oldMin = 1, oldMax = 0;
+            if (from) {
+                int64_t oldDx = static_cast<int64_t>(x) - from->x;
+                if (std::llabs(oldDx) <= horizontal) {
+                    int32_t oldWidth = RowHalfWidth(oldDx);
+                    oldMin = static_cast<int64_t>(from->z) - oldWidth;
+                    oldMax = static_cast<int64_t>(from->z) + oldWidth;
+                }
+            }
+
+            for (int64_t z = newMin; z <= newMax; ++z) {
+                bool insideOld = z >= oldMin && z <= oldMax;
+                if (insideOld) {
+                    // Whole overlap is unchanged when the layers match: jump over it
+                    if (sameLayers) {
+                        z = oldMax;
+                        continue;
+                    }
+                }
+                visitColumn(x, static_cast<int32_t>(z), insideOld);
+            }
+        }
+    }
+};
+
+} // namespace VENPOD::Simulation
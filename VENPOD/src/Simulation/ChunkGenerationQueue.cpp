@@ -0,0 +1,91 @@
+#include "ChunkGenerationQueue.h"
+#include <algorithm>
+#include <cmath>
+
+namespace VENPOD::Simulation {
+
+void ChunkGenerationQueue::SetView(const ChunkGenerationView& view) {
+    m_view = view;
+
+    // Normalise the direction once; zero keeps plain distance ordering
+    float* f = m_view.forward;
+    float length = std::sqrt(f[0] * f[0] + f[1] * f[1] + f[2] * f[2]);
+    m_hasDirection = length > 1e-6f;
+    for (int axis = 0; axis < 3; ++axis) {
+        f[axis] = m_hasDirection ? f[axis] / length : 0.0f;
+    }
+    m_view.chunkSize = std::max(m_view.chunkSize, 1u);
+
+    for (Item& item : m_heap) {
+        item.priority = ComputePriority(item.coord);
+    }
+    std::make_heap(m_heap.begin(), m_heap.end(), Later);
+}
+
+float ChunkGenerationQueue::ComputePriority(const ChunkCoord& coord) const {
+    // Camera to chunk centre, in chunk units
+    const float invSize = 1.0f / static_cast<float>(m_view.chunkSize);
+    float dx = (static_cast<float>(coord.x) + 0.5f) - m_view.position[0] * invSize;
+    float dy = (static_cast<float>(coord.y) + 0.5f) - m_view.position[1] * invSize;
+    float dz = (static_cast<float>(coord.z) + 0.5f) - m_view.position[2] * invSize;
+    float distance = std::sqrt(dx * dx + dy * dy + dz * dz);
+
+    if (!m_hasDirection || distance <= m_view.nearRadius) {
+        return distance;
+    }
+
+    // Outside the view cone: scale by how far outside it the chunk lies
+    const float* f = m_view.forward;
+    float cosAngle = (dx * f[0] + dy * f[1] + dz * f[2]) / distance;
+    float outside = std::max(0.0f, m_view.viewConeCos - cosAngle);
+    return distance * (1.0f + m_view.viewBias * outside);
+}
+
+bool ChunkGenerationQueue::Push(const ChunkCoord& coord) {
+    if (!m_queued.Insert(coord, 1)) {
+        return false;
+    }
+    m_heap.push_back(Item{ ComputePriority(coord), coord });
+    std::push_heap(m_heap.begin(), m_heap.end(), Later);
+    return true;
+}
+
+bool ChunkGenerationQueue::Pop(ChunkCoord& outCoord) {
+    if (m_heap.empty()) {
+        return false;
+    }
+    std::pop_heap(m_heap.begin(), m_heap.end(), Later);
+    outCoord = m_heap.back().coord;
+    m_heap.pop_back();
+    m_queued.Erase(outCoord);
+    return true;
+}
+
+size_t ChunkGenerationQueue::RemoveIf(const std::function<bool(const ChunkCoord&)>& predicate) {
+    size_t before = m_heap.size();
+    auto kept = std::remove_if(m_heap.begin(), m_heap.end(), [&](const Item& item) {
+        if (predicate(item.coord)) {
+            m_queued.Erase(item.coord);
+            return true;
+        }
+        return false;
+    });
+    m_heap.erase(kept, m_heap.end());
+
+    if (m_heap.size() != before) {
+        std::make_heap(m_heap.begin(), m_heap.end(), Later);
+    }
+    return before - m_heap.size();
+}
+
+void ChunkGenerationQueue::Clear() {
+    m_heap.clear();
+    m_queued.Clear();
+}
+
+void ChunkGenerationQueue::Reserve(size_t count) {
+    m_heap.reserve(count);
+    m_queued.Reserve(count);
+}
+
+} // namespace VENPOD::Simulation
@@ -0,0 +1,73 @@
+#pragma once
+
+// =============================================================================
+// VENPOD Chunk Generation Queue - Chunks waiting for generation, nearest first
+// A binary min-heap keyed by distance from the camera to the chunk centre,
+// scaled up for chunks outside the view cone so what the player looks at is
+// built before what is behind them. Chunks right around the camera are never
+// penalised (turning around must not reveal holes). SetView recomputes every
+// priority and re-heapifies in O(n), cheap enough to run whenever the camera
+// changes chunk or turns noticeably.
+// =============================================================================
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+#include "ChunkCoord.h"
+#include "ChunkCoordMap.h"
+
+namespace VENPOD::Simulation {
+
+struct ChunkGenerationView {
+    float position[3] = { 0.0f, 0.0f, 0.0f };   // Camera, world voxels
+    float forward[3] = { 0.0f, 0.0f, 0.0f };    // View direction; zero = distance only
+    uint32_t chunkSize = 64;
+
+    float viewBias = 1.5f;          // Distance multiplier per unit of cosine outside the cone
+    float viewConeCos = 0.5f;       // cos(half-angle) of the unpenalised cone (~60°)
+    float nearRadius = 1.5f;        // Chunks within this many chunks are distance only
+};
+
+class ChunkGenerationQueue {
+public:
+    ChunkGenerationQueue() = default;
+
+    // Recompute all priorities for a new camera position / direction
+    void SetView(const ChunkGenerationView& view);
+    const ChunkGenerationView& GetView() const { return m_view; }
+
+    // Queue a chunk; returns false when it is already queued
+    bool Push(const ChunkCoord& coord);
+
+    // Take the highest-priority chunk; returns false when empty
+    bool Pop(ChunkCoord& outCoord);
+
+    // Drop queued chunks matching `predicate` (e.g. out of range after a move)
+    size_t RemoveIf(const std::function<bool(const ChunkCoord&)>& predicate);
+
+    bool Contains(const ChunkCoord& coord) const { return m_queued.Contains(coord); }
+    size_t Size() const { return m_heap.size(); }
+    bool Empty() const { return m_heap.empty(); }
+    void Clear();
+    void Reserve(size_t count);
+
+    // Lower = generated sooner
+    float ComputePriority(const ChunkCoord& coord) const;
+
+private:
+    struct Item {
+        float priority;
+        ChunkCoord coord;
+    };
+
+    // Min-heap order for std::*_heap
+    static bool Later(const Item& a, const Item& b) { return a.priority > b.priority; }
+
+    ChunkGenerationView m_view;
+    bool m_hasDirection = false;
+    std::vector<Item> m_heap;
+    ChunkCoordMap<uint8_t> m_queued;
+};
+
+} // namespace VENPOD::Simulation
@@ -10,6 +10,7 @@
 #include <cstdint>
 #include <vector>
 #include <glm/glm.hpp>
+#include "SimulationConstants.h"
 #include "../Graphics/RHI/GPUBuffer.h"
 #include "../Graphics/RHI/DescriptorHeap.h"
 #include "../Utils/Result.h"
@@ -18,9 +19,6 @@ using Microsoft::WRL::ComPtr;
 
 namespace VENPOD::Simulation {
 
-// Chunk size in voxels (must be power of 2)
-static constexpr uint32_t CHUNK_SIZE = 16;
-
 // Per-chunk control data (GPU-side structure)
 // MUST MATCH SharedTypes.hlsli ChunkControl!
 struct alignas(16) ChunkControl {
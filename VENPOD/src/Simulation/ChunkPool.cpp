@@ -0,0 +1,158 @@
+#include "ChunkPool.h"
+#include <spdlog/spdlog.h>
+#include <algorithm>
+
+namespace VENPOD::Simulation {
+
+Result<void> ChunkPool::Initialize(uint32_t capacity) {
+    if (capacity == 0) {
+        return Error("ChunkPool::Initialize - capacity must be > 0");
+    }
+
+    Shutdown();
+
+    m_slots = std::make_unique<Chunk[]>(capacity);
+    m_capacity = capacity;
+    m_slotInUse.assign(capacity, 0);
+
+    // Both free lists can hold every slot, so Release never reallocates
+    m_freeWithBuffer.clear();
+    m_freeWithBuffer.reserve(capacity);
+    m_freeWithoutBuffer.resize(capacity);
+    for (uint32_t i = 0; i < capacity; ++i) {
+        // Reversed so slot 0 is handed out first
+        m_freeWithoutBuffer[i] = capacity - 1 - i;
+    }
+
+    m_stats = {};
+
+    spdlog::info("ChunkPool initialized - {} chunk slots (up to {:.0f} MB of voxel buffers)",
+        capacity, capacity * (Chunk::GetBufferSize() / (1024.0 * 1024.0)));
+    return {};
+}
+
+void ChunkPool::Shutdown() {
+    for (uint32_t i = 0; i < m_capacity; ++i) {
+        m_slots[i].Shutdown();
+    }
+    m_slots.reset();
+    m_capacity = 0;
+    m_freeWithBuffer.clear();
+    m_freeWithoutBuffer.clear();
+    m_slotInUse.clear();
+    FreeRetiredBuffers();
+    m_stats = {};
+}
+
+Chunk* ChunkPool::Acquire(bool wantsVoxelBuffer) {
+    std::vector<uint32_t>* preferred = wantsVoxelBuffer ? &m_freeWithBuffer : &m_freeWithoutBuffer;
+    std::vector<uint32_t>* fallback = wantsVoxelBuffer ? &m_freeWithoutBuffer : &m_freeWithBuffer;
+    std::vector<uint32_t>* source = !preferred->empty() ? preferred : fallback;
+
+    if (source->empty()) {
+        m_stats.exhausted++;
+        return nullptr;
+    }
+
+    uint32_t slot = source->back();
+    source->pop_back();
+    m_slotInUse[slot] = 1;
+
+    m_stats.acquires++;
+    if (wantsVoxelBuffer && source == &m_freeWithBuffer) {
+        m_stats.bufferReuses++;
+    }
+    m_stats.inUse++;
+    m_stats.highWaterMark = std::max(m_stats.highWaterMark, m_stats.inUse);
+    m_stats.idleBuffers = static_cast<uint32_t>(m_freeWithBuffer.size());
+
+    return &m_slots[slot];
+}
+
+void ChunkPool::Release(Chunk* chunk) {
+    if (!chunk || !m_slots || chunk < m_slots.get() || chunk >= m_slots.get() + m_capacity) {
+        spdlog::warn("ChunkPool::Release - chunk not owned by this pool");
+        return;
+    }
+
+    uint32_t slot = static_cast<uint32_t>(chunk - m_slots.get());
+    if (!m_slotInUse[slot]) {
+        spdlog::warn("ChunkPool::Release - slot {} released twice", slot);
+        return;
+    }
+
+    chunk->Recycle();
+    m_slotInUse[slot] = 0;
+    if (chunk->HasVoxelBuffer()) {
+        m_freeWithBuffer.push_back(slot);
+    } else {
+        m_freeWithoutBuffer.push_back(slot);
+    }
+
+    m_stats.inUse--;
+    m_stats.idleBuffers = static_cast<uint32_t>(m_freeWithBuffer.size());
+}
+
+void ChunkPool::ReleaseVoxelBuffer(Chunk* chunk) {
+    if (!chunk || !chunk->HasVoxelBuffer()) {
+        return;
+    }
+    m_stats.bufferReleases++;
+
+    // Idle in a free slot, like the buffer of a released chunk
+    if (!m_freeWithoutBuffer.empty()) {
+        uint32_t slot = m_freeWithoutBuffer.back();
+        m_freeWithoutBuffer.pop_back();
+        m_slots[slot].TakeVoxelBuffer(*chunk);
+        m_freeWithBuffer.push_back(slot);
+        m_stats.idleBuffers = static_cast<uint32_t>(m_freeWithBuffer.size());
+        return;
+    }
+
+    // Every slot is in use: free it once the GPU is done with it
+    m_retiredBuffers.emplace_back();
+    m_retiredBuffers.back().TakeVoxelBuffer(*chunk);
+    m_stats.buffersFreed++;
+}
+
+bool ChunkPool::AcquireVoxelBuffer(Chunk* chunk) {
+    if (!chunk || chunk->HasVoxelBuffer()) {
+        return chunk != nullptr;
+    }
+    if (m_freeWithBuffer.empty()) {
+        return false;
+    }
+
+    uint32_t slot = m_freeWithBuffer.back();
+    m_freeWithBuffer.pop_back();
+    chunk->TakeVoxelBuffer(m_slots[slot]);
+    m_freeWithoutBuffer.push_back(slot);
+
+    m_stats.bufferReuses++;
+    m_stats.idleBuffers = static_cast<uint32_t>(m_freeWithBuffer.size());
+    return true;
+}
+
+void ChunkPool::FreeRetiredBuffers() {
+    for (Chunk& retired : m_retiredBuffers) {
+        retired.Shutdown();
+    }
+    m_retiredBuffers.clear();
+}
+
+uint32_t ChunkPool::CapacityForDistance(int32_t horizontal, int32_t vertical) {
+    horizontal = std::max(horizontal, 0);
+    vertical = std::max(vertical, 0);
+
+    uint32_t columns = 0;
+    for (int32_t dx = -horizontal; dx <= horizontal; ++dx) {
+        for (int32_t dz = -horizontal; dz <= horizontal; ++dz) {
+            if (dx * dx + dz * dz <= horizontal * horizontal) {
+                ++columns;
+            }
+        }
+    }
+    return columns * static_cast<uint32_t>(2 * vertical + 1);
+}
+
+} // namespace VENPOD::Simulation
@@ -0,0 +1,85 @@
+#pragma once
+
+// =============================================================================
+// VENPOD Chunk Pool - Fixed-capacity slab of recycled Chunk objects
+// All Chunk objects are allocated once at Initialize. Released chunks keep
+// their 1 MB GPU voxel buffer and descriptors, so the next chunk that needs
+// one reuses it instead of creating a new committed resource. Acquire and
+// Release are O(1) (free-list stacks) and allocate nothing after Initialize.
+// A loaded chunk leaving the render window hands its buffer back the same
+// way (ReleaseVoxelBuffer) and takes an idle one when it returns.
+// =============================================================================
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "Chunk.h"
+#include "../Utils/Result.h"
+
+namespace VENPOD::Simulation {
+
+struct ChunkPoolStats {
+    uint32_t inUse = 0;             // Chunks currently handed out
+    uint32_t highWaterMark = 0;     // Most chunks handed out at once
+    uint32_t idleBuffers = 0;       // Free slots still holding a GPU voxel buffer
+    uint64_t acquires = 0;
+    uint64_t bufferReuses = 0;      // Acquires that got a recycled GPU buffer
+    uint64_t bufferReleases = 0;    // Buffers handed back by loaded chunks
+    uint64_t buffersFreed = 0;      // Of those, freed for want of a free slot
+    uint64_t exhausted = 0;         // Acquires that failed (pool full)
+};
+
+class ChunkPool {
+public:
+    ChunkPool() = default;
+    ~ChunkPool() = default;
+
+    // Non-copyable (hands out stable Chunk pointers)
+    ChunkPool(const ChunkPool&) = delete;
+    ChunkPool& operator=(const ChunkPool&) = delete;
+
+    Result<void> Initialize(uint32_t capacity);
+    void Shutdown();    // Shuts down every chunk, in use or not
+
+    // Take a free chunk, or nullptr when all `capacity` chunks are in use.
+    // With wantsVoxelBuffer, slots holding a GPU buffer are preferred (the
+    // caller's Chunk::Initialize then reuses it); otherwise slots without one.
+    Chunk* Acquire(bool wantsVoxelBuffer);
+
+    // Return a chunk from Acquire. Its GPU buffer stays with the slot.
+    void Release(Chunk* chunk);
+
+    // Take the GPU voxel buffer of a loaded chunk that keeps only its CPU
+    // voxels. It idles in a free slot for the next chunk that needs one, or
+    // is freed by FreeRetiredBuffers when every slot is in use.
+    void ReleaseVoxelBuffer(Chunk* chunk);
+    // Give a loaded chunk without a buffer an idle one; false when none is
+    // idle (the chunk then creates its own, see Chunk::AttachVoxelBuffer)
+    bool AcquireVoxelBuffer(Chunk* chunk);
+    // Free the buffers ReleaseVoxelBuffer could not keep. Call once the
+    // command lists recorded before their release have finished executing.
+    void FreeRetiredBuffers();
+
+    // Chunks a cylinder of ±horizontal (circular in X/Z) × ±vertical can hold,
+    // matching InfiniteChunkManager's loading pattern
+    static uint32_t CapacityForDistance(int32_t horizontal, int32_t vertical);
+
+    uint32_t GetCapacity() const { return m_capacity; }
+    const ChunkPoolStats& GetStats() const { return m_stats; }
+
+private:
+    std::unique_ptr<Chunk[]> m_slots;
+    uint32_t m_capacity = 0;
+
+    // Free slot indices, split by whether the slot still owns a voxel buffer
+    std::vector<uint32_t> m_freeWithBuffer;
+    std::vector<uint32_t> m_freeWithoutBuffer;
+    std::vector<uint8_t> m_slotInUse;
+
+    // Buffers released with no free slot to idle in, awaiting FreeRetiredBuffers
+    std::vector<Chunk> m_retiredBuffers;
+
+    ChunkPoolStats m_stats;
+};
+
+} // namespace VENPOD::Simulation
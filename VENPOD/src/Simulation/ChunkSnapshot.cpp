@@ -0,0 +1,115 @@
+#include "ChunkSnapshot.h"
+#include <spdlog/spdlog.h>
+
+namespace VENPOD::Simulation {
+
+// =============================================================================
+// SharedVoxels
+// =============================================================================
+
+const PalettedVoxels& SharedVoxels::Get() const {
+    static const PalettedVoxels empty;
+    return m_voxels ? *m_voxels : empty;
+}
+
+PalettedVoxels& SharedVoxels::Edit() {
+    m_modified = true;
+    if (!m_voxels) {
+        m_voxels = std::make_shared<PalettedVoxels>();
+    } else if (m_voxels.use_count() > 1) {
+        // Pinned: the snapshot keeps the old version, we write a private copy.
+        // A stale count only costs a needless clone (pins are never added
+        // from other threads).
+        m_voxels = std::make_shared<PalettedVoxels>(m_voxels->Clone());
+    } else {
+        // Sole owner - the saver's last read happens before our writes
+        std::atomic_thread_fence(std::memory_order_acquire);
+    }
+    return *m_voxels;
+}
+
+Result<void> SharedVoxels::JournalIfModified(RegionStore& store, const ChunkCoord& coord) {
+    if (!m_modified || !IsInitialized()) {
+        return {};
+    }
+    auto result = store.JournalChunk(coord, *m_voxels);
+    if (!result) {
+        return result;
+    }
+    m_modified = false;
+    return {};
+}
+
+// =============================================================================
+// SnapshotSaver
+// =============================================================================
+
+SnapshotSaver::~SnapshotSaver() {
+    if (IsActive()) {
+        auto result = Wait();
+        if (!result) {
+            spdlog::warn("SnapshotSaver - {}", result.error());
+        }
+    }
+}
+
+Result<void> SnapshotSaver::Start(std::vector<PinnedChunk>&& chunks, const std::filesystem::path& directory,
+                                  ChunkBlobCodec codec) {
+    if (IsActive()) {
+        return Error("SnapshotSaver::Start - a snapshot save is already running");
+    }
+
+    m_chunks = std::move(chunks);
+    m_directory = directory;
+    m_codec = codec;
+    m_saved.store(0, std::memory_order_relaxed);
+    m_finished.store(false, std::memory_order_relaxed);
+    m_error.clear();
+    m_thread = std::thread(&SnapshotSaver::Run, this);
+    return {};
+}
+
+Result<void> SnapshotSaver::Wait() {
+    if (!IsActive()) {
+        return {};
+    }
+    m_thread.join();
+    m_chunks.clear();
+    if (!m_error.empty()) {
+        return Error("{}", m_error);
+    }
+    return {};
+}
+
+void SnapshotSaver::Run() {
+    RegionStore store;
+    auto result = store.Open(m_directory);
+    if (result) {
+        store.SetCodec(m_codec);
+        for (PinnedChunk& chunk : m_chunks) {
+            if (chunk.voxels && chunk.voxels->IsInitialized()) {
+                result = store.SaveChunk(chunk.coord, *chunk.voxels);
+                if (!result) {
+                    break;
+                }
+            }
+            // Unpin at once: later edits of this chunk no longer clone
+            chunk.voxels.reset();
+            m_saved.fetch_add(1, std::memory_order_relaxed);
+        }
+        if (result) {
+            result = store.Flush();
+        }
+        store.Close();
+    }
+
+    if (!result) {
+        m_error = result.error();
+    } else {
+        spdlog::info("SnapshotSaver - saved {} chunks to {}", m_saved.load(std::memory_order_relaxed),
+            m_directory.string());
+    }
+    m_finished.store(true, std::memory_order_release);
+}
+
+} // namespace VENPOD::Simulation
@@ -0,0 +1,115 @@
+#pragma once
+
+// =============================================================================
+// VENPOD Chunk Snapshot - Non-blocking world saves through copy-on-write voxels
+// Serialising every loaded chunk on the frame thread stalls the simulation
+// for as long as the save takes. Instead, chunk CPU voxels live behind a
+// SharedVoxels handle: taking a snapshot only copies one shared pointer per
+// chunk (the pinned version), and a SnapshotSaver writes the pinned versions
+// to region files on its own thread while the frame loop carries on.
+//
+// The first edit of a chunk that is still pinned clones its voxels (Edit());
+// later edits, and every chunk left alone, cost nothing extra. The saver drops
+// each pin as soon as the chunk is written, so the extra memory is bounded by
+// the chunks edited during the save and shrinks as the save advances.
+// =============================================================================
+
+#include <atomic>
+#include <cstddef>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include "ChunkCoord.h"
+#include "PalettedVoxels.h"
+#include "RegionStore.h"
+#include "../Utils/Result.h"
+
+namespace VENPOD::Simulation {
+
+// Copy-on-write handle to one chunk's CPU voxels, and whether they were
+// edited since the chunk was last saved (owner thread only; pins may be held
+// and released on other threads)
+class SharedVoxels {
+public:
+    bool IsInitialized() const { return m_voxels && m_voxels->IsInitialized(); }
+
+    // Read access (empty storage when none is held)
+    const PalettedVoxels& Get() const;
+    // Write access: clones the voxels first if a snapshot still pins them.
+    // Counts as an edit: the voxels are modified until the next save.
+    PalettedVoxels& Edit();
+
+    // Replace the voxels (a pinned old version stays with its snapshot);
+    // generated or loaded voxels have nothing to save
+    void Reset(PalettedVoxels&& voxels) {
+        m_voxels = std::make_shared<PalettedVoxels>(std::move(voxels));
+        m_modified = false;
+    }
+    void Reset() {
+        m_voxels.reset();
+        m_modified = false;
+    }
+
+    // Edited since the last JournalIfModified
+    bool IsModified() const { return m_modified; }
+    // Append the current version to `store`'s journal when modified; stays
+    // modified (retried at the next save) when the write fails
+    Result<void> JournalIfModified(RegionStore& store, const ChunkCoord& coord);
+
+    // The current version, immutable for as long as the pin is held
+    std::shared_ptr<const PalettedVoxels> Pin() const { return m_voxels; }
+    // Pinned by a snapshot: the next Edit() clones
+    bool IsShared() const { return m_voxels && m_voxels.use_count() > 1; }
+
+private:
+    std::shared_ptr<PalettedVoxels> m_voxels;
+    bool m_modified = false;
+};
+
+// One chunk's pinned voxels
+struct PinnedChunk {
+    ChunkCoord coord;
+    std::shared_ptr<const PalettedVoxels> voxels;
+};
+
+// Writes pinned chunk versions to a directory of region files on a background thread
+class SnapshotSaver {
+public:
+    SnapshotSaver() = default;
+    ~SnapshotSaver();
+
+    // Non-copyable
+    SnapshotSaver(const SnapshotSaver&) = delete;
+    SnapshotSaver& operator=(const SnapshotSaver&) = delete;
+
+    // Start saving `chunks` into `directory` (created if missing; chunks
+    // already there are overwritten). No other RegionStore may have the
+    // directory open meanwhile. Fails while a save is running.
+    Result<void> Start(std::vector<PinnedChunk>&& chunks, const std::filesystem::path& directory,
+                       ChunkBlobCodec codec = ChunkBlobCodec::PalettedLZ);
+
+    // Started and not yet waited for
+    bool IsActive() const { return m_thread.joinable(); }
+    // Every chunk written (or the save failed); Wait() will not block
+    bool IsFinished() const { return m_finished.load(std::memory_order_acquire); }
+    // Block until the save ends; its outcome
+    Result<void> Wait();
+
+    size_t GetChunkCount() const { return m_chunks.size(); }
+    size_t GetSavedCount() const { return m_saved.load(std::memory_order_relaxed); }
+
+private:
+    void Run();
+
+    std::thread m_thread;
+    std::vector<PinnedChunk> m_chunks;      // Pins released by the worker once written
+    std::filesystem::path m_directory;
+    ChunkBlobCodec m_codec = ChunkBlobCodec::PalettedLZ;
+    std::atomic<size_t> m_saved{0};
+    std::atomic<bool> m_finished{false};
+    std::string m_error;                    // Written by the worker, read after join
+};
+
+} // namespace VENPOD::Simulation
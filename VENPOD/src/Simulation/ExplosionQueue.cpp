@@ -0,0 +1,208 @@
+#include "ExplosionQueue.h"
+#include "CPUPhysicsKernel.h"
+#include "../Utils/BitPacking.h"
+#include "../Utils/MortonCode.h"
+#include <algorithm>
+
+namespace VENPOD::Simulation {
+
+using namespace VENPOD::Utils;
+
+namespace {
+
+// Per-voxel blast class in a tile mask (higher wins when blasts overlap)
+constexpr uint8_t kBlastNone = 0;
+constexpr uint8_t kBlastClear = 1;
+constexpr uint8_t kBlastFire = 2;
+
+// floor(sqrt(value)), or -1 for negative values (row outside the sphere)
+int32_t IntegerSqrt(int32_t value) {
+    if (value < 0) {
+        return -1;
+    }
+    int32_t root = 0;
+    while ((root + 1) * (root + 1) <= value) {
+        ++root;
+    }
+    return root;
+}
+
+// Cells with d² at most this keep EXPLOSION_FIRE_ENERGY or more:
+// energy * (r² - d²) >= EXPLOSION_FIRE_ENERGY * r². Negative = no fire.
+int32_t FireRadiusSq(const ExplosionEvent& event) {
+    if (event.energy == 0) {
+        return -1;
+    }
+    int32_t radiusSq = static_cast<int32_t>(event.radius) * event.radius;
+    int32_t loss = (EXPLOSION_FIRE_ENERGY * radiusSq + event.energy - 1) / event.energy;
+    return radiusSq - loss;
+}
+
+} // namespace
+
+void ExplosionQueue::Initialize(uint32_t gridSizeX, uint32_t gridSizeY, uint32_t gridSizeZ, uint32_t workerCount) {
+    m_gridSizeX = gridSizeX;
+    m_gridSizeY = gridSizeY;
+    m_gridSizeZ = gridSizeZ;
+    m_chunkCountX = (gridSizeX + CHUNK_SIZE - 1) / CHUNK_SIZE;
+    m_chunkCountY = (gridSizeY + CHUNK_SIZE - 1) / CHUNK_SIZE;
+    m_chunkCountZ = (gridSizeZ + CHUNK_SIZE - 1) / CHUNK_SIZE;
+
+    m_workerEvents.assign(workerCount, {});
+    m_workerMasks.assign(workerCount, std::vector<uint8_t>(CHUNK_VOXEL_COUNT, kBlastNone));
+    m_events.clear();
+}
+
+void ExplosionQueue::Shutdown() {
+    m_workerEvents.clear();
+    m_workerMasks.clear();
+    m_events.clear();
+    m_tileEventPairs.clear();
+    m_tileEvents.clear();
+    m_tiles.clear();
+}
+
+uint32_t ExplosionQueue::Resolve() {
+    m_events.clear();
+    for (auto& workerEvents : m_workerEvents) {
+        m_events.insert(m_events.end(), workerEvents.begin(), workerEvents.end());
+        workerEvents.clear();
+    }
+
+    m_tiles.clear();
+    if (m_events.empty()) {
+        return 0;
+    }
+
+    // Bucket events by every chunk their sphere's bounds touch
+    auto chunkRange = [](int32_t center, int32_t radius, uint32_t gridSize, uint32_t& first, uint32_t& last) {
+        int32_t lo = std::max(center - radius, 0);
+        int32_t hi = std::min(center + radius, static_cast<int32_t>(gridSize) - 1);
+        if (lo > hi) {
+            return false;
+        }
+        first = static_cast<uint32_t>(lo) / CHUNK_SIZE;
+        last = static_cast<uint32_t>(hi) / CHUNK_SIZE;
+        return true;
+    };
+
+    m_tileEventPairs.clear();
+    for (uint32_t eventIndex = 0; eventIndex < m_events.size(); ++eventIndex) {
+        const ExplosionEvent& event = m_events[eventIndex];
+        uint32_t cx0, cx1, cy0, cy1, cz0, cz1;
+        if (!chunkRange(event.x, event.radius, m_gridSizeX, cx0, cx1) ||
+            !chunkRange(event.y, event.radius, m_gridSizeY, cy0, cy1) ||
+            !chunkRange(event.z, event.radius, m_gridSizeZ, cz0, cz1)) {
+            continue;
+        }
+        for (uint32_t cz = cz0; cz <= cz1; ++cz) {
+            for (uint32_t cy = cy0; cy <= cy1; ++cy) {
+                for (uint32_t cx = cx0; cx <= cx1; ++cx) {
+                    uint64_t chunkIndex = (cz * m_chunkCountY + cy) * m_chunkCountX + cx;
+                    m_tileEventPairs.push_back((chunkIndex << 32) | eventIndex);
+                }
+            }
+        }
+    }
+    std::sort(m_tileEventPairs.begin(), m_tileEventPairs.end());
+
+    m_tileEvents.resize(m_tileEventPairs.size());
+    for (uint32_t i = 0; i < m_tileEventPairs.size(); ++i) {
+        uint32_t chunkIndex = static_cast<uint32_t>(m_tileEventPairs[i] >> 32);
+        m_tileEvents[i] = static_cast<uint32_t>(m_tileEventPairs[i] & 0xFFFFFFFFu);
+        if (m_tiles.empty() || m_tiles.back().chunkIndex != chunkIndex) {
+            m_tiles.push_back({ chunkIndex, i, i });
+        }
+        m_tiles.back().end = i + 1;
+    }
+
+    return static_cast<uint32_t>(m_tiles.size());
+}
+
+void ExplosionQueue::ApplyTile(const CPUPhysicsContext& ctx, uint32_t tile, uint32_t worker, CPUPhysicsStats& stats) {
+    const TileRange& range = m_tiles[tile];
+    uint32_t cx = range.chunkIndex % m_chunkCountX;
+    uint32_t cy = (range.chunkIndex / m_chunkCountX) % m_chunkCountY;
+    uint32_t cz = range.chunkIndex / (m_chunkCountX * m_chunkCountY);
+
+    int32_t baseX = static_cast<int32_t>(cx * CHUNK_SIZE);
+    int32_t baseY = static_cast<int32_t>(cy * CHUNK_SIZE);
+    int32_t baseZ = static_cast<int32_t>(cz * CHUNK_SIZE);
+    int32_t endX = std::min(baseX + static_cast<int32_t>(CHUNK_SIZE), static_cast<int32_t>(m_gridSizeX));
+    int32_t endY = std::min(baseY + static_cast<int32_t>(CHUNK_SIZE), static_cast<int32_t>(m_gridSizeY));
+    int32_t endZ = std::min(baseZ + static_cast<int32_t>(CHUNK_SIZE), static_cast<int32_t>(m_gridSizeZ));
+
+    auto maskIndex = [&](int32_t x, int32_t y, int32_t z) {
+        return static_cast<uint32_t>((x - baseX) + ((y - baseY) + (z - baseZ) * static_cast<int32_t>(CHUNK_SIZE)) *
+                                     static_cast<int32_t>(CHUNK_SIZE));
+    };
+
+    // ===== STEP 1: Stamp every blast into the tile mask (cheap byte writes) =====
+    std::vector<uint8_t>& mask = m_workerMasks[worker];
+    std::fill(mask.begin(), mask.end(), kBlastNone);
+
+    for (uint32_t i = range.begin; i < range.end; ++i) {
+        const ExplosionEvent& event = m_events[m_tileEvents[i]];
+        int32_t r = event.radius;
+        int32_t fireRadiusSq = FireRadiusSq(event);
+
+        // The sphere is stamped as one X span per (y, z) row
+        for (int32_t z = std::max(event.z - r, baseZ); z <= std::min(event.z + r, endZ - 1); ++z) {
+            for (int32_t y = std::max(event.y - r, baseY); y <= std::min(event.y + r, endY - 1); ++y) {
+                int32_t rowDistSq = (y - event.y) * (y - event.y) + (z - event.z) * (z - event.z);
+                int32_t halfWidth = IntegerSqrt(r * r - rowDistSq);
+                int32_t fireHalfWidth = IntegerSqrt(fireRadiusSq - rowDistSq);
+                if (halfWidth < 0) {
+                    continue;
+                }
+
+                uint8_t* row = &mask[maskIndex(baseX, y, z)] - baseX;
+                for (int32_t x = std::max(event.x - halfWidth, baseX); x <= std::min(event.x + halfWidth, endX - 1); ++x) {
+                    row[x] = std::max(row[x], kBlastClear);
+                }
+                for (int32_t x = std::max(event.x - fireHalfWidth, baseX); x <= std::min(event.x + fireHalfWidth, endX - 1); ++x) {
+                    row[x] = kBlastFire;
+                }
+            }
+        }
+    }
+
+    // ===== STEP 2: Write each affected voxel once =====
+    const uint32_t fireVoxel = PackVoxel(Material::Fire, 0, 0, EXPLOSION_FIRE_LIFE);
+    const uint32_t airVoxel = PackVoxel(Material::Air, 0, 0, 0);
+
+    for (int32_t z = baseZ; z < endZ; ++z) {
+        for (int32_t y = baseY; y < endY; ++y) {
+            for (int32_t x = baseX; x < endX; ++x) {
+                uint8_t blast = mask[maskIndex(x, y, z)];
+                if (blast == kBlastNone) {
+                    continue;
+                }
+
+                uint32_t index = LinearIndex3D(static_cast<uint32_t>(x), static_cast<uint32_t>(y),
+                                               static_cast<uint32_t>(z), ctx.gridSizeX, ctx.gridSizeY);
+                uint8_t readMaterial = UnpackMaterial(ctx.voxelsIn[index]);
+                if (readMaterial == Material::Bedrock) {
+                    continue;
+                }
+
+                uint32_t voxel = blast == kBlastFire ? fireVoxel : airVoxel;
+                uint32_t previous = ctx.voxelsOut[index];
+                stats.reactionMassDelta += static_cast<int64_t>(UnpackMaterial(voxel) != Material::Air) -
+                                           static_cast<int64_t>(UnpackMaterial(previous) != Material::Air);
+                ctx.voxelsOut[index] = voxel;
+                ++stats.voxelsExploded;
+
+                if (voxel != ctx.voxelsIn[index]) {
+                    MarkVoxelChanged(ctx, static_cast<uint32_t>(x), static_cast<uint32_t>(y), static_cast<uint32_t>(z));
+                }
+                // Fire counts as solid for the liquid surface scan, so only air -> air is a no-op
+                if (readMaterial != Material::Air || voxel != airVoxel) {
+                    MarkLiquidColumnDirty(ctx, static_cast<uint32_t>(x), static_cast<uint32_t>(z));
+                }
+            }
+        }
+    }
+}
+
+} // namespace VENPOD::Simulation
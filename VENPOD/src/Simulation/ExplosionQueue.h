@@ -0,0 +1,90 @@
+#pragma once
+
+// =============================================================================
+// VENPOD Explosion Queue - Deferred blast application for the CPU simulation
+// Detonating gunpowder no longer rewrites its radius-5 sphere in place (which
+// in a gunpowder field rewrote the same few hundred voxels once per
+// detonating neighbour). The kernels only record an ExplosionEvent; after
+// the chunk passes, the queue buckets the blasts by the chunks they touch and
+// writes every affected voxel exactly once, however many blasts cover it.
+// Each voxel detonates at most once per tick, so every event has its own centre.
+//
+// Blast rule: a blast's energy falls off with distance as energy * (1 - d²/r²).
+// Cells where at least EXPLOSION_FIRE_ENERGY is left become short-lived fire
+// (for chain reactions), the rest of the sphere is cleared, bedrock is
+// untouched. Where blasts overlap, fire wins. The default energy gives fire
+// within 3 voxels of a radius-5 centre, the same as CS_GravityChunk.
+// =============================================================================
+
+#include <cstdint>
+#include <vector>
+#include "SimulationConstants.h"
+
+namespace VENPOD::Simulation {
+
+struct CPUPhysicsContext;
+struct CPUPhysicsStats;
+
+static constexpr uint16_t EXPLOSION_RADIUS = 5;
+static constexpr uint16_t EXPLOSION_ENERGY = 25;
+static constexpr uint16_t EXPLOSION_FIRE_ENERGY = 16;
+static constexpr uint8_t EXPLOSION_FIRE_LIFE = 3;
+
+struct ExplosionEvent {
+    int32_t x = 0;
+    int32_t y = 0;
+    int32_t z = 0;
+    uint16_t radius = EXPLOSION_RADIUS;
+    uint16_t energy = EXPLOSION_ENERGY;     // At the centre, falls off to 0 at the radius
+};
+
+class ExplosionQueue {
+public:
+    ExplosionQueue() = default;
+    ~ExplosionQueue() = default;
+
+    // Non-copyable
+    ExplosionQueue(const ExplosionQueue&) = delete;
+    ExplosionQueue& operator=(const ExplosionQueue&) = delete;
+
+    void Initialize(uint32_t gridSizeX, uint32_t gridSizeY, uint32_t gridSizeZ, uint32_t workerCount);
+    void Shutdown();
+
+    // Per-worker event list the kernels append to during the chunk passes
+    std::vector<ExplosionEvent>& GetWorkerEvents(uint32_t worker) { return m_workerEvents[worker]; }
+
+    // Gather the worker lists and bucket the events by affected chunk.
+    // Clears the worker lists. Returns the tile count.
+    uint32_t Resolve();
+
+    // Apply every blast touching tile `tile` (one chunk), writing each voxel
+    // at most once. Tiles are disjoint, so different tiles may run concurrently.
+    void ApplyTile(const CPUPhysicsContext& ctx, uint32_t tile, uint32_t worker, CPUPhysicsStats& stats);
+
+    uint32_t GetDetonationCount() const { return static_cast<uint32_t>(m_events.size()); }
+
+private:
+    struct TileRange {
+        uint32_t chunkIndex;
+        uint32_t begin;     // Range into m_tileEvents
+        uint32_t end;
+    };
+
+    uint32_t m_gridSizeX = 0;
+    uint32_t m_gridSizeY = 0;
+    uint32_t m_gridSizeZ = 0;
+    uint32_t m_chunkCountX = 0;
+    uint32_t m_chunkCountY = 0;
+    uint32_t m_chunkCountZ = 0;
+
+    std::vector<std::vector<ExplosionEvent>> m_workerEvents;
+    std::vector<ExplosionEvent> m_events;             // Events of this tick
+
+    std::vector<uint64_t> m_tileEventPairs;           // (chunkIndex << 32) | eventIndex, sorted
+    std::vector<uint32_t> m_tileEvents;               // Event indices grouped by tile
+    std::vector<TileRange> m_tiles;
+
+    std::vector<std::vector<uint8_t>> m_workerMasks;  // CHUNK_VOXEL_COUNT blast classes per worker
+};
+
+} // namespace VENPOD::Simulation
@@ -4,7 +4,6 @@
 #include "../Graphics/RHI/DX12ComputePipeline.h"
 #include <spdlog/spdlog.h>
 #include <algorithm>
-#include <unordered_set>
 
 namespace VENPOD::Simulation {
 
@@ -27,6 +26,35 @@ Result<void> InfiniteChunkManager::Initialize(
         return Error("Failed to create generation pipeline: {}", result.error());
     }
 
+    // Every chunk that can be loaded at once (loaded chunks live until they
+    // leave the unload cylinder) gets a pool slot up front
+    uint32_t poolCapacity = ChunkPool::CapacityForDistance(
+        std::max(m_config.renderDistanceHorizontal, m_config.unloadDistanceHorizontal),
+        std::max(m_config.renderDistanceVertical, m_config.unloadDistanceVertical));
+    result = m_chunkPool.Initialize(poolCapacity);
+    if (!result) {
+        return Error("Failed to create chunk pool: {}", result.error());
+    }
+    m_loadedChunks.Reserve(poolCapacity);
+    m_generationQueue.Reserve(poolCapacity);
+    m_unloadScratch.reserve(poolCapacity);
+
+    // CPU generation: TerrainGenerator on worker threads instead of dispatches
+    if (m_config.cpuGeneration) {
+        m_cpuGenerator.Initialize(m_config.cpuGenerationWorkers, m_config.worldSeed, INFINITE_CHUNK_SIZE, true,
+            m_config.cpuCaveLattice);
+    }
+
+    // Persistence: saved chunks load instead of generating
+    if (!m_config.worldSavePath.empty()) {
+        result = m_regionStore.Open(m_config.worldSavePath);
+        if (!result) {
+            return Error("Failed to open world save: {}", result.error());
+        }
+        m_regionStore.SetCodec(m_config.worldSaveCodec);
+        m_lastAutosave = std::chrono::steady_clock::now();
+    }
+
     spdlog::info("InfiniteChunkManager initialized - render distance: {}×{} (horiz×vert), seed: {}",
         m_config.renderDistanceHorizontal,
         m_config.renderDistanceVertical,
@@ -36,20 +64,41 @@ Result<void> InfiniteChunkManager::Initialize(
 }
 
 void InfiniteChunkManager::Shutdown() {
-    // Free all loaded chunks
-    for (auto& [coord, chunk] : m_loadedChunks) {
-        if (chunk) {
-            chunk->Shutdown();
-            delete chunk;
-        }
+    // Stop the generation workers before their results' chunks go away
+    m_cpuGenerator.Shutdown();
+    m_cpuCompleted.clear();
+    m_stagedChunks.clear();
+
+    // GPU writes not read back by now are not saved
+    m_modifiedChunks.clear();
+    m_readbackChunks.clear();
+    m_deferredEvictions.clear();
+
+    // A snapshot save holds its own pins; let it finish writing them
+    auto snapshotResult = FinishSnapshotSave();
+    if (!snapshotResult) {
+        spdlog::warn("Snapshot save failed: {}", snapshotResult.error());
     }
-    m_loadedChunks.clear();
 
-    // Clear generation queue
-    while (!m_generationQueue.empty()) {
-        m_generationQueue.pop();
+    // Keep what was modified before the chunks go away
+    if (m_regionStore.IsOpen()) {
+        auto result = SaveModifiedChunks();
+        if (!result) {
+            spdlog::warn("Failed to save modified chunks: {}", result.error());
+        }
+        m_regionStore.Close();
     }
 
+    // Free all loaded chunks (the pool owns and shuts down every slot)
+    m_loadedChunks.Clear();
+    m_chunkPool.Shutdown();
+
+    // Clear generation queue; the next Update starts from a full scan
+    m_generationQueue.Clear();
+    m_lastCameraChunk = ChunkCoord{INT32_MAX, INT32_MAX, INT32_MAX};
+    m_fullRescanPending = true;
+    m_strayChunksLoaded = false;
+
     m_generationPSO.Reset();
     m_generationRootSignature.Reset();
 
@@ -62,12 +111,19 @@ void InfiniteChunkManager::Shutdown() {
 void InfiniteChunkManager::Update(
     ID3D12Device* device,
     ID3D12GraphicsCommandList* cmdList,
-    const glm::vec3& cameraWorldPos)
+    const glm::vec3& cameraWorldPos,
+    const glm::vec3& cameraForward)
 {
     if (!device || !cmdList || !m_heapManager) {
         return;
     }
 
+    // Autosave and journal compaction run whether or not the camera moved,
+    // and so do readbacks of GPU writes and the evictions waiting for them
+    UpdatePersistence();
+    RecordChunkReadbacks(device, cmdList);
+    RetryDeferredEvictions();
+
     // ===== STEP 1: Calculate camera's chunk coordinate =====
     ChunkCoord cameraChunk = ChunkCoord::FromWorldPosition(
         static_cast<int32_t>(cameraWorldPos.x),
@@ -76,51 +132,138 @@ void InfiniteChunkManager::Update(
         INFINITE_CHUNK_SIZE
     );
 
-    // Only update if camera moved to different chunk (avoid redundant work)
-    if (cameraChunk == m_lastCameraChunk) {
+    // Re-prioritise the queue when the camera changes chunk or turns noticeably
+    // (forward of any length; no turn test without one)
+    float forwardLength = glm::length(cameraForward);
+    glm::vec3 forward = forwardLength > 0.0f ? cameraForward / forwardLength : glm::vec3(0.0f);
+    bool movedChunk = cameraChunk != m_lastCameraChunk;
+    bool turned = forwardLength > 0.0f && glm::dot(forward, m_lastViewForward) < VIEW_REPRIORITIZE_COS;
+    if (movedChunk || turned) {
+        ChunkGenerationView view;
+        view.position[0] = cameraWorldPos.x;
+        view.position[1] = cameraWorldPos.y;
+        view.position[2] = cameraWorldPos.z;
+        view.forward[0] = forward.x;
+        view.forward[1] = forward.y;
+        view.forward[2] = forward.z;
+        view.chunkSize = INFINITE_CHUNK_SIZE;
+        view.viewBias = m_config.generationViewBias;
+        view.viewConeCos = m_config.generationViewConeCos;
+        m_generationQueue.SetView(view);
+
+        m_lastViewForward = forward;
+    }
+
+    // Only re-queue / unload if camera moved to different chunk (avoid redundant work)
+    if (!movedChunk && !m_fullRescanPending) {
         // Still generate queued chunks even if camera hasn't moved
-        if (!m_generationQueue.empty()) {
-            GenerateNextChunk(device, cmdList);
-        }
+        PumpGeneration(device, cmdList);
         return;
     }
 
+    // Stream only the shells between the previous and the new cylinder, unless
+    // there is no valid previous state (first frame, render distance changed)
+    const ChunkCoord previousChunk = m_lastCameraChunk;
+    const ChunkCoord* previous = m_fullRescanPending ? nullptr : &previousChunk;
+    m_fullRescanPending = false;
     m_lastCameraChunk = cameraChunk;
 
     spdlog::debug("Camera chunk: [{},{},{}] - world pos: ({:.1f},{:.1f},{:.1f})",
         cameraChunk.x, cameraChunk.y, cameraChunk.z,
         cameraWorldPos.x, cameraWorldPos.y, cameraWorldPos.z);
 
-    // ===== STEP 2: Queue chunks within cylindrical render distance =====
-    auto queueResult = QueueChunksAroundCamera(cameraChunk);
+    // ===== STEP 2: Queue chunks entering the cylindrical render distance =====
+    auto queueResult = QueueChunksAroundCamera(cameraChunk, previous);
     if (!queueResult) {
         spdlog::warn("Failed to queue chunks: {}", queueResult.error());
     }
 
-    // ===== STEP 3: Generate N chunks per frame (avoid lag) =====
-    for (uint32_t i = 0; i < m_config.chunksPerFrame; ++i) {
-        if (m_generationQueue.empty()) {
-            break;
+    // ===== STEP 3: Generate N chunks per frame (avoid lag), nearest / in view first =====
+    PumpGeneration(device, cmdList);
+
+    // ===== STEP 4: Unload chunks leaving the unload distance, release buffers leaving the render distance =====
+    UnloadDistantChunks(cameraChunk, previous);
+
+    // Resident bytes walk every loaded chunk - only when they are printed
+    if (spdlog::should_log(spdlog::level::debug)) {
+        const ChunkPoolStats& poolStats = m_chunkPool.GetStats();
+        const size_t loaded = std::max<size_t>(m_loadedChunks.Size(), 1);
+        spdlog::debug("Chunks loaded: {} ({} uniform, {} GPU resident), queued: {}, pool: {}/{} (peak {}, {} idle buffers)",
+            m_loadedChunks.Size(),
+            GetUniformChunkCount(),
+            GetGPUResidentChunkCount(),
+            m_generationQueue.Size(),
+            poolStats.inUse, m_chunkPool.GetCapacity(),
+            poolStats.highWaterMark, poolStats.idleBuffers);
+        spdlog::debug("Resident per loaded chunk: {:.1f} KB CPU + {:.1f} KB GPU",
+            GetCPUResidentBytes() / 1024.0 / loaded,
+            GetGPUResidentBytes() / 1024.0 / loaded);
+    }
+}
+
+Chunk* InfiniteChunkManager::GetChunk(const ChunkCoord& coord) {
+    Chunk* const* chunk = m_loadedChunks.Find(coord);
+    return chunk ? *chunk : nullptr;
+}
+
+const Chunk* InfiniteChunkManager::GetChunk(const ChunkCoord& coord) const {
+    Chunk* const* chunk = m_loadedChunks.Find(coord);
+    return chunk ? *chunk : nullptr;
+}
+
+size_t InfiniteChunkManager::GetCPUResidentBytes() const {
+    size_t bytes = 0;
+    for (const auto& [coord, chunk] : m_loadedChunks) {
+        if (chunk && chunk->HasCPUVoxels()) {
+            bytes += chunk->GetCPUVoxels().GetResidentBytes();
         }
-        GenerateNextChunk(device, cmdList);
     }
+    return bytes;
+}
 
-    // ===== STEP 4: Unload distant chunks =====
-    UnloadDistantChunks(cameraChunk);
+uint64_t InfiniteChunkManager::GetGPUResidentBytes() const {
+    uint64_t bytes = 0;
+    for (const auto& [coord, chunk] : m_loadedChunks) {
+        if (chunk) {
+            bytes += chunk->GetGPUResidentBytes();
+        }
+    }
+    return bytes;
+}
 
-    spdlog::debug("Chunks loaded: {}, queued: {}",
-        m_loadedChunks.size(),
-        m_generationQueue.size());
+size_t InfiniteChunkManager::GetGPUResidentChunkCount() const {
+    size_t count = 0;
+    for (const auto& [coord, chunk] : m_loadedChunks) {
+        if (chunk && chunk->IsGPUResident()) {
+            ++count;
+        }
+    }
+    return count;
 }
 
-Chunk* InfiniteChunkManager::GetChunk(const ChunkCoord& coord) {
-    auto it = m_loadedChunks.find(coord);
-    return (it != m_loadedChunks.end()) ? it->second : nullptr;
+size_t InfiniteChunkManager::GetUniformChunkCount() const {
+    size_t count = 0;
+    for (const auto& [coord, chunk] : m_loadedChunks) {
+        if (chunk && chunk->IsUniform()) {
+            ++count;
+        }
+    }
+    return count;
 }
 
-const Chunk* InfiniteChunkManager::GetChunk(const ChunkCoord& coord) const {
-    auto it = m_loadedChunks.find(coord);
-    return (it != m_loadedChunks.end()) ? it->second : nullptr;
+Result<void> InfiniteChunkManager::MaterializeChunk(
+    ID3D12Device* device,
+    ID3D12GraphicsCommandList* cmdList,
+    const ChunkCoord& coord)
+{
+    Chunk* chunk = GetChunk(coord);
+    if (!chunk) {
+        return Error("MaterializeChunk - chunk [{},{},{}] not loaded", coord.x, coord.y, coord.z);
+    }
+    if (!m_heapManager) {
+        return Error("MaterializeChunk - manager not initialized");
+    }
+    return chunk->Materialize(device, cmdList, *m_heapManager);
 }
 
 Result<void> InfiniteChunkManager::ForceGenerateChunk(
@@ -137,32 +280,16 @@ Result<void> InfiniteChunkManager::ForceGenerateChunk(
         return {};  // Already generated
     }
 
-    // Create chunk
-    Chunk* chunk = new Chunk();
-    auto result = chunk->Initialize(device, *m_heapManager, coord, "InfiniteChunk");
+    auto result = CreateChunk(device, cmdList, coord);
     if (!result) {
-        delete chunk;
-        return Error("Failed to initialize chunk: {}", result.error());
+        return result;
     }
 
-    // Generate chunk
-    result = chunk->Generate(
-        device,
-        cmdList,
-        m_generationPSO.Get(),
-        m_generationRootSignature.Get(),
-        m_config.worldSeed
-    );
-
-    if (!result) {
-        chunk->Shutdown();
-        delete chunk;
-        return Error("Failed to generate chunk: {}", result.error());
+    // Outside the unload cylinder the leaving shells would never reach it
+    if (!GetUnloadCylinder().Contains(m_lastCameraChunk, coord)) {
+        m_strayChunksLoaded = true;
     }
 
-    // Add to loaded chunks
-    m_loadedChunks[coord] = chunk;
-
     spdlog::info("Force-generated chunk [{},{},{}]", coord.x, coord.y, coord.z);
     return {};
 }
@@ -171,46 +298,49 @@ Result<void> InfiniteChunkManager::ForceGenerateChunk(
 // PRIVATE METHODS
 // ============================================================================
 
-Result<void> InfiniteChunkManager::QueueChunksAroundCamera(const ChunkCoord& cameraChunk) {
-    // Use unordered_set to avoid duplicate queue entries
-    std::unordered_set<ChunkCoord> chunksToLoad;
+Result<void> InfiniteChunkManager::QueueChunksAroundCamera(
+    const ChunkCoord& cameraChunk,
+    const ChunkCoord* previousChunk)
+{
+    const ChunkCylinder loadCylinder = GetLoadCylinder();
+
+    // Queued chunks that left the cylinder are skipped lazily when popped;
+    // compact once they could outnumber the live entries (amortised O(1))
+    size_t dropped = 0;
+    if (m_generationQueue.Size() > m_chunkPool.GetCapacity()) {
+        dropped = m_generationQueue.RemoveIf([&](const ChunkCoord& coord) {
+            return !loadCylinder.Contains(cameraChunk, coord);
+        });
+    }
 
     // ===== CYLINDRICAL LOADING PATTERN (Horizontal × Vertical) =====
-    // Iterate through cylindrical volume centered on camera chunk
-    for (int32_t dy = -m_config.renderDistanceVertical; dy <= m_config.renderDistanceVertical; ++dy) {
-        for (int32_t dx = -m_config.renderDistanceHorizontal; dx <= m_config.renderDistanceHorizontal; ++dx) {
-            for (int32_t dz = -m_config.renderDistanceHorizontal; dz <= m_config.renderDistanceHorizontal; ++dz) {
-                // OPTIMIZATION: Use circular horizontal pattern (not square)
-                // Only load chunks within horizontal radius
-                int32_t horizontalDistSq = dx * dx + dz * dz;
-                int32_t maxHorizDistSq = m_config.renderDistanceHorizontal * m_config.renderDistanceHorizontal;
-
-                if (horizontalDistSq > maxHorizDistSq) {
-                    continue;  // Skip corner chunks (outside circular radius)
-                }
-
-                ChunkCoord coord = {
-                    cameraChunk.x + dx,
-                    cameraChunk.y + dy,
-                    cameraChunk.z + dz
-                };
-
-                // Check if already loaded
-                if (m_loadedChunks.find(coord) != m_loadedChunks.end()) {
-                    continue;  // Already loaded
-                }
-
-                chunksToLoad.insert(coord);
-            }
+    // Only the shell entering the cylinder since the previous camera chunk
+    // (or the whole cylinder without one); everything else inside it is
+    // already loaded or queued
+    size_t queued = 0;
+    loadCylinder.ForEachChunkEntering(previousChunk, cameraChunk, [&](const ChunkCoord& coord) {
+        // Already loaded: only a chunk that left the render distance since
+        // needs its voxel buffer back
+        if (const Chunk* chunk = GetChunk(coord); chunk && (chunk->IsUniform() || chunk->IsGPUResident())) {
+            return;
         }
-    }
 
-    // Add new chunks to generation queue
-    for (const auto& coord : chunksToLoad) {
-        m_generationQueue.push(coord);
+        // Priority queue ignores chunks that are already queued
+        if (m_generationQueue.Push(coord)) {
+            ++queued;
+        }
+    });
+
+    // Requests the CPU workers have not started yet are dropped the same way,
+    // and cached terrain columns go with the horizontal streaming radius
+    if (m_cpuGenerator.IsInitialized()) {
+        dropped += m_cpuGenerator.CancelIf([&](const ChunkCoord& coord) {
+            return !loadCylinder.Contains(cameraChunk, coord);
+        });
+        m_cpuGenerator.EvictColumnsOutside(cameraChunk.x, cameraChunk.z, GetUnloadCylinder().horizontal);
     }
 
-    spdlog::debug("Queued {} new chunks for generation", chunksToLoad.size());
+    spdlog::debug("Queued {} new chunks for generation ({} out of range dropped)", queued, dropped);
     return {};
 }
 
@@ -218,23 +348,429 @@ Result<void> InfiniteChunkManager::GenerateNextChunk(
     ID3D12Device* device,
     ID3D12GraphicsCommandList* cmdList)
 {
-    if (m_generationQueue.empty()) {
+    ChunkCoord coord;
+    if (!PopNextChunk(coord)) {
         return {};
     }
 
-    ChunkCoord coord = m_generationQueue.front();
-    m_generationQueue.pop();
+    if (Chunk* chunk = GetChunk(coord)) {
+        auto result = RestoreVoxelBuffer(device, cmdList, *chunk);
+        if (!result) {
+            m_fullRescanPending = true;
+        }
+        return result;
+    }
 
-    // Skip if already loaded (could have been queued multiple times)
-    if (m_loadedChunks.find(coord) != m_loadedChunks.end()) {
+    auto loaded = LoadSavedChunk(device, cmdList, coord);
+    if (loaded && loaded.Value()) {
+        return {};
+    }
+
+    auto result = CreateChunk(device, cmdList, coord);
+    if (!result) {
+        // Shell streaming never revisits this chunk - rescan on the next update
+        m_fullRescanPending = true;
+        return result;
+    }
+
+    spdlog::debug("Generated chunk [{},{},{}] - {} chunks loaded",
+        coord.x, coord.y, coord.z, m_loadedChunks.Size());
+
+    return {};
+}
+
+bool InfiniteChunkManager::PopNextChunk(ChunkCoord& outCoord) {
+    // Skip chunks that are already loaded with everything they need (e.g. by
+    // ForceGenerateChunk while queued) or that left the cylinder since they were queued
+    const ChunkCylinder loadCylinder = GetLoadCylinder();
+    const Chunk* chunk = nullptr;
+    do {
+        if (!m_generationQueue.Pop(outCoord)) {
+            return false;
+        }
+        chunk = GetChunk(outCoord);
+    } while ((chunk && (chunk->IsUniform() || chunk->IsGPUResident())) ||
+             !loadCylinder.Contains(m_lastCameraChunk, outCoord));
+    return true;
+}
+
+Result<void> InfiniteChunkManager::RestoreVoxelBuffer(
+    ID3D12Device* device,
+    ID3D12GraphicsCommandList* cmdList,
+    Chunk& chunk)
+{
+    const ChunkCoord& coord = chunk.GetCoord();
+
+    // ===== IDLE POOL BUFFER, OR A NEW ONE =====
+    if (!m_chunkPool.AcquireVoxelBuffer(&chunk)) {
+        auto result = chunk.AttachVoxelBuffer(device, *m_heapManager);
+        if (!result) {
+            return Error("Failed to restore voxel buffer of chunk [{},{},{}]: {}",
+                coord.x, coord.y, coord.z, result.error());
+        }
+    }
+
+    // ===== DECODE THE RESIDENT CPU COPY INTO IT =====
+    auto result = chunk.UploadCPUVoxels(device, cmdList);
+    if (!result) {
+        m_chunkPool.ReleaseVoxelBuffer(&chunk);
+        return Error("Failed to upload chunk [{},{},{}]: {}",
+            coord.x, coord.y, coord.z, result.error());
+    }
+    m_stagedChunks.push_back(&chunk);
+    return {};
+}
+
+void InfiniteChunkManager::PumpGeneration(
+    ID3D12Device* device,
+    ID3D12GraphicsCommandList* cmdList)
+{
+    if (!m_cpuGenerator.IsInitialized()) {
+        // GPU: one CS_GenerateChunk dispatch per chunk
+        for (uint32_t i = 0; i < m_config.chunksPerFrame && !m_generationQueue.Empty(); ++i) {
+            GenerateNextChunk(device, cmdList);
+        }
+        return;
+    }
+
+    // ===== CPU: upload up to chunksPerFrame finished chunks =====
+    // Saved and uniform chunks below are loaded on this thread too, so they
+    // take from the same per-frame budget
+    uint32_t budget = m_config.chunksPerFrame;
+    m_cpuCompleted.clear();
+    m_cpuGenerator.PollCompleted(m_cpuCompleted, budget);
+    const ChunkCylinder loadCylinder = GetLoadCylinder();
+    for (GeneratedChunk& generated : m_cpuCompleted) {
+        // Left the render distance (or force-generated) while the worker ran
+        if (m_loadedChunks.Contains(generated.coord) || !loadCylinder.Contains(m_lastCameraChunk, generated.coord)) {
+            continue;
+        }
+        --budget;
+        auto result = AdoptGeneratedChunk(device, cmdList, generated);
+        if (!result) {
+            spdlog::warn("Failed to load generated chunk: {}", result.error());
+            // Shell streaming never revisits this chunk - rescan on the next update
+            m_fullRescanPending = true;
+        }
+    }
+    m_cpuCompleted.clear();
+
+    // ===== CPU: keep every worker busy, in priority order =====
+    const size_t maxOutstanding = static_cast<size_t>(m_cpuGenerator.GetWorkerCount()) * CPU_REQUESTS_PER_WORKER;
+    ChunkCoord coord;
+    while (m_cpuGenerator.GetOutstandingCount() < maxOutstanding && PopNextChunk(coord)) {
+        // Loaded chunks back in the render distance only decode their CPU copy
+        if (Chunk* chunk = GetChunk(coord)) {
+            if (budget == 0) {
+                m_generationQueue.Push(coord);
+                break;
+            }
+            --budget;
+            auto result = RestoreVoxelBuffer(device, cmdList, *chunk);
+            if (!result) {
+                spdlog::warn("{}", result.error());
+                m_fullRescanPending = true;
+            }
+            continue;
+        }
+
+        uint32_t uniformVoxel = 0;
+        const bool saved = m_regionStore.IsOpen() && m_regionStore.HasChunk(coord);
+        const bool uniform = !saved && Chunk::PredictUniform(coord, uniformVoxel);
+        if ((saved || uniform) && budget == 0) {
+            // Next frame, still ahead of everything behind it
+            m_generationQueue.Push(coord);
+            break;
+        }
+
+        // Saved chunks are loaded as they were left
+        if (saved) {
+            --budget;
+            auto loaded = LoadSavedChunk(device, cmdList, coord);
+            if (loaded && loaded.Value()) {
+                continue;
+            }
+        }
+
+        // Uniform chunks need no generation at all
+        if (uniform) {
+            --budget;
+            auto result = CreateChunk(device, cmdList, coord);
+            if (!result) {
+                spdlog::warn("Failed to create chunk: {}", result.error());
+                m_fullRescanPending = true;
+            }
+            continue;
+        }
+        // Already being generated: its result is adopted when it arrives
+        m_cpuGenerator.Submit(coord);
+    }
+}
+
+Result<void> InfiniteChunkManager::AdoptGeneratedChunk(
+    ID3D12Device* device,
+    ID3D12GraphicsCommandList* cmdList,
+    GeneratedChunk& generated)
+{
+    const ChunkCoord& coord = generated.coord;
+
+    // ===== UNIFORM RESULT (all water, all stone...): no GPU buffer =====
+    if (generated.voxels.IsUniform() && generated.voxels.GetVariantExceptionCount() == 0) {
+        Chunk* chunk = m_chunkPool.Acquire(false);
+        if (!chunk) {
+            return Error("Chunk pool exhausted ({} chunks) - cannot load [{},{},{}]",
+                m_chunkPool.GetCapacity(), coord.x, coord.y, coord.z);
+        }
+        chunk->InitializeUniform(coord, generated.voxels.GetUniformVoxel(), m_config.worldSeed);
+        m_loadedChunks.Insert(coord, chunk);
+        return {};
+    }
+
+    // ===== ACQUIRE A POOLED CHUNK AND UPLOAD THE GENERATED VOXELS =====
+    Chunk* chunk = m_chunkPool.Acquire(true);
+    if (!chunk) {
+        return Error("Chunk pool exhausted ({} chunks) - cannot load [{},{},{}]",
+            m_chunkPool.GetCapacity(), coord.x, coord.y, coord.z);
+    }
+
+    auto result = chunk->Initialize(device, *m_heapManager, coord, "InfiniteChunk");
+    if (!result) {
+        m_chunkPool.Release(chunk);
+        return Error("Failed to initialize chunk [{},{},{}]: {}",
+            coord.x, coord.y, coord.z, result.error());
+    }
+
+    chunk->SetCPUVoxels(std::move(generated.voxels));
+    result = chunk->UploadCPUVoxels(device, cmdList);
+    if (!result) {
+        m_chunkPool.Release(chunk);
+        return Error("Failed to upload chunk [{},{},{}]: {}",
+            coord.x, coord.y, coord.z, result.error());
+    }
+
+    m_loadedChunks.Insert(coord, chunk);
+    m_stagedChunks.push_back(chunk);
+    return {};
+}
+
+Result<bool> InfiniteChunkManager::LoadSavedChunk(
+    ID3D12Device* device,
+    ID3D12GraphicsCommandList* cmdList,
+    const ChunkCoord& coord)
+{
+    if (!m_regionStore.IsOpen()) {
+        return Result<bool>::Ok(false);
+    }
+
+    // A blob of another chunk size, position or world is ignored - regenerate instead
+    GeneratedChunk saved;
+    saved.coord = coord;
+    auto loaded = m_regionStore.LoadChunk(coord, INFINITE_CHUNK_SIZE, m_config.worldSeed, saved.voxels);
+    if (!loaded) {
+        spdlog::warn("Failed to read saved chunk [{},{},{}]: {}", coord.x, coord.y, coord.z, loaded.error());
+        return Result<bool>::Ok(false);
+    }
+    if (!loaded.Value()) {
+        return Result<bool>::Ok(false);
+    }
+
+    // Same path as a CPU-generated chunk: adopt the voxels and upload them
+    auto result = AdoptGeneratedChunk(device, cmdList, saved);
+    if (!result) {
+        return Result<bool>::Err(result.error());
+    }
+    spdlog::debug("Loaded saved chunk [{},{},{}]", coord.x, coord.y, coord.z);
+    return Result<bool>::Ok(true);
+}
+
+bool InfiniteChunkManager::MarkChunkModified(const ChunkCoord& coord) {
+    Chunk* chunk = GetChunk(coord);
+    if (!chunk || chunk->IsUniform() || !chunk->HasVoxelBuffer()) {
+        return false;
+    }
+    // Queued once: more writes before its readback is recorded change nothing
+    if (!chunk->IsDirty()) {
+        chunk->MarkDirty();
+        m_modifiedChunks.push_back(coord);
+    }
+    return true;
+}
+
+size_t InfiniteChunkManager::MarkBrushModified(const glm::vec3& center, float radius) {
+    const glm::vec3 extent(std::max(radius, 0.0f));
+    const glm::ivec3 lo = glm::ivec3(glm::floor(center - extent));
+    const glm::ivec3 hi = glm::ivec3(glm::floor(center + extent));
+    const ChunkCoord first = ChunkCoord::FromWorldPosition(lo.x, lo.y, lo.z, INFINITE_CHUNK_SIZE);
+    const ChunkCoord last = ChunkCoord::FromWorldPosition(hi.x, hi.y, hi.z, INFINITE_CHUNK_SIZE);
+
+    size_t marked = 0;
+    for (int32_t z = first.z; z <= last.z; ++z) {
+        for (int32_t y = first.y; y <= last.y; ++y) {
+            for (int32_t x = first.x; x <= last.x; ++x) {
+                marked += MarkChunkModified(ChunkCoord{ x, y, z }) ? 1 : 0;
+            }
+        }
+    }
+    return marked;
+}
+
+void InfiniteChunkManager::RecordChunkReadbacks(ID3D12Device* device, ID3D12GraphicsCommandList* cmdList) {
+    // Oldest first; a chunk whose previous readback is still in flight waits
+    // for it, so one readback buffer per chunk is enough
+    uint32_t budget = std::max(m_config.chunkReadbacksPerFrame, 1u);
+    size_t kept = 0;
+    for (size_t i = 0; i < m_modifiedChunks.size(); ++i) {
+        const ChunkCoord coord = m_modifiedChunks[i];
+        Chunk* chunk = GetChunk(coord);
+        if (!chunk || !chunk->IsDirty()) {
+            continue;
+        }
+        if (budget == 0 || chunk->IsReadbackPending()) {
+            m_modifiedChunks[kept++] = coord;
+            continue;
+        }
+        auto result = chunk->RecordReadback(device, cmdList);
+        if (!result) {
+            spdlog::warn("Failed to read back chunk [{},{},{}]: {}", coord.x, coord.y, coord.z, result.error());
+            m_modifiedChunks[kept++] = coord;
+            continue;
+        }
+        m_readbackChunks.push_back(chunk);
+        --budget;
+    }
+    m_modifiedChunks.resize(kept);
+}
+
+void InfiniteChunkManager::ResolveChunkReadbacks() {
+    for (Chunk* chunk : m_readbackChunks) {
+        auto result = chunk->ResolveReadback(m_config.worldSeed);
+        if (!result) {
+            const ChunkCoord& coord = chunk->GetCoord();
+            spdlog::warn("Failed to read back chunk [{},{},{}]: {}", coord.x, coord.y, coord.z, result.error());
+            // Read it back again
+            if (!chunk->IsDirty()) {
+                chunk->MarkDirty();
+                m_modifiedChunks.push_back(coord);
+            }
+        }
+    }
+    m_readbackChunks.clear();
+}
+
+void InfiniteChunkManager::SaveChunkIfModified(Chunk& chunk) {
+    // Only the CPU copy is saved; GPU writes since reach it through a
+    // readback, which marks it modified again for the next checkpoint
+    if (!m_regionStore.IsOpen() || !chunk.HasUnsavedChanges()) {
+        return;
+    }
+    auto result = chunk.SaveCPUVoxels(m_regionStore);
+    if (!result) {
+        const ChunkCoord& coord = chunk.GetCoord();
+        spdlog::warn("Failed to save chunk [{},{},{}]: {}", coord.x, coord.y, coord.z, result.error());
+    }
+}
+
+Result<void> InfiniteChunkManager::SaveModifiedChunks() {
+    if (!m_regionStore.IsOpen()) {
+        return {};
+    }
+    for (const auto& [coord, chunk] : m_loadedChunks) {
+        SaveChunkIfModified(*chunk);
+    }
+    m_lastAutosave = std::chrono::steady_clock::now();
+    return m_regionStore.CommitJournal();
+}
+
+Result<void> InfiniteChunkManager::BeginSnapshotSave(const std::filesystem::path& directory) {
+    if (m_snapshotSaver.IsActive()) {
+        return Error("A snapshot save is already running");
+    }
+    // A second RegionStore on the live files would race the main one
+    std::error_code error;
+    if (!m_config.worldSavePath.empty() && std::filesystem::equivalent(directory, m_config.worldSavePath, error)) {
+        return Error("Snapshot directory {} is the world's save directory", directory.string());
+    }
+
+    // O(chunks) pointer copies; no voxel is read or copied here
+    std::vector<PinnedChunk> pinned;
+    pinned.reserve(m_loadedChunks.Size());
+    for (const auto& [coord, chunk] : m_loadedChunks) {
+        if (chunk && chunk->HasCPUVoxels()) {
+            pinned.push_back(PinnedChunk{ coord, chunk->PinCPUVoxels() });
+        }
+    }
+    spdlog::info("Snapshot save of {} chunks to {}", pinned.size(), directory.string());
+    return m_snapshotSaver.Start(std::move(pinned), directory, m_config.worldSaveCodec);
+}
+
+void InfiniteChunkManager::UpdatePersistence() {
+    // Reap a finished snapshot save
+    if (m_snapshotSaver.IsActive() && m_snapshotSaver.IsFinished()) {
+        auto result = m_snapshotSaver.Wait();
+        if (!result) {
+            spdlog::warn("Snapshot save failed: {}", result.error());
+        }
+    }
+
+    if (!m_regionStore.IsOpen()) {
+        return;
+    }
+
+    // ===== STEP 1: Autosave checkpoint when due =====
+    if (m_config.autosaveIntervalSeconds > 0.0f) {
+        const std::chrono::duration<float> sinceAutosave = std::chrono::steady_clock::now() - m_lastAutosave;
+        if (sinceAutosave.count() >= m_config.autosaveIntervalSeconds) {
+            auto result = SaveModifiedChunks();
+            if (!result) {
+                spdlog::warn("Autosave failed: {}", result.error());
+            }
+        }
+    }
+
+    // ===== STEP 2: Move a few journaled chunks into the region files =====
+    if (m_regionStore.GetJournalPendingCount() > 0) {
+        auto compacted = m_regionStore.CompactJournal(std::max(m_config.journalCompactionBudget, 1u));
+        if (!compacted) {
+            spdlog::warn("Journal compaction failed: {}", compacted.error());
+        }
+    }
+}
+
+void InfiniteChunkManager::ReleaseUploadStaging() {
+    for (Chunk* chunk : m_stagedChunks) {
+        chunk->ReleaseUploadStaging();
+    }
+    m_stagedChunks.clear();
+    // Voxel buffers released with no free pool slot were in use by the same lists
+    m_chunkPool.FreeRetiredBuffers();
+}
+
+Result<void> InfiniteChunkManager::CreateChunk(
+    ID3D12Device* device,
+    ID3D12GraphicsCommandList* cmdList,
+    const ChunkCoord& coord)
+{
+    uint32_t uniformVoxel = 0;
+    bool uniform = Chunk::PredictUniform(coord, uniformVoxel);
+
+    // ===== ACQUIRE A POOLED CHUNK (recycled GPU buffer when available) =====
+    Chunk* chunk = m_chunkPool.Acquire(!uniform);
+    if (!chunk) {
+        return Error("Chunk pool exhausted ({} chunks) - cannot load [{},{},{}]",
+            m_chunkPool.GetCapacity(), coord.x, coord.y, coord.z);
+    }
+
+    // ===== UNIFORM CHUNK: single value, no GPU buffer, no dispatch =====
+    if (uniform) {
+        chunk->InitializeUniform(coord, uniformVoxel, m_config.worldSeed);
+        m_loadedChunks.Insert(coord, chunk);
         return {};
     }
 
     // ===== CREATE CHUNK =====
-    Chunk* chunk = new Chunk();
     auto result = chunk->Initialize(device, *m_heapManager, coord, "InfiniteChunk");
     if (!result) {
-        delete chunk;
+        m_chunkPool.Release(chunk);
         return Error("Failed to initialize chunk [{},{},{}]: {}",
             coord.x, coord.y, coord.z, result.error());
     }
@@ -249,54 +785,123 @@ Result<void> InfiniteChunkManager::GenerateNextChunk(
     );
 
     if (!result) {
-        chunk->Shutdown();
-        delete chunk;
+        m_chunkPool.Release(chunk);
         return Error("Failed to generate chunk [{},{},{}]: {}",
             coord.x, coord.y, coord.z, result.error());
     }
 
     // ===== ADD TO LOADED CHUNKS MAP =====
-    m_loadedChunks[coord] = chunk;
-
-    spdlog::debug("Generated chunk [{},{},{}] - {} chunks loaded",
-        coord.x, coord.y, coord.z, m_loadedChunks.size());
+    m_loadedChunks.Insert(coord, chunk);
 
+    // ===== READ THE GENERATED VOXELS BACK: THE CHUNK'S CPU COPY =====
+    result = chunk->RecordReadback(device, cmdList);
+    if (!result) {
+        spdlog::warn("Failed to read back chunk [{},{},{}]: {}", coord.x, coord.y, coord.z, result.error());
+        chunk->MarkDirty();
+        m_modifiedChunks.push_back(coord);
+    } else {
+        m_readbackChunks.push_back(chunk);
+    }
     return {};
 }
 
-void InfiniteChunkManager::UnloadDistantChunks(const ChunkCoord& cameraChunk) {
-    // Iterate and unload chunks beyond unload distance
-    for (auto it = m_loadedChunks.begin(); it != m_loadedChunks.end(); ) {
-        const ChunkCoord& coord = it->first;
+void InfiniteChunkManager::UnloadDistantChunks(
+    const ChunkCoord& cameraChunk,
+    const ChunkCoord* previousChunk)
+{
+    const ChunkCylinder loadCylinder = GetLoadCylinder();
+    const ChunkCylinder unloadCylinder = GetUnloadCylinder();
+    m_unloadScratch.clear();
+
+    if (previousChunk && !m_strayChunksLoaded) {
+        // Every loaded chunk lies inside the previous unload cylinder, and every
+        // GPU-resident one inside the previous load cylinder, so only the
+        // shells leaving them can need unloading or releasing
+        unloadCylinder.ForEachChunkEntering(&cameraChunk, *previousChunk, [&](const ChunkCoord& coord) {
+            if (m_loadedChunks.Contains(coord)) {
+                m_unloadScratch.push_back(coord);
+            }
+        });
+        loadCylinder.ForEachChunkEntering(&cameraChunk, *previousChunk, [&](const ChunkCoord& coord) {
+            const Chunk* chunk = GetChunk(coord);
+            if (chunk && chunk->HasVoxelBuffer() && unloadCylinder.Contains(cameraChunk, coord)) {
+                m_unloadScratch.push_back(coord);
+            }
+        });
+    } else {
+        // Full sweep: collect first, erasing shifts entries of the flat map under the iterator
+        for (const auto& [coord, chunk] : m_loadedChunks) {
+            // Unload if beyond horizontal OR vertical distance, release the
+            // buffer if only beyond the render distance
+            if (!unloadCylinder.Contains(cameraChunk, coord) ||
+                (chunk->HasVoxelBuffer() && !loadCylinder.Contains(cameraChunk, coord))) {
+                m_unloadScratch.push_back(coord);
+            }
+        }
+        m_strayChunksLoaded = false;
+    }
 
-        // Calculate distance from camera chunk (separate horizontal/vertical)
-        int32_t dx = std::abs(coord.x - cameraChunk.x);
-        int32_t dy = std::abs(coord.y - cameraChunk.y);
-        int32_t dz = std::abs(coord.z - cameraChunk.z);
+    for (const ChunkCoord& coord : m_unloadScratch) {
+        // A full sweep finds the chunks already waiting again
+        if (!TryEvictChunk(coord) &&
+            std::find(m_deferredEvictions.begin(), m_deferredEvictions.end(), coord) == m_deferredEvictions.end()) {
+            m_deferredEvictions.push_back(coord);
+        }
+    }
+}
 
-        // Calculate horizontal distance (XZ plane)
-        int32_t horizontalDistSq = dx * dx + dz * dz;
-        int32_t maxHorizDistSq = m_config.unloadDistanceHorizontal * m_config.unloadDistanceHorizontal;
+bool InfiniteChunkManager::TryEvictChunk(const ChunkCoord& coord) {
+    Chunk* chunk = GetChunk(coord);
+    if (!chunk) {
+        return true;
+    }
+    const bool unload = !GetUnloadCylinder().Contains(m_lastCameraChunk, coord);
+    if (!unload && (!chunk->HasVoxelBuffer() || GetLoadCylinder().Contains(m_lastCameraChunk, coord))) {
+        return true;  // Back in range (the camera returned)
+    }
+    // GPU writes on their way back would be lost with the buffer
+    if (!chunk->IsCPUVoxelsCurrent()) {
+        return false;
+    }
 
-        // Unload if beyond horizontal OR vertical distance
-        bool beyondHorizontal = horizontalDistSq > maxHorizDistSq;
-        bool beyondVertical = dy > m_config.unloadDistanceVertical;
+    if (!unload) {
+        // Still loaded on its CPU copy; the buffer idles in the pool
+        m_chunkPool.ReleaseVoxelBuffer(chunk);
+        spdlog::debug("Released voxel buffer of chunk [{},{},{}]", coord.x, coord.y, coord.z);
+        return true;
+    }
 
-        if (beyondHorizontal || beyondVertical) {
-            // Free GPU memory
-            if (it->second) {
-                it->second->Shutdown();
-                delete it->second;
-            }
+    // Back to the pool - the GPU buffer is kept for the next chunk
+    SaveChunkIfModified(*chunk);
+    m_chunkPool.Release(chunk);
+    m_loadedChunks.Erase(coord);
 
-            spdlog::debug("Unloaded chunk [{},{},{}] - distance: horiz²={}, vert={}",
-                coord.x, coord.y, coord.z, horizontalDistSq, dy);
+    spdlog::debug("Unloaded chunk [{},{},{}]", coord.x, coord.y, coord.z);
+    return true;
+}
 
-            it = m_loadedChunks.erase(it);
-        } else {
-            ++it;
+void InfiniteChunkManager::RetryDeferredEvictions() {
+    size_t kept = 0;
+    for (size_t i = 0; i < m_deferredEvictions.size(); ++i) {
+        const ChunkCoord coord = m_deferredEvictions[i];
+        // Done, or no longer needed (gone, or back in range)
+        if (!TryEvictChunk(coord)) {
+            m_deferredEvictions[kept++] = coord;
         }
     }
+    m_deferredEvictions.resize(kept);
+}
+
+ChunkCylinder InfiniteChunkManager::GetLoadCylinder() const {
+    return ChunkCylinder{ m_config.renderDistanceHorizontal, m_config.renderDistanceVertical };
+}
+
+ChunkCylinder InfiniteChunkManager::GetUnloadCylinder() const {
+    // Never smaller than the load cylinder, or loaded chunks would thrash
+    return ChunkCylinder{
+        std::max(m_config.unloadDistanceHorizontal, m_config.renderDistanceHorizontal),
+        std::max(m_config.unloadDistanceVertical, m_config.renderDistanceVertical)
+    };
 }
 
 Result<void> InfiniteChunkManager::CreateGenerationPipeline(ID3D12Device* device) {
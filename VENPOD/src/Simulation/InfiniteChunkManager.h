@@ -7,13 +7,21 @@
 
 #include <d3d12.h>
 #include <wrl/client.h>
+#include <chrono>
 #include <cstdint>
-#include <unordered_map>
-#include <queue>
+#include <filesystem>
+#include <string>
 #include <vector>
 #include <glm/glm.hpp>
+#include "AsyncChunkGenerator.h"
 #include "Chunk.h"
 #include "ChunkCoord.h"
+#include "ChunkCoordMap.h"
+#include "ChunkCylinder.h"
+#include "ChunkGenerationQueue.h"
+#include "ChunkPool.h"
+#include "ChunkSnapshot.h"
+#include "RegionStore.h"
 #include "../Graphics/RHI/DescriptorHeap.h"
 #include "../Utils/Result.h"
 
@@ -27,12 +35,54 @@ struct InfiniteChunkConfig {
     int32_t renderDistanceHorizontal = 8;  // Load ±8 chunks in X/Z (17×17 = 289 chunks per layer)
     int32_t renderDistanceVertical = 2;    // Load ±2 chunks in Y (5 layers total)
     // Total: 17×17×5 = 1,445 chunks × 1 MB = 1.4 GB VRAM max
+    // Uniform chunks (all air, water or stone) allocate no VRAM at all. Every
+    // other chunk inside this cylinder holds a 1 MB GPU buffer decoded from
+    // its palette-compressed CPU copy (typically 5-20× smaller than 1 MB).
 
     int32_t unloadDistanceHorizontal = 10; // Unload chunks beyond 10 chunks horizontally
     int32_t unloadDistanceVertical = 4;    // Unload chunks beyond 4 chunks vertically
+    // Chunks between the render and the unload distance keep only their CPU
+    // copy; their GPU buffers go back to the pool until they return
+    // The chunk pool is sized at Initialize for the larger of the render and
+    // unload cylinders; raising the render distance past that exhausts it
 
     uint32_t chunksPerFrame = 1;           // Generate 1-4 chunks per frame (1=smooth, 4=fast loading)
+
+    // Generate terrain on CPU worker threads (TerrainGenerator, same rules as
+    // CS_GenerateChunk) instead of one dispatch per chunk. chunksPerFrame then
+    // limits how many finished chunks are uploaded per frame. Every chunk that
+    // comes out as one value then skips the GPU buffer; with GPU generation
+    // only chunks above the terrain clamp can (see Chunk::PredictUniform).
+    bool cpuGeneration = true;
+    uint32_t cpuGenerationWorkers = 0;     // 0 = hardware threads - 1
+    // Cave noise on CPU workers: CAVE_LATTICE_EXACT (per voxel, matches the
+    // shader) or a lattice spacing of 4 / 8 (interpolated, far cheaper)
+    uint32_t cpuCaveLattice = CAVE_LATTICE_EXACT;
+
+    // Generation order: nearest first, chunks outside the view cone pushed back
+    // (see ChunkGenerationView)
+    float generationViewBias = 1.5f;
+    float generationViewConeCos = 0.5f;
+
     uint32_t worldSeed = 12345;            // Procedural generation seed
+
+    // Directory of region files for this world (see RegionStore); empty = no
+    // persistence. Modified chunks are saved when they unload, at every
+    // autosave and at Shutdown, and saved chunks are loaded instead of generated.
+    std::string worldSavePath;
+    // Encoding of saved chunks; PalettedLZ is ~3x smaller on disk and still
+    // loads an order of magnitude faster than generating (either loads regardless)
+    ChunkBlobCodec worldSaveCodec = ChunkBlobCodec::PalettedLZ;
+    // Autosave checkpoint period: chunks edited since the last one are
+    // appended to the region store's journal and synced (0 = only on unload
+    // and Shutdown). Costs time per edited chunk, not per loaded chunk.
+    float autosaveIntervalSeconds = 5.0f;
+    // Journaled chunks moved into the region files per Update
+    uint32_t journalCompactionBudget = 4;
+
+    // Chunks written on the GPU (MarkChunkModified) whose voxel buffer is
+    // copied back into the CPU copy per Update, oldest first; 1 MB each
+    uint32_t chunkReadbacksPerFrame = 2;
 };
 
 // Manager for infinite voxel world
@@ -55,33 +105,97 @@ public:
     void Shutdown();
 
     // Update chunk loading based on camera position
-    // Call this every frame to load nearby chunks and unload distant ones
+    // Call this every frame to load nearby chunks and unload distant ones.
+    // cameraForward (any length, zero = none) favours chunks in view.
     void Update(
         ID3D12Device* device,
         ID3D12GraphicsCommandList* cmdList,
-        const glm::vec3& cameraWorldPos
+        const glm::vec3& cameraWorldPos,
+        const glm::vec3& cameraForward = glm::vec3(0.0f)
     );
 
     // Get chunk at coordinate (returns nullptr if not loaded)
     Chunk* GetChunk(const ChunkCoord& coord);
     const Chunk* GetChunk(const ChunkCoord& coord) const;
 
-    // Get all loaded chunks for rendering
-    const std::unordered_map<ChunkCoord, Chunk*>& GetLoadedChunks() const { return m_loadedChunks; }
+    // Get all loaded chunks for rendering (skip chunks that are not
+    // IsGPUResident(): uniform, or outside the render window)
+    const ChunkCoordMap<Chunk*>& GetLoadedChunks() const { return m_loadedChunks; }
 
     // Get number of loaded chunks
-    size_t GetLoadedChunkCount() const { return m_loadedChunks.size(); }
+    size_t GetLoadedChunkCount() const { return m_loadedChunks.Size(); }
+
+    // Resident bytes of all palette-compressed CPU chunk copies
+    size_t GetCPUResidentBytes() const;
+
+    // VRAM held by chunk voxel buffers, and loaded chunks without one
+    uint64_t GetGPUResidentBytes() const;
+    size_t GetUniformChunkCount() const;
+    // Loaded chunks holding a voxel buffer (those in the render window)
+    size_t GetGPUResidentChunkCount() const;
+
+    // Give a loaded uniform chunk its GPU voxel buffer - call before the
+    // first write (edits, physics) into it. No-op for materialized chunks.
+    Result<void> MaterializeChunk(
+        ID3D12Device* device,
+        ID3D12GraphicsCommandList* cmdList,
+        const ChunkCoord& coord
+    );
+
+    // Chunk pool occupancy, high-water mark and buffer reuse
+    const ChunkPoolStats& GetChunkPoolStats() const { return m_chunkPool.GetStats(); }
+    uint32_t GetChunkPoolCapacity() const { return m_chunkPool.GetCapacity(); }
+
+    // Release the upload buffers of chunks that CPU generation uploaded in
+    // previous Updates. Call once those command lists have finished executing.
+    void ReleaseUploadStaging();
+
+    // Take in the voxel buffers read back in previous Updates (GPU edits and
+    // GPU generation) through each chunk's EditCPUVoxels(). Call once those
+    // command lists have finished executing, like ReleaseUploadStaging.
+    void ResolveChunkReadbacks();
+
+    // Record a GPU write (physics dispatch) into a loaded chunk's voxel
+    // buffer: a later Update reads it back into the CPU copy, which the next
+    // autosave then saves. The chunk stays loaded until then. False when the
+    // chunk is not loaded or has no voxel buffer (materialize it first).
+    bool MarkChunkModified(const ChunkCoord& coord);
+    // The same for every loaded chunk a brush sphere touches (world voxels);
+    // returns how many were marked
+    size_t MarkBrushModified(const glm::vec3& center, float radius);
+
+    // Autosave checkpoint: journal every loaded chunk with unsaved changes and
+    // sync the journal (also done periodically by Update and at Shutdown)
+    Result<void> SaveModifiedChunks();
+    const RegionStore& GetRegionStore() const { return m_regionStore; }
+
+    // Snapshot save: pin the current CPU voxels of every loaded chunk (one
+    // pointer copy each) and write them to `directory` on a background thread.
+    // Edits made meanwhile go to copy-on-write clones and are not in the
+    // snapshot. The snapshot holds only loaded chunks: modified chunks that
+    // already unloaded live in worldSavePath alone, GPU writes not read back
+    // yet are left out, and so are GPU-generated chunks whose first readback
+    // has not resolved. `directory` must not be worldSavePath,
+    // whose files the main thread keeps writing.
+    Result<void> BeginSnapshotSave(const std::filesystem::path& directory);
+    bool IsSnapshotSaveRunning() const { return m_snapshotSaver.IsActive() && !m_snapshotSaver.IsFinished(); }
+    // Block until the running snapshot save (if any) ends; its outcome
+    Result<void> FinishSnapshotSave() { return m_snapshotSaver.Wait(); }
+
+    // CPU generation requests not yet uploaded (0 with GPU generation)
+    size_t GetCPUGenerationOutstanding() const { return m_cpuGenerator.GetOutstandingCount(); }
 
     // Get generation queue size (for debugging)
-    size_t GetGenerationQueueSize() const { return m_generationQueue.size(); }
+    size_t GetGenerationQueueSize() const { return m_generationQueue.Size(); }
 
     // Get world seed
     uint32_t GetWorldSeed() const { return m_config.worldSeed; }
 
     // Configuration
     const InfiniteChunkConfig& GetConfig() const { return m_config; }
-    void SetRenderDistanceHorizontal(int32_t distance) { m_config.renderDistanceHorizontal = distance; }
-    void SetRenderDistanceVertical(int32_t distance) { m_config.renderDistanceVertical = distance; }
+    // Changing the render distance rescans the whole cylinder on the next Update
+    void SetRenderDistanceHorizontal(int32_t distance) { m_config.renderDistanceHorizontal = distance; m_fullRescanPending = true; }
+    void SetRenderDistanceVertical(int32_t distance) { m_config.renderDistanceVertical = distance; m_fullRescanPending = true; }
 
     // Force generation of specific chunk (for testing)
     Result<void> ForceGenerateChunk(
@@ -98,25 +212,90 @@ public:
     ID3D12RootSignature* GetGenerationRootSig() const { return m_generationRootSignature.Get(); }
 
 private:
-    // Internal chunk management
-    Result<void> QueueChunksAroundCamera(const ChunkCoord& cameraChunk);
+    // Internal chunk management. With a previous camera chunk only the shells
+    // entering / leaving the cylinders are visited, without one everything is.
+    Result<void> QueueChunksAroundCamera(const ChunkCoord& cameraChunk, const ChunkCoord* previousChunk);
     Result<void> GenerateNextChunk(ID3D12Device* device, ID3D12GraphicsCommandList* cmdList);
-    void UnloadDistantChunks(const ChunkCoord& cameraChunk);
+
+    // Next queued chunk still worth generating (or, when loaded, worth giving
+    // back its voxel buffer); false when the queue is empty
+    bool PopNextChunk(ChunkCoord& outCoord);
+    // Loaded chunk back in the render window: voxel buffer from the pool (or
+    // a new one), decoded from its CPU copy
+    Result<void> RestoreVoxelBuffer(ID3D12Device* device, ID3D12GraphicsCommandList* cmdList, Chunk& chunk);
+
+    // Per-frame generation: GPU dispatches, or CPU uploads plus new worker requests
+    void PumpGeneration(ID3D12Device* device, ID3D12GraphicsCommandList* cmdList);
+    Result<void> AdoptGeneratedChunk(ID3D12Device* device, ID3D12GraphicsCommandList* cmdList, GeneratedChunk& generated);
+
+    // Load a chunk saved in the world's region files; false when it has none
+    Result<bool> LoadSavedChunk(ID3D12Device* device, ID3D12GraphicsCommandList* cmdList, const ChunkCoord& coord);
+    // Journal a modified chunk's CPU voxels (at a checkpoint or before it goes away)
+    void SaveChunkIfModified(Chunk& chunk);
+    // Per-frame autosave checkpoint when due, plus budgeted journal compaction
+    void UpdatePersistence();
+    // Copy up to chunkReadbacksPerFrame chunks marked modified back from the GPU
+    void RecordChunkReadbacks(ID3D12Device* device, ID3D12GraphicsCommandList* cmdList);
+
+    // Create and generate one chunk: uniform chunks skip the GPU entirely
+    Result<void> CreateChunk(ID3D12Device* device, ID3D12GraphicsCommandList* cmdList, const ChunkCoord& coord);
+    // Unload chunks leaving the unload distance, and release the voxel
+    // buffers of those leaving the render distance
+    void UnloadDistantChunks(const ChunkCoord& cameraChunk, const ChunkCoord* previousChunk);
+    // Save and release one chunk outside the unload cylinder, or only its
+    // voxel buffer outside the load cylinder; false (unchanged) while its GPU
+    // writes have not reached the CPU copy yet
+    bool TryEvictChunk(const ChunkCoord& coord);
+    // Evictions held back by TryEvictChunk, retried every Update
+    void RetryDeferredEvictions();
+
+    // Render distance, and unload distance (at least the render distance)
+    ChunkCylinder GetLoadCylinder() const;
+    ChunkCylinder GetUnloadCylinder() const;
 
     // Create generation compute pipeline
     Result<void> CreateGenerationPipeline(ID3D12Device* device);
 
     InfiniteChunkConfig m_config;
 
-    // Loaded chunks (hash map for O(1) access)
-    std::unordered_map<ChunkCoord, Chunk*> m_loadedChunks;
+    // Loaded chunks (flat hash map for O(1) access), all owned by m_chunkPool
+    ChunkCoordMap<Chunk*> m_loadedChunks;
+    std::vector<ChunkCoord> m_unloadScratch;     // Reused by UnloadDistantChunks
+    ChunkPool m_chunkPool;
+
+    // Chunks waiting to be generated, nearest / in view first
+    ChunkGenerationQueue m_generationQueue;
+    glm::vec3 m_lastViewForward = glm::vec3(0.0f);
+
+    // CPU generation workers and per-frame scratch (see cpuGeneration)
+    AsyncChunkGenerator m_cpuGenerator;
+    std::vector<GeneratedChunk> m_cpuCompleted;
+    std::vector<Chunk*> m_stagedChunks;          // Uploaded, staging not yet released
+
+    // GPU writes on their way to the CPU copies
+    std::vector<ChunkCoord> m_modifiedChunks;    // Marked Dirty, readback not yet recorded
+    std::vector<Chunk*> m_readbackChunks;        // Recorded, not yet resolved
+    std::vector<ChunkCoord> m_deferredEvictions; // Left a cylinder while not current
 
-    // Chunks waiting to be generated
-    std::queue<ChunkCoord> m_generationQueue;
+    // Requests handed to the workers ahead of time, so none idles between frames
+    static constexpr size_t CPU_REQUESTS_PER_WORKER = 2;
+
+    // Saved chunks of this world (closed when worldSavePath is empty)
+    RegionStore m_regionStore;
+    std::chrono::steady_clock::time_point m_lastAutosave;
+    SnapshotSaver m_snapshotSaver;
+
+    // Re-prioritise the queue once the view turns by more than ~15°
+    static constexpr float VIEW_REPRIORITIZE_COS = 0.966f;
 
     // Last camera chunk position (to avoid redundant updates)
     ChunkCoord m_lastCameraChunk = ChunkCoord{INT32_MAX, INT32_MAX, INT32_MAX};
 
+    // Next Update queues / unloads against the whole cylinder instead of the shells
+    bool m_fullRescanPending = true;
+    // ForceGenerateChunk loaded a chunk outside the unload cylinder
+    bool m_strayChunksLoaded = false;
+
     // Generation compute shader pipeline
     ComPtr<ID3D12PipelineState> m_generationPSO;
     ComPtr<ID3D12RootSignature> m_generationRootSignature;
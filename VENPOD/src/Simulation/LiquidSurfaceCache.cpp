@@ -0,0 +1,66 @@
+#include "LiquidSurfaceCache.h"
+#include "MaterialTraits.h"
+#include "../Utils/BitPacking.h"
+#include "../Utils/MortonCode.h"
+#include <algorithm>
+
+namespace VENPOD::Simulation {
+
+void LiquidSurfaceCache::Initialize(uint32_t gridSizeX, uint32_t gridSizeY, uint32_t gridSizeZ, bool surfaces) {
+    m_gridSizeX = gridSizeX;
+    m_gridSizeY = gridSizeY;
+    m_gridSizeZ = gridSizeZ;
+
+    m_surface.assign(surfaces ? static_cast<size_t>(gridSizeX) * gridSizeY * gridSizeZ : 0, 0);
+    m_columnDirty.assign(static_cast<size_t>(gridSizeX) * gridSizeZ, 1);
+}
+
+void LiquidSurfaceCache::Shutdown() {
+    m_surface.clear();
+    m_surface.shrink_to_fit();
+    m_columnDirty.clear();
+    m_columnDirty.shrink_to_fit();
+}
+
+void LiquidSurfaceCache::MarkAllDirty() {
+    std::fill(m_columnDirty.begin(), m_columnDirty.end(), 1);
+}
+
+void LiquidSurfaceCache::ClearAllDirty() {
+    std::fill(m_columnDirty.begin(), m_columnDirty.end(), 0);
+}
+
+uint32_t LiquidSurfaceCache::RebuildSlice(const uint32_t* voxels, uint32_t z) {
+    uint32_t rebuilt = 0;
+
+    for (uint32_t x = 0; x < m_gridSizeX; ++x) {
+        uint32_t column = z * m_gridSizeX + x;
+        if (!m_columnDirty[column]) {
+            continue;
+        }
+        m_columnDirty[column] = 0;
+        ++rebuilt;
+
+        // Walk the column top-down. The upward scan from y stops at the first
+        // solid and reports the highest liquid before it (or y itself), so
+        // keep the highest liquid seen since the last solid.
+        uint16_t* surface = &m_surface[static_cast<size_t>(column) * m_gridSizeY];
+        const uint32_t* columnBase = &voxels[Utils::LinearIndex3D(x, 0, z, m_gridSizeX, m_gridSizeY)];
+        int32_t segmentTop = -1;
+        for (int32_t y = static_cast<int32_t>(m_gridSizeY) - 1; y >= 0; --y) {
+            uint8_t mat = Utils::UnpackMaterial(columnBase[static_cast<size_t>(y) * m_gridSizeX]);
+            if (HasMaterialFlag(mat, MaterialFlag::Liquid)) {
+                segmentTop = std::max(segmentTop, y);
+            } else if (mat != Utils::Material::Air) {
+                segmentTop = -1;
+                surface[y] = static_cast<uint16_t>(y);
+                continue;
+            }
+            surface[y] = static_cast<uint16_t>(segmentTop >= 0 ? segmentTop : y);
+        }
+    }
+
+    return rebuilt;
+}
+
+} // namespace VENPOD::Simulation
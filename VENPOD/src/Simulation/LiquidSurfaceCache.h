@@ -0,0 +1,57 @@
+#pragma once
+
+// =============================================================================
+// VENPOD Liquid Surface Cache - O(1) GetLiquidColumnHeight for the CPU simulation
+// The pressure rule in the liquid spread code asks "where is the top of the
+// liquid above me?", which the shader answers by scanning the column upward
+// to the first solid. In a deep flooded world that is O(height) reads for
+// every spreading voxel. This cache stores the answer for every (x, y, z) in
+// column-major order and only rebuilds columns whose liquid/solid layout
+// changed during the previous tick.
+// =============================================================================
+
+#include <cstdint>
+#include <vector>
+
+namespace VENPOD::Simulation {
+
+class LiquidSurfaceCache {
+public:
+    LiquidSurfaceCache() = default;
+    ~LiquidSurfaceCache() = default;
+
+    // Non-copyable
+    LiquidSurfaceCache(const LiquidSurfaceCache&) = delete;
+    LiquidSurfaceCache& operator=(const LiquidSurfaceCache&) = delete;
+
+    // Without surfaces only the column dirty flags are kept (chunk sleep reads
+    // them to wake liquid whose column changed); RebuildSlice must not be called
+    void Initialize(uint32_t gridSizeX, uint32_t gridSizeY, uint32_t gridSizeZ, bool surfaces = true);
+    void Shutdown();
+
+    // Force a full rebuild on the next RebuildSlice pass (after direct buffer edits)
+    void MarkAllDirty();
+    // Drop every flag without rebuilding (flags-only mode, after they were read)
+    void ClearAllDirty();
+    void MarkColumnDirty(uint32_t x, uint32_t z) { m_columnDirty[z * m_gridSizeX + x] = 1; }
+
+    // Rebuild every dirty column of slice z from READ and clear its flags.
+    // Returns the number of columns rebuilt. Safe to call for different z concurrently.
+    uint32_t RebuildSlice(const uint32_t* voxels, uint32_t z);
+
+    // Surface heights, gridSizeY entries per column, column index = z * gridSizeX + x
+    const uint16_t* GetSurfaceData() const { return m_surface.data(); }
+
+    // One flag per column, set by the kernels when a write changes the column's layout
+    uint8_t* GetDirtyFlags() { return m_columnDirty.data(); }
+
+private:
+    uint32_t m_gridSizeX = 0;
+    uint32_t m_gridSizeY = 0;
+    uint32_t m_gridSizeZ = 0;
+
+    std::vector<uint16_t> m_surface;
+    std::vector<uint8_t> m_columnDirty;
+};
+
+} // namespace VENPOD::Simulation
@@ -0,0 +1,126 @@
+#pragma once
+
+// =============================================================================
+// VENPOD Material Traits - Single 256-entry material table for all simulation code
+// Every classification (movable, liquid, flammable, ...) is one indexed load
+// instead of a chain of material comparisons. The HLSL side uses the generated
+// assets/shaders/Common/MaterialTraits.hlsli; regenerate it with the
+// generate_material_traits target after editing the table below.
+// =============================================================================
+
+#include <array>
+#include <cstdint>
+#include "../Utils/BitPacking.h"
+
+namespace VENPOD::Simulation {
+
+// Trait flags (must match MATFLAG_* in MaterialTraits.hlsli - generated)
+namespace MaterialFlag {
+    constexpr uint32_t Movable     = 1u << 0;  // Runs the movement/reaction rules
+    constexpr uint32_t Liquid      = 1u << 1;  // Pools, spreads and counts toward liquid column height
+    constexpr uint32_t Gas         = 1u << 2;  // Rises instead of falling
+    constexpr uint32_t Flammable   = 1u << 3;  // Fire and lava can ignite it
+    constexpr uint32_t Dissolvable = 1u << 4;  // Acid can dissolve it
+    constexpr uint32_t HeatSource  = 1u << 5;  // Ignites, melts and detonates neighbours
+    constexpr uint32_t Powder      = 1u << 6;  // Granular (piles up)
+    constexpr uint32_t Solid       = 1u << 7;  // Rigid solid
+    constexpr uint32_t Active      = 1u << 8;  // Keeps its chunk active in the chunk scanner
+    constexpr uint32_t Restless    = 1u << 9;  // Timers or random rules: can change with no neighbour changing
+}
+
+struct MaterialTraits {
+    uint32_t flags = 0;
+    uint8_t density = 0;        // Relative density; heavier movers sink through lighter liquids/gases
+    uint8_t viscosity = 0;      // 0 = free flowing, 255 = barely moves
+    uint8_t flammability = 0;   // Relative ignition chance, 0 = never
+    uint8_t lifetime = 0;       // Starting life counter of spawned voxels, 0 = persistent
+    uint32_t reactsWith = 0;    // Bit N set: reacts on contact with material N (N < 32)
+};
+
+// Bit for a material in MaterialTraits::reactsWith
+constexpr uint32_t MaterialBit(uint8_t material) {
+    return material < 32 ? (1u << material) : 0u;
+}
+
+constexpr std::array<MaterialTraits, 256> BuildMaterialTraitsTable() {
+    using namespace MaterialFlag;
+    namespace M = Utils::Material;
+
+    std::array<MaterialTraits, 256> table{};
+
+    //                      flags                                          dens visc flam life reactsWith
+    table[M::Air]       = { 0,                                             0,   0,   0,   0,   0 };
+    table[M::Sand]      = { Movable | Powder | Dissolvable | Active,       160, 0,   0,   0,   MaterialBit(M::Acid) };
+    table[M::Water]     = { Movable | Liquid | Active,                    100, 0,   0,   0,
+                            MaterialBit(M::Lava) | MaterialBit(M::Fire) | MaterialBit(M::Ice) | MaterialBit(M::Acid) };
+    table[M::Stone]     = { Solid | Dissolvable,                          250, 0,   0,   0,   MaterialBit(M::Acid) };
+    table[M::Dirt]      = { Powder | Dissolvable,                         170, 0,   0,   0,   MaterialBit(M::Acid) };
+    table[M::Wood]      = { Flammable | Dissolvable,                      70,  0,   64,  0,
+                            MaterialBit(M::Fire) | MaterialBit(M::Lava) | MaterialBit(M::Acid) };
+    table[M::Fire]      = { Movable | HeatSource | Active | Restless,     3,   0,   0,   15,
+                            MaterialBit(M::Wood) | MaterialBit(M::Oil) | MaterialBit(M::Gunpowder) |
+                            MaterialBit(M::Water) | MaterialBit(M::Ice) };
+    table[M::Lava]      = { Movable | Liquid | HeatSource | Active | Restless, 200, 96,  0,   0,
+                            MaterialBit(M::Water) | MaterialBit(M::Ice) | MaterialBit(M::Wood) |
+                            MaterialBit(M::Oil) | MaterialBit(M::Gunpowder) };
+    table[M::Ice]       = { Dissolvable,                                  92,  0,   0,   0,
+                            MaterialBit(M::Fire) | MaterialBit(M::Lava) | MaterialBit(M::Water) | MaterialBit(M::Acid) };
+    table[M::Oil]       = { Movable | Liquid | Flammable | Active,        80,  32,  255, 0,
+                            MaterialBit(M::Fire) | MaterialBit(M::Lava) };
+    table[M::Glass]     = { Solid,                                        250, 0,   0,   0,   0 };
+    table[M::Smoke]     = { Movable | Gas | Restless,                     2,   0,   0,   15,  0 };
+    table[M::Acid]      = { Movable | Liquid | Restless,                  105, 0,   0,   0,
+                            MaterialBit(M::Water) | MaterialBit(M::Stone) | MaterialBit(M::Dirt) |
+                            MaterialBit(M::Wood) | MaterialBit(M::Sand) | MaterialBit(M::Ice) | MaterialBit(M::Concrete) };
+    table[M::Honey]     = { Movable | Liquid | Restless,                  140, 192, 0,   0,   0 };
+    table[M::Concrete]  = { Movable | Liquid | Dissolvable | Restless,    180, 64,  0,   0,   MaterialBit(M::Acid) };
+    table[M::Gunpowder] = { Movable | Flammable,                          150, 0,   255, 0,
+                            MaterialBit(M::Fire) | MaterialBit(M::Lava) };
+    table[M::Crystal]   = { 0,                                            250, 0,   0,   0,   0 };
+    table[M::Steam]     = { Movable | Gas | Restless,                     1,   0,   0,   10,  0 };
+    table[M::Bedrock]   = { Solid,                                        255, 0,   0,   0,   0 };
+
+    return table;
+}
+
+inline constexpr std::array<MaterialTraits, 256> MATERIAL_TRAITS = BuildMaterialTraitsTable();
+
+constexpr const MaterialTraits& GetMaterialTraits(uint8_t material) {
+    return MATERIAL_TRAITS[material];
+}
+
+constexpr bool HasMaterialFlag(uint8_t material, uint32_t flag) {
+    return (MATERIAL_TRAITS[material].flags & flag) != 0;
+}
+
+constexpr bool MaterialsReact(uint8_t a, uint8_t b) {
+    return (MATERIAL_TRAITS[a].reactsWith & MaterialBit(b)) != 0;
+}
+
+// Density displacement (plan.md §4.3): a falling voxel sinks through a lighter
+// liquid or gas below it, unless the two react on contact instead
+constexpr bool CanDisplace(uint8_t self, uint8_t below) {
+    const MaterialTraits& selfTraits = MATERIAL_TRAITS[self];
+    const MaterialTraits& belowTraits = MATERIAL_TRAITS[below];
+    return (selfTraits.flags & MaterialFlag::Movable) != 0 &&
+           (selfTraits.flags & MaterialFlag::Gas) == 0 &&
+           (belowTraits.flags & (MaterialFlag::Liquid | MaterialFlag::Gas)) != 0 &&
+           selfTraits.density > belowTraits.density &&
+           !MaterialsReact(self, below);
+}
+
+// The table is symmetric for reactions; catch one-sided edits at compile time
+constexpr bool ReactionsAreSymmetric() {
+    for (uint32_t a = 0; a < 32; ++a) {
+        for (uint32_t b = 0; b < 32; ++b) {
+            if (MaterialsReact(static_cast<uint8_t>(a), static_cast<uint8_t>(b)) !=
+                MaterialsReact(static_cast<uint8_t>(b), static_cast<uint8_t>(a))) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+static_assert(ReactionsAreSymmetric(), "MaterialTraits reactsWith must be symmetric");
+
+} // namespace VENPOD::Simulation
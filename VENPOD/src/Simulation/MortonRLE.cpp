@@ -0,0 +1,389 @@
+#include "MortonRLE.h"
+#include "../Utils/MortonCode.h"
+#include "../Utils/PCGRandom.h"
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define VENPOD_RLE_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace VENPOD::Simulation {
+
+namespace {
+
+constexpr uint32_t RLE_MAGIC = 0x454C524Du;    // "MRLE"
+constexpr uint32_t RLE_VERSION = 1;
+constexpr uint32_t RLE_FLAG_VARIANTS = 1u;
+constexpr uint32_t MAX_GRID_SIZE = 1024;       // 10 bits per axis in the Morton code
+
+constexpr uint32_t BRICK_EDGE = 8;
+constexpr uint32_t BRICK_VOXELS = BRICK_EDGE * BRICK_EDGE * BRICK_EDGE;
+
+struct MortonRLEHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t sizeX, sizeY, sizeZ;
+    uint32_t flags;
+    int32_t originX, originY, originZ;
+    uint32_t seed;
+    uint32_t runCount;
+};
+
+// Per-call lookup tables for the Morton order inside one brick
+struct BrickTables {
+    uint32_t offset[BRICK_VOXELS];      // Grid index relative to the brick's corner
+    uint32_t hash[BRICK_VOXELS];        // Random3D argument relative to the corner
+    uint8_t x[BRICK_VOXELS];
+    uint8_t y[BRICK_VOXELS];
+    uint8_t z[BRICK_VOXELS];
+
+    BrickTables(uint32_t sizeX, uint32_t sizeY) {
+        for (uint32_t i = 0; i < BRICK_VOXELS; ++i) {
+            uint32_t lx, ly, lz;
+            Utils::DecodeMorton3D(i, lx, ly, lz);
+            offset[i] = lx + ly * sizeX + lz * sizeX * sizeY;
+            hash[i] = lx + ly * 256u + lz * 65536u;
+            x[i] = static_cast<uint8_t>(lx);
+            y[i] = static_cast<uint8_t>(ly);
+            z[i] = static_cast<uint8_t>(lz);
+        }
+    }
+};
+
+// Random3D(origin + corner, seed) minus the in-brick part (uint32 arithmetic wraps like the hash)
+inline uint32_t HashBase(const MortonRLEVariants& variants, uint32_t cx, uint32_t cy, uint32_t cz) {
+    return (static_cast<uint32_t>(variants.originX) + cx) + (static_cast<uint32_t>(variants.originY) + cy) * 256u +
+           (static_cast<uint32_t>(variants.originZ) + cz) * 65536u + variants.seed * 16777213u;
+}
+
+inline uint32_t VariantBits(uint32_t hashArgument) {
+    return (Utils::PCGHash(hashArgument) & 0xFFu) << 8;
+}
+
+// Visit the bricks along the Z-order curve, calling fn(cornerX, cornerY, cornerZ).
+// Out-of-grid bricks of a non-cubic grid are skipped a whole aligned octree
+// block at a time: an aligned block's first brick is its minimum corner, so if
+// that lies outside the grid, the whole block does.
+template <typename Fn>
+void ForEachBrick(uint32_t sizeX, uint32_t sizeY, uint32_t sizeZ, Fn&& fn) {
+    const uint32_t bricksX = (sizeX + BRICK_EDGE - 1) / BRICK_EDGE;
+    const uint32_t bricksY = (sizeY + BRICK_EDGE - 1) / BRICK_EDGE;
+    const uint32_t bricksZ = (sizeZ + BRICK_EDGE - 1) / BRICK_EDGE;
+    const uint32_t side = std::bit_ceil(std::max({ bricksX, bricksY, bricksZ }));
+    const uint64_t total = static_cast<uint64_t>(side) * side * side;
+
+    for (uint64_t brick = 0; brick < total;) {
+        uint32_t bx, by, bz;
+        Utils::DecodeMorton3D(static_cast<uint32_t>(brick), bx, by, bz);
+        if (bx >= bricksX || by >= bricksY || bz >= bricksZ) {
+            brick += 1ull << (3 * (std::countr_zero(brick) / 3));
+            continue;
+        }
+        fn(bx * BRICK_EDGE, by * BRICK_EDGE, bz * BRICK_EDGE);
+        ++brick;
+    }
+}
+
+// Number of leading keys equal to `key`
+inline uint32_t MatchingPrefix(const uint32_t* keys, uint32_t count, uint32_t key) {
+    uint32_t i = 0;
+#if VENPOD_RLE_SSE2
+    const __m128i broadcast = _mm_set1_epi32(static_cast<int>(key));
+    for (; i + 16 <= count; i += 16) {
+        const __m128i* block = reinterpret_cast<const __m128i*>(keys + i);
+        const __m128i equal = _mm_and_si128(
+            _mm_and_si128(_mm_cmpeq_epi32(_mm_loadu_si128(block), broadcast),
+                          _mm_cmpeq_epi32(_mm_loadu_si128(block + 1), broadcast)),
+            _mm_and_si128(_mm_cmpeq_epi32(_mm_loadu_si128(block + 2), broadcast),
+                          _mm_cmpeq_epi32(_mm_loadu_si128(block + 3), broadcast)));
+        if (_mm_movemask_epi8(equal) != 0xFFFF) {
+            break;
+        }
+    }
+    for (; i + 4 <= count; i += 4) {
+        const __m128i equal = _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(keys + i)), broadcast);
+        const uint32_t mask = static_cast<uint32_t>(_mm_movemask_ps(_mm_castsi128_ps(equal)));
+        if (mask != 0xFu) {
+            return i + static_cast<uint32_t>(std::countr_zero(~mask & 0xFu));
+        }
+    }
+#endif
+    while (i < count && keys[i] == key) {
+        ++i;
+    }
+    return i;
+}
+
+// Accumulates the current run and appends finished ones to the stream,
+// RUN_BATCH at a time rather than growing the vector per run
+class RunWriter {
+public:
+    explicit RunWriter(std::vector<uint8_t>& out) : m_out(out) {}
+
+    void Append(const uint32_t* keys, uint32_t count) {
+        uint32_t i = 0;
+        if (m_count == 0 && count > 0) {
+            m_key = keys[0];
+        }
+        while (i < count) {
+            const uint32_t same = MatchingPrefix(keys + i, count - i, m_key);
+            m_count += same;
+            i += same;
+            if (i < count) {
+                Emit();
+                m_key = keys[i];
+            }
+        }
+    }
+
+    uint32_t Finish() {
+        if (m_count > 0) {
+            Emit();
+        }
+        FlushBatch();
+        return m_runCount;
+    }
+
+private:
+    static constexpr uint32_t RUN_BATCH = 256;
+
+    void Emit() {
+        m_batch[m_batchSize * 2] = m_count;
+        m_batch[m_batchSize * 2 + 1] = m_key;
+        ++m_runCount;
+        m_count = 0;
+        if (++m_batchSize == RUN_BATCH) {
+            FlushBatch();
+        }
+    }
+
+    void FlushBatch() {
+        const uint8_t* bytes = reinterpret_cast<const uint8_t*>(m_batch);
+        m_out.insert(m_out.end(), bytes, bytes + m_batchSize * 2 * sizeof(uint32_t));
+        m_batchSize = 0;
+    }
+
+    std::vector<uint8_t>& m_out;
+    uint32_t m_key = 0;
+    uint32_t m_count = 0;
+    uint32_t m_runCount = 0;
+    uint32_t m_batch[RUN_BATCH * 2];
+    uint32_t m_batchSize = 0;
+};
+
+// Pulls voxels out of the run list in order
+class RunReader {
+public:
+    RunReader(const uint8_t* runs, uint32_t runCount) : m_runs(runs), m_runCount(runCount) {}
+
+    // Next run if the current one is used up; false past the last run
+    bool Refill() {
+        while (m_remaining == 0) {
+            if (m_next == m_runCount) {
+                return false;
+            }
+            uint32_t run[2];
+            std::memcpy(run, m_runs + static_cast<size_t>(m_next) * sizeof(run), sizeof(run));
+            ++m_next;
+            m_remaining = run[0];
+            m_key = run[1];
+        }
+        return true;
+    }
+
+    bool Read(uint32_t* out, uint32_t count) {
+        while (count > 0) {
+            if (!Refill()) {
+                return false;
+            }
+            const uint32_t take = std::min(m_remaining, count);
+            std::fill_n(out, take, m_key);
+            out += take;
+            count -= take;
+            m_remaining -= take;
+        }
+        return true;
+    }
+
+    // Current run covers the next `count` voxels
+    bool Covers(uint32_t count) const { return m_remaining >= count; }
+    uint32_t Key() const { return m_key; }
+    void Skip(uint32_t count) { m_remaining -= count; }
+    bool AtEnd() const { return m_remaining == 0 && m_next == m_runCount; }
+
+private:
+    const uint8_t* m_runs;
+    uint32_t m_runCount;
+    uint32_t m_next = 0;
+    uint32_t m_remaining = 0;
+    uint32_t m_key = 0;
+};
+
+template <bool Variants>
+void EncodeBricks(const uint32_t* voxels, uint32_t sizeX, uint32_t sizeY, uint32_t sizeZ,
+                  const MortonRLEVariants& variants, RunWriter& writer) {
+    const BrickTables tables(sizeX, sizeY);
+    const size_t sliceSize = static_cast<size_t>(sizeX) * sizeY;
+    uint32_t keys[BRICK_VOXELS];
+
+    ForEachBrick(sizeX, sizeY, sizeZ, [&](uint32_t cx, uint32_t cy, uint32_t cz) {
+        const uint32_t* corner = voxels + cx + cy * static_cast<size_t>(sizeX) + cz * sliceSize;
+        const uint32_t hashBase = Variants ? HashBase(variants, cx, cy, cz) : 0;
+        const bool full = cx + BRICK_EDGE <= sizeX && cy + BRICK_EDGE <= sizeY && cz + BRICK_EDGE <= sizeZ;
+
+        uint32_t count = 0;
+        if (full) {
+            for (uint32_t i = 0; i < BRICK_VOXELS; ++i) {
+                keys[i] = corner[tables.offset[i]];
+                if constexpr (Variants) {
+                    keys[i] ^= VariantBits(hashBase + tables.hash[i]);
+                }
+            }
+            count = BRICK_VOXELS;
+        } else {
+            for (uint32_t i = 0; i < BRICK_VOXELS; ++i) {
+                if (cx + tables.x[i] >= sizeX || cy + tables.y[i] >= sizeY || cz + tables.z[i] >= sizeZ) {
+                    continue;
+                }
+                uint32_t key = corner[tables.offset[i]];
+                if constexpr (Variants) {
+                    key ^= VariantBits(hashBase + tables.hash[i]);
+                }
+                keys[count++] = key;
+            }
+        }
+        writer.Append(keys, count);
+    });
+}
+
+template <bool Variants>
+bool DecodeBricks(RunReader& reader, uint32_t* outVoxels, uint32_t sizeX, uint32_t sizeY, uint32_t sizeZ,
+                  const MortonRLEVariants& variants) {
+    const BrickTables tables(sizeX, sizeY);
+    const size_t sliceSize = static_cast<size_t>(sizeX) * sizeY;
+    uint32_t keys[BRICK_VOXELS];
+    bool valid = true;
+
+    ForEachBrick(sizeX, sizeY, sizeZ, [&](uint32_t cx, uint32_t cy, uint32_t cz) {
+        if (!valid) {
+            return;
+        }
+        uint32_t* corner = outVoxels + cx + cy * static_cast<size_t>(sizeX) + cz * sliceSize;
+        const uint32_t hashBase = Variants ? HashBase(variants, cx, cy, cz) : 0;
+        const uint32_t width = std::min(BRICK_EDGE, sizeX - cx);
+        const uint32_t height = std::min(BRICK_EDGE, sizeY - cy);
+        const uint32_t depth = std::min(BRICK_EDGE, sizeZ - cz);
+        const bool full = width == BRICK_EDGE && height == BRICK_EDGE && depth == BRICK_EDGE;
+
+        // ===== Uniform brick: row fills, no per-voxel table walk =====
+        if (!Variants && full && reader.Refill() && reader.Covers(BRICK_VOXELS)) {
+            for (uint32_t lz = 0; lz < BRICK_EDGE; ++lz) {
+                for (uint32_t ly = 0; ly < BRICK_EDGE; ++ly) {
+                    std::fill_n(corner + ly * static_cast<size_t>(sizeX) + lz * sliceSize, BRICK_EDGE, reader.Key());
+                }
+            }
+            reader.Skip(BRICK_VOXELS);
+            return;
+        }
+
+        // ===== Mixed brick: expand its runs, then scatter in Morton order =====
+        if (!reader.Read(keys, width * height * depth)) {
+            valid = false;
+            return;
+        }
+        uint32_t next = 0;
+        for (uint32_t i = 0; i < BRICK_VOXELS; ++i) {
+            if (!full && (tables.x[i] >= width || tables.y[i] >= height || tables.z[i] >= depth)) {
+                continue;
+            }
+            uint32_t voxel = keys[next++];
+            if constexpr (Variants) {
+                voxel ^= VariantBits(hashBase + tables.hash[i]);
+            }
+            corner[tables.offset[i]] = voxel;
+        }
+    });
+    return valid && reader.AtEnd();
+}
+
+bool ValidSize(uint32_t size) {
+    return size > 0 && size <= MAX_GRID_SIZE;
+}
+
+} // namespace
+
+void EncodeMortonRLE(const uint32_t* voxels, uint32_t sizeX, uint32_t sizeY, uint32_t sizeZ,
+                     std::vector<uint8_t>& out, const MortonRLEVariants* variants) {
+    MortonRLEHeader header{};
+    header.magic = RLE_MAGIC;
+    header.version = RLE_VERSION;
+    header.sizeX = sizeX;
+    header.sizeY = sizeY;
+    header.sizeZ = sizeZ;
+    header.flags = variants ? RLE_FLAG_VARIANTS : 0u;
+    if (variants) {
+        header.originX = variants->originX;
+        header.originY = variants->originY;
+        header.originZ = variants->originZ;
+        header.seed = variants->seed;
+    }
+
+    // Header first; its run count is filled in once the runs are written
+    const size_t headerOffset = out.size();
+    out.resize(headerOffset + sizeof(header));
+    if (ValidSize(sizeX) && ValidSize(sizeY) && ValidSize(sizeZ)) {
+        RunWriter writer(out);
+        if (variants) {
+            EncodeBricks<true>(voxels, sizeX, sizeY, sizeZ, *variants, writer);
+        } else {
+            EncodeBricks<false>(voxels, sizeX, sizeY, sizeZ, MortonRLEVariants{}, writer);
+        }
+        header.runCount = writer.Finish();
+    }
+    std::memcpy(out.data() + headerOffset, &header, sizeof(header));
+}
+
+bool ReadMortonRLEInfo(const uint8_t* data, size_t size, MortonRLEInfo& info) {
+    MortonRLEHeader header;
+    if (size < sizeof(header)) {
+        return false;
+    }
+    std::memcpy(&header, data, sizeof(header));
+    if (header.magic != RLE_MAGIC || header.version != RLE_VERSION) {
+        return false;
+    }
+    if (size - sizeof(header) != static_cast<uint64_t>(header.runCount) * 2 * sizeof(uint32_t)) {
+        return false;
+    }
+
+    info.sizeX = header.sizeX;
+    info.sizeY = header.sizeY;
+    info.sizeZ = header.sizeZ;
+    info.runCount = header.runCount;
+    info.proceduralVariants = (header.flags & RLE_FLAG_VARIANTS) != 0;
+    info.variants = MortonRLEVariants{ header.originX, header.originY, header.originZ, header.seed };
+    return true;
+}
+
+bool DecodeMortonRLE(const uint8_t* data, size_t size, uint32_t* outVoxels,
+                     uint32_t sizeX, uint32_t sizeY, uint32_t sizeZ) {
+    MortonRLEInfo info;
+    if (!ReadMortonRLEInfo(data, size, info)) {
+        return false;
+    }
+    if (info.sizeX != sizeX || info.sizeY != sizeY || info.sizeZ != sizeZ ||
+        !ValidSize(sizeX) || !ValidSize(sizeY) || !ValidSize(sizeZ)) {
+        return false;
+    }
+
+    RunReader reader(data + sizeof(MortonRLEHeader), info.runCount);
+    if (info.proceduralVariants) {
+        return DecodeBricks<true>(reader, outVoxels, sizeX, sizeY, sizeZ, info.variants);
+    }
+    return DecodeBricks<false>(reader, outVoxels, sizeX, sizeY, sizeZ, info.variants);
+}
+
+} // namespace VENPOD::Simulation
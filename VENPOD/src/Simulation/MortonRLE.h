@@ -0,0 +1,61 @@
+#pragma once
+
+// =============================================================================
+// VENPOD Morton RLE - Run-length codec for packed voxel grids (plan.md §7.1)
+// The grid is linearised along the Z-order curve of Utils/MortonCode.h, so a
+// spatially coherent region (a slab of stone, a lake, the sky) becomes a few
+// long runs instead of one short run per row, and stored as [count, voxel]
+// pairs. The curve is walked in 8³ bricks (Morton order inside each brick and
+// between bricks, i.e. one Z-order curve over the whole grid); bricks beyond
+// a non-cubic grid's edges are skipped a whole octree block at a time.
+//
+// Encoding gathers a brick and extends the current run with an SSE2 compare
+// scan, 16 voxels per step. Decoding streams the runs straight into the grid
+// brick by brick, with no full-size intermediate buffer.
+//
+// As with PalettedVoxels, the variant byte of generated voxels is
+// Random3D(worldPos, seed) & 0xFF and would break every run. With
+// MortonRLEVariants the codec stores voxel ^ (procedural variant << 8):
+// untouched voxels then carry variant 0 and run together, and the XOR is
+// undone on decode, so any variant still round-trips exactly.
+//
+// Stream: header (dimensions, variant origin) then uint32 {count, voxel} pairs.
+// =============================================================================
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace VENPOD::Simulation {
+
+// World origin of voxel (0, 0, 0) and generation seed, as for PalettedVoxels::SetVariantOrigin
+struct MortonRLEVariants {
+    int32_t originX = 0;
+    int32_t originY = 0;
+    int32_t originZ = 0;
+    uint32_t seed = 0;
+};
+
+struct MortonRLEInfo {
+    uint32_t sizeX = 0;
+    uint32_t sizeY = 0;
+    uint32_t sizeZ = 0;
+    uint32_t runCount = 0;
+    bool proceduralVariants = false;
+    MortonRLEVariants variants;
+};
+
+// Grid index = x + y * sizeX + z * sizeX * sizeY, each size at most 1024.
+// Appends the encoded stream to `out`.
+void EncodeMortonRLE(const uint32_t* voxels, uint32_t sizeX, uint32_t sizeY, uint32_t sizeZ,
+                     std::vector<uint8_t>& out, const MortonRLEVariants* variants = nullptr);
+
+// Header of an encoded stream; false when it is not one
+bool ReadMortonRLEInfo(const uint8_t* data, size_t size, MortonRLEInfo& info);
+
+// Decode into a grid of the given size. False (outVoxels partially written)
+// when the stream is malformed or was encoded for other dimensions.
+bool DecodeMortonRLE(const uint8_t* data, size_t size, uint32_t* outVoxels,
+                     uint32_t sizeX, uint32_t sizeY, uint32_t sizeZ);
+
+} // namespace VENPOD::Simulation
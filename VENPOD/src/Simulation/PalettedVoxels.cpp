@@ -0,0 +1,538 @@
+#include "PalettedVoxels.h"
+#include "../Utils/PCGRandom.h"
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+
+namespace VENPOD::Simulation {
+
+namespace {
+
+constexpr uint32_t VARIANT_MASK = 0xFF00u;
+
+// Hash-table slot for the palette builder in Encode
+constexpr uint32_t EMPTY_SLOT = 0xFFFFFFFFu;
+
+inline uint32_t HashKey(uint64_t key) {
+    key ^= key >> 33;
+    key *= 0xFF51AFD7ED558CCDull;
+    key ^= key >> 33;
+    return static_cast<uint32_t>(key);
+}
+
+// Expand Bits-wide indices into out[]: the looked-up palette value, or the raw index when lut is null
+template <uint32_t Bits>
+void UnpackIndices(const uint64_t* words, uint32_t count, const uint32_t* lut, uint32_t* out) {
+    constexpr uint32_t perWord = 64 / Bits;
+    constexpr uint64_t mask = (1ull << Bits) - 1;
+
+    uint32_t fullWords = count / perWord;
+    for (uint32_t w = 0; w < fullWords; ++w) {
+        uint64_t bits = words[w];
+        uint32_t* dst = out + w * perWord;
+        for (uint32_t k = 0; k < perWord; ++k) {
+            uint32_t index = static_cast<uint32_t>(bits & mask);
+            dst[k] = lut ? lut[index] : index;
+            bits >>= Bits;
+        }
+    }
+    for (uint32_t i = fullWords * perWord; i < count; ++i) {
+        uint32_t index = static_cast<uint32_t>((words[i / perWord] >> ((i % perWord) * Bits)) & mask);
+        out[i] = lut ? lut[index] : index;
+    }
+}
+
+void Unpack(uint32_t bits, const uint64_t* words, uint32_t count, const uint32_t* lut, uint32_t* out) {
+    switch (bits) {
+        case 0:  std::fill(out, out + count, lut ? lut[0] : 0u); break;
+        case 1:  UnpackIndices<1>(words, count, lut, out); break;
+        case 2:  UnpackIndices<2>(words, count, lut, out); break;
+        case 4:  UnpackIndices<4>(words, count, lut, out); break;
+        case 8:  UnpackIndices<8>(words, count, lut, out); break;
+        default: UnpackIndices<16>(words, count, lut, out); break;
+    }
+}
+
+} // namespace
+
+void PalettedVoxels::Initialize(uint32_t edge, uint32_t fillVoxel) {
+    m_edge = edge;
+    m_voxelCount = edge * edge * edge;
+
+    // With procedural variants on, the fill takes each position's variant
+    m_palette.assign(1, m_proceduralVariants ? ((fillVoxel & ~VARIANT_MASK) | PROCEDURAL_KEY) : fillVoxel);
+    ClearExceptions();
+
+    // Uniform: no index storage until a second value is written
+    m_bits = 0;
+    m_words.clear();
+}
+
+void PalettedVoxels::Shutdown() {
+    m_palette.clear();
+    m_palette.shrink_to_fit();
+    m_words.clear();
+    m_words.shrink_to_fit();
+    ClearExceptions();
+    m_exceptionIndices.shrink_to_fit();
+    m_exceptionVariants.shrink_to_fit();
+    m_edge = 0;
+    m_voxelCount = 0;
+    m_bits = 0;
+    m_proceduralVariants = false;
+}
+
+void PalettedVoxels::SetVariantOrigin(int32_t originX, int32_t originY, int32_t originZ, uint32_t seed) {
+    // Keys already stored were made without (or with another) origin; keep the voxels
+    std::vector<uint32_t> voxels(m_voxelCount);
+    bool hadVoxels = IsInitialized();
+    if (hadVoxels) {
+        Decode(voxels.data());
+    }
+
+    m_proceduralVariants = true;
+    m_originX = originX;
+    m_originY = originY;
+    m_originZ = originZ;
+    m_seed = seed;
+
+    if (hadVoxels) {
+        Encode(voxels.data());
+    }
+}
+
+uint32_t PalettedVoxels::ProceduralVariant(uint32_t index) const {
+    uint32_t x = index % m_edge;
+    uint32_t y = (index / m_edge) % m_edge;
+    uint32_t z = index / (m_edge * m_edge);
+    return Utils::Random3D(static_cast<uint32_t>(m_originX) + x, static_cast<uint32_t>(m_originY) + y,
+                           static_cast<uint32_t>(m_originZ) + z, m_seed) & 0xFFu;
+}
+
+uint64_t PalettedVoxels::KeyFor(uint32_t index, uint32_t voxel) const {
+    if (m_proceduralVariants && ((voxel & VARIANT_MASK) >> 8) == ProceduralVariant(index)) {
+        return (voxel & ~VARIANT_MASK) | PROCEDURAL_KEY;
+    }
+    return voxel;
+}
+
+uint32_t PalettedVoxels::VoxelFor(uint32_t index, uint64_t key) const {
+    uint32_t voxel = static_cast<uint32_t>(key);
+    if (key & PROCEDURAL_KEY) {
+        voxel |= ProceduralVariant(index) << 8;
+    }
+    return voxel;
+}
+
+size_t PalettedVoxels::FindException(uint32_t index) const {
+    return static_cast<size_t>(std::lower_bound(m_exceptionIndices.begin(), m_exceptionIndices.end(), index) -
+                               m_exceptionIndices.begin());
+}
+
+void PalettedVoxels::ClearExceptions() {
+    m_exceptionIndices.clear();
+    m_exceptionVariants.clear();
+}
+
+uint32_t PalettedVoxels::ReadIndex(uint32_t index) const {
+    if (m_bits == 0) {
+        return 0;
+    }
+    uint64_t bitOffset = static_cast<uint64_t>(index) * m_bits;
+    uint64_t mask = (1ull << m_bits) - 1;
+    return static_cast<uint32_t>((m_words[bitOffset / 64] >> (bitOffset % 64)) & mask);
+}
+
+void PalettedVoxels::WriteIndex(uint32_t index, uint32_t value) {
+    if (m_bits == 0) {
+        return;
+    }
+    uint64_t bitOffset = static_cast<uint64_t>(index) * m_bits;
+    uint64_t mask = (1ull << m_bits) - 1;
+    uint64_t& word = m_words[bitOffset / 64];
+    word = (word & ~(mask << (bitOffset % 64))) | (static_cast<uint64_t>(value) << (bitOffset % 64));
+}
+
+uint32_t PalettedVoxels::BitsForPaletteSize(size_t size) {
+    if (size <= 1) return 0;
+    if (size <= 2) return 1;
+    if (size <= 4) return 2;
+    if (size <= 16) return 4;
+    if (size <= 256) return 8;
+    if (size <= (1u << MAX_PALETTE_BITS)) return MAX_PALETTE_BITS;
+    return RAW_BITS;
+}
+
+void PalettedVoxels::Repack(uint32_t bits) {
+    if (bits == m_bits) {
+        return;
+    }
+
+    std::vector<uint32_t> values(m_voxelCount);
+    if (bits == RAW_BITS) {
+        Decode(values.data());
+        m_palette.clear();
+        m_palette.shrink_to_fit();
+        ClearExceptions();
+    } else {
+        for (uint32_t i = 0; i < m_voxelCount; ++i) {
+            values[i] = ReadIndex(i);
+        }
+    }
+
+    m_bits = bits;
+    m_words.assign((static_cast<size_t>(m_voxelCount) * m_bits + 63) / 64, 0);
+    for (uint32_t i = 0; i < m_voxelCount; ++i) {
+        WriteIndex(i, values[i]);
+    }
+}
+
+void PalettedVoxels::Encode(const uint32_t* voxels) {
+    // ===== STEP 1: Build the palette and one index per voxel =====
+    static thread_local std::vector<uint32_t> indices;
+    static thread_local std::vector<uint32_t> table;
+    indices.resize(m_voxelCount);
+    table.assign(256, EMPTY_SLOT);
+    uint32_t tableMask = 255;
+
+    m_palette.clear();
+    ClearExceptions();
+    const size_t maxExceptions = m_voxelCount / EXCEPTION_DIVISOR;
+    uint64_t lastKey = ~0ull;
+    uint32_t lastIndex = 0;
+
+    // Past 2^16 distinct keys the chunk is stored raw; stop building the palette
+    const size_t maxPaletteSize = size_t(1) << MAX_PALETTE_BITS;
+    bool overflow = false;
+
+    uint32_t index = 0;
+    for (uint32_t z = 0; z < m_edge && !overflow; ++z) {
+        for (uint32_t y = 0; y < m_edge && !overflow; ++y) {
+            // Random3D seed of (0, y, z); x adds 1 per voxel
+            uint32_t rowSeed = (static_cast<uint32_t>(m_originX) + (static_cast<uint32_t>(m_originY) + y) * 256u +
+                                (static_cast<uint32_t>(m_originZ) + z) * 65536u) + m_seed * 16777213u;
+            for (uint32_t x = 0; x < m_edge; ++x, ++index) {
+                uint32_t voxel = voxels[index];
+                uint64_t key = voxel;
+                if (m_proceduralVariants) {
+                    uint32_t variant = (voxel & VARIANT_MASK) >> 8;
+                    if (variant == (Utils::PCGHash(rowSeed + x) & 0xFFu)) {
+                        key = (voxel & ~VARIANT_MASK) | PROCEDURAL_KEY;
+                    } else if (m_exceptionIndices.size() < maxExceptions) {
+                        key = (voxel & ~VARIANT_MASK) | PROCEDURAL_KEY;
+                        m_exceptionIndices.push_back(index);
+                        m_exceptionVariants.push_back(static_cast<uint8_t>(variant));
+                    }
+                }
+
+                // Neighbouring voxels usually repeat the same key
+                if (key == lastKey) {
+                    indices[index] = lastIndex;
+                    continue;
+                }
+
+                uint32_t slot = HashKey(key) & tableMask;
+                while (table[slot] != EMPTY_SLOT && m_palette[table[slot]] != key) {
+                    slot = (slot + 1) & tableMask;
+                }
+                if (table[slot] == EMPTY_SLOT) {
+                    if (m_palette.size() == maxPaletteSize) {
+                        overflow = true;
+                        break;
+                    }
+                    table[slot] = static_cast<uint32_t>(m_palette.size());
+                    m_palette.push_back(key);
+
+                    // Keep the table at most half full
+                    if (m_palette.size() * 2 > table.size()) {
+                        table.assign(table.size() * 2, EMPTY_SLOT);
+                        tableMask = static_cast<uint32_t>(table.size() - 1);
+                        for (uint32_t entry = 0; entry < m_palette.size(); ++entry) {
+                            uint32_t s = HashKey(m_palette[entry]) & tableMask;
+                            while (table[s] != EMPTY_SLOT) {
+                                s = (s + 1) & tableMask;
+                            }
+                            table[s] = entry;
+                        }
+                        slot = HashKey(key) & tableMask;
+                        while (m_palette[table[slot]] != key) {
+                            slot = (slot + 1) & tableMask;
+                        }
+                    }
+                }
+
+                lastKey = key;
+                lastIndex = table[slot];
+                indices[index] = lastIndex;
+            }
+        }
+    }
+
+    // ===== STEP 2: Pack with the narrowest width that fits =====
+    m_bits = overflow ? RAW_BITS : BitsForPaletteSize(m_palette.size());
+    m_words.assign((static_cast<size_t>(m_voxelCount) * m_bits + 63) / 64, 0);
+    if (m_bits == RAW_BITS) {
+        m_palette.clear();
+        ClearExceptions();
+        std::memcpy(m_words.data(), voxels, static_cast<size_t>(m_voxelCount) * sizeof(uint32_t));
+    } else {
+        for (uint32_t i = 0; i < m_voxelCount; ++i) {
+            WriteIndex(i, indices[i]);
+        }
+    }
+    m_palette.shrink_to_fit();
+    m_words.shrink_to_fit();
+    m_exceptionIndices.shrink_to_fit();
+    m_exceptionVariants.shrink_to_fit();
+}
+
+void PalettedVoxels::Decode(uint32_t* outVoxels) const {
+    if (m_bits == RAW_BITS) {
+        std::memcpy(outVoxels, m_words.data(), static_cast<size_t>(m_voxelCount) * sizeof(uint32_t));
+        return;
+    }
+
+    // Palette values with procedural variants still zero, and which entries need one
+    static thread_local std::vector<uint32_t> values;
+    static thread_local std::vector<uint32_t> variantMasks;
+    values.resize(m_palette.size());
+    variantMasks.resize(m_palette.size());
+    bool anyProcedural = false;
+    for (size_t i = 0; i < m_palette.size(); ++i) {
+        values[i] = static_cast<uint32_t>(m_palette[i]);
+        variantMasks[i] = (m_palette[i] & PROCEDURAL_KEY) ? VARIANT_MASK : 0u;
+        anyProcedural = anyProcedural || variantMasks[i] != 0;
+    }
+
+    if (!anyProcedural) {
+        Unpack(m_bits, m_words.data(), m_voxelCount, values.data(), outVoxels);
+        return;
+    }
+
+    // Indices first, then resolve them while recomputing the position hash
+    Unpack(m_bits, m_words.data(), m_voxelCount, nullptr, outVoxels);
+    uint32_t index = 0;
+    for (uint32_t z = 0; z < m_edge; ++z) {
+        for (uint32_t y = 0; y < m_edge; ++y) {
+            uint32_t rowSeed = (static_cast<uint32_t>(m_originX) + (static_cast<uint32_t>(m_originY) + y) * 256u +
+                                (static_cast<uint32_t>(m_originZ) + z) * 65536u) + m_seed * 16777213u;
+            for (uint32_t x = 0; x < m_edge; ++x, ++index) {
+                uint32_t entry = outVoxels[index];
+                uint32_t variant = (Utils::PCGHash(rowSeed + x) & 0xFFu) << 8;
+                outVoxels[index] = values[entry] | (variant & variantMasks[entry]);
+            }
+        }
+    }
+
+    for (size_t i = 0; i < m_exceptionIndices.size(); ++i) {
+        uint32_t& voxel = outVoxels[m_exceptionIndices[i]];
+        voxel = (voxel & ~VARIANT_MASK) | (static_cast<uint32_t>(m_exceptionVariants[i]) << 8);
+    }
+}
+
+uint32_t PalettedVoxels::Get(uint32_t index) const {
+    if (m_bits == RAW_BITS) {
+        return ReadIndex(index);
+    }
+    uint32_t voxel = VoxelFor(index, m_palette[ReadIndex(index)]);
+    if (!m_exceptionIndices.empty()) {
+        size_t at = FindException(index);
+        if (at < m_exceptionIndices.size() && m_exceptionIndices[at] == index) {
+            voxel = (voxel & ~VARIANT_MASK) | (static_cast<uint32_t>(m_exceptionVariants[at]) << 8);
+        }
+    }
+    return voxel;
+}
+
+void PalettedVoxels::Set(uint32_t index, uint32_t voxel) {
+    if (m_bits == RAW_BITS) {
+        WriteIndex(index, voxel);
+        return;
+    }
+
+    // The previous voxel's variant exception no longer applies
+    size_t at = FindException(index);
+    bool hadException = at < m_exceptionIndices.size() && m_exceptionIndices[at] == index;
+    if (hadException) {
+        m_exceptionIndices.erase(m_exceptionIndices.begin() + at);
+        m_exceptionVariants.erase(m_exceptionVariants.begin() + at);
+    }
+
+    uint64_t key = KeyFor(index, voxel);
+    if (!(key & PROCEDURAL_KEY) && m_proceduralVariants &&
+        m_exceptionIndices.size() < m_voxelCount / EXCEPTION_DIVISOR) {
+        key = (voxel & ~VARIANT_MASK) | PROCEDURAL_KEY;
+        m_exceptionIndices.insert(m_exceptionIndices.begin() + at, index);
+        m_exceptionVariants.insert(m_exceptionVariants.begin() + at, static_cast<uint8_t>((voxel & VARIANT_MASK) >> 8));
+    }
+
+    auto it = std::find(m_palette.begin(), m_palette.end(), key);
+    uint32_t entry = static_cast<uint32_t>(it - m_palette.begin());
+    if (it == m_palette.end()) {
+        m_palette.push_back(key);
+        uint32_t bits = BitsForPaletteSize(m_palette.size());
+        if (bits == RAW_BITS) {
+            m_palette.pop_back();
+            Repack(RAW_BITS);
+            WriteIndex(index, voxel);
+            return;
+        }
+        Repack(bits);
+    }
+    WriteIndex(index, entry);
+}
+
+void PalettedVoxels::Compact() {
+    if (m_bits == RAW_BITS) {
+        // The voxels may fit a palette again
+        std::vector<uint32_t> voxels(m_voxelCount);
+        Decode(voxels.data());
+        Encode(voxels.data());
+        return;
+    }
+
+    std::vector<uint32_t> remap(m_palette.size(), EMPTY_SLOT);
+    std::vector<uint64_t> used;
+    std::vector<uint32_t> indices(m_voxelCount);
+    for (uint32_t i = 0; i < m_voxelCount; ++i) {
+        uint32_t entry = ReadIndex(i);
+        if (remap[entry] == EMPTY_SLOT) {
+            remap[entry] = static_cast<uint32_t>(used.size());
+            used.push_back(m_palette[entry]);
+        }
+        indices[i] = remap[entry];
+    }
+
+    m_palette = std::move(used);
+    m_bits = BitsForPaletteSize(m_palette.size());
+    m_words.assign((static_cast<size_t>(m_voxelCount) * m_bits + 63) / 64, 0);
+    for (uint32_t i = 0; i < m_voxelCount; ++i) {
+        WriteIndex(i, indices[i]);
+    }
+    m_palette.shrink_to_fit();
+    m_words.shrink_to_fit();
+}
+
+// Serialized header; the arrays follow in declaration order
+struct PalettedVoxelsHeader {
+    uint32_t edge;
+    uint32_t bits;
+    uint32_t flags;                 // Bit 0: procedural variants
+    int32_t originX, originY, originZ;
+    uint32_t seed;
+    uint32_t paletteCount;
+    uint32_t wordCount;
+    uint32_t exceptionCount;
+};
+
+void PalettedVoxels::Serialize(std::vector<uint8_t>& out) const {
+    PalettedVoxelsHeader header{};
+    header.edge = m_edge;
+    header.bits = m_bits;
+    header.flags = m_proceduralVariants ? 1u : 0u;
+    header.originX = m_originX;
+    header.originY = m_originY;
+    header.originZ = m_originZ;
+    header.seed = m_seed;
+    header.paletteCount = static_cast<uint32_t>(m_palette.size());
+    header.wordCount = static_cast<uint32_t>(m_words.size());
+    header.exceptionCount = static_cast<uint32_t>(m_exceptionIndices.size());
+
+    auto append = [&out](const void* data, size_t bytes) {
+        const uint8_t* begin = static_cast<const uint8_t*>(data);
+        out.insert(out.end(), begin, begin + bytes);
+    };
+    out.reserve(out.size() + sizeof(header) + m_palette.size() * sizeof(uint64_t) +
+                m_words.size() * sizeof(uint64_t) + m_exceptionIndices.size() * (sizeof(uint32_t) + 1));
+    append(&header, sizeof(header));
+    append(m_palette.data(), m_palette.size() * sizeof(uint64_t));
+    append(m_words.data(), m_words.size() * sizeof(uint64_t));
+    append(m_exceptionIndices.data(), m_exceptionIndices.size() * sizeof(uint32_t));
+    append(m_exceptionVariants.data(), m_exceptionVariants.size());
+}
+
+bool PalettedVoxels::Deserialize(const uint8_t* data, size_t size) {
+    PalettedVoxelsHeader header;
+    if (size < sizeof(header)) {
+        return false;
+    }
+    std::memcpy(&header, data, sizeof(header));
+
+    // ===== Validate the shape before touching the storage =====
+    const bool bitsValid = header.bits == 0 || header.bits == 1 || header.bits == 2 || header.bits == 4 ||
+                           header.bits == 8 || header.bits == MAX_PALETTE_BITS || header.bits == RAW_BITS;
+    if (header.edge == 0 || header.edge > 1024 || !bitsValid) {
+        return false;
+    }
+    const uint64_t voxelCount = static_cast<uint64_t>(header.edge) * header.edge * header.edge;
+    const uint64_t expectedWords = (voxelCount * header.bits + 63) / 64;
+    const uint64_t maxPalette = header.bits == RAW_BITS ? 0 : (1ull << header.bits);
+    if (header.wordCount != expectedWords || header.paletteCount > maxPalette ||
+        (header.bits != RAW_BITS && header.paletteCount == 0) || header.exceptionCount > voxelCount) {
+        return false;
+    }
+    const size_t expectedSize = sizeof(header) + static_cast<size_t>(header.paletteCount) * sizeof(uint64_t) +
+                                static_cast<size_t>(header.wordCount) * sizeof(uint64_t) +
+                                static_cast<size_t>(header.exceptionCount) * (sizeof(uint32_t) + 1);
+    if (size != expectedSize) {
+        return false;
+    }
+
+    const uint8_t* cursor = data + sizeof(header);
+    auto read = [&cursor](auto& vector, size_t count) {
+        using Element = typename std::remove_reference_t<decltype(vector)>::value_type;
+        vector.resize(count);
+        std::memcpy(vector.data(), cursor, count * sizeof(Element));
+        cursor += count * sizeof(Element);
+    };
+    std::vector<uint64_t> palette, words;
+    std::vector<uint32_t> exceptionIndices;
+    std::vector<uint8_t> exceptionVariants;
+    read(palette, header.paletteCount);
+    read(words, header.wordCount);
+    read(exceptionIndices, header.exceptionCount);
+    read(exceptionVariants, header.exceptionCount);
+
+    // Every packed index must name a palette entry (Decode looks them up unchecked)
+    if (header.bits != 0 && header.bits != RAW_BITS && header.paletteCount < (1ull << header.bits)) {
+        constexpr uint32_t BLOCK = 4096;    // Voxels per check; BLOCK * bits is whole words
+        uint32_t indices[BLOCK];
+        for (uint64_t first = 0; first < voxelCount; first += BLOCK) {
+            const uint32_t count = static_cast<uint32_t>(std::min<uint64_t>(BLOCK, voxelCount - first));
+            Unpack(header.bits, words.data() + first * header.bits / 64, count, nullptr, indices);
+            for (uint32_t i = 0; i < count; ++i) {
+                if (indices[i] >= header.paletteCount) {
+                    return false;
+                }
+            }
+        }
+    }
+
+    // Exceptions must stay sorted and in range for FindException
+    for (size_t i = 0; i < exceptionIndices.size(); ++i) {
+        if (exceptionIndices[i] >= voxelCount || (i > 0 && exceptionIndices[i] <= exceptionIndices[i - 1])) {
+            return false;
+        }
+    }
+
+    m_edge = header.edge;
+    m_voxelCount = static_cast<uint32_t>(voxelCount);
+    m_bits = header.bits;
+    m_proceduralVariants = (header.flags & 1u) != 0;
+    m_originX = header.originX;
+    m_originY = header.originY;
+    m_originZ = header.originZ;
+    m_seed = header.seed;
+    m_palette = std::move(palette);
+    m_words = std::move(words);
+    m_exceptionIndices = std::move(exceptionIndices);
+    m_exceptionVariants = std::move(exceptionVariants);
+    return true;
+}
+
+size_t PalettedVoxels::GetResidentBytes() const {
+    return sizeof(*this) + m_palette.capacity() * sizeof(uint64_t) + m_words.capacity() * sizeof(uint64_t) +
+           m_exceptionIndices.capacity() * sizeof(uint32_t) + m_exceptionVariants.capacity();
+}
+
+} // namespace VENPOD::Simulation
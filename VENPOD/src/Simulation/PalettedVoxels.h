@@ -0,0 +1,138 @@
+#pragma once
+
+// =============================================================================
+// VENPOD Paletted Voxels - Compressed CPU-side storage for one cubic chunk
+// A 64³ chunk of packed voxels is 1 MB, but generated terrain holds a handful
+// of distinct (material, state) pairs. Each chunk keeps a palette of distinct
+// voxel values plus one bit-packed palette index per voxel, widened on demand
+// through 1, 2, 4, 8 and 16 bits. A chunk with a single palette entry (all air,
+// all water, all stone) stores no indices at all. Past 65536 distinct values
+// the storage falls back to raw 32-bit voxels.
+//
+// The visual variant byte is what breaks palettes: CS_GenerateChunk gives
+// every voxel Random3D(worldPos, seed) & 0xFF, so a freshly generated chunk
+// has ~256 values per material. With SetVariantOrigin, voxels whose variant
+// still equals that hash share one "procedural" palette entry and the variant
+// is recomputed on decode. Voxels that moved (physics swaps carry the variant
+// along) share that entry too, with their real variant kept in a sorted
+// sparse exception list; only past voxelCount / 16 exceptions do they get
+// explicit palette entries. The round trip is always lossless.
+// =============================================================================
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace VENPOD::Simulation {
+
+class PalettedVoxels {
+public:
+    PalettedVoxels() = default;
+    ~PalettedVoxels() = default;
+
+    // Movable, non-copyable (chunks own their storage); Clone() copies explicitly
+    PalettedVoxels& operator=(const PalettedVoxels&) = delete;
+    PalettedVoxels(PalettedVoxels&&) noexcept = default;
+    PalettedVoxels& operator=(PalettedVoxels&&) noexcept = default;
+
+    // Deep copy (copy-on-write detach from a snapshot, see SharedVoxels)
+    PalettedVoxels Clone() const { return PalettedVoxels(*this); }
+
+    // Cube of edge^3 voxels, index = x + y * edge + z * edge * edge, all set to
+    // fillVoxel (with procedural variants, if already enabled). Allocates
+    // nothing per voxel until a different value is written.
+    void Initialize(uint32_t edge, uint32_t fillVoxel = 0);
+    void Shutdown();    // Also turns procedural variants off
+
+    // Enable procedural variants: the chunk's world origin and the generation
+    // seed. Call before Initialize; on initialized storage it re-encodes.
+    void SetVariantOrigin(int32_t originX, int32_t originY, int32_t originZ, uint32_t seed);
+
+    // Origin and seed given to SetVariantOrigin; false when procedural variants are off
+    bool GetVariantOrigin(int32_t& originX, int32_t& originY, int32_t& originZ, uint32_t& seed) const {
+        originX = m_originX;
+        originY = m_originY;
+        originZ = m_originZ;
+        seed = m_seed;
+        return m_proceduralVariants;
+    }
+
+    bool IsInitialized() const { return m_voxelCount > 0; }
+    uint32_t GetEdge() const { return m_edge; }
+    uint32_t GetVoxelCount() const { return m_voxelCount; }
+
+    // ===== Bulk conversion to / from the packed uint32 layout =====
+    void Encode(const uint32_t* voxels);    // Rebuilds the palette from scratch
+    void Decode(uint32_t* outVoxels) const;
+
+    // ===== Single voxel access (edits; re-Encode after bulk changes) =====
+    uint32_t Get(uint32_t index) const;
+    void Set(uint32_t index, uint32_t voxel);
+
+    // Drop palette entries no voxel references any more and narrow the indices
+    void Compact();
+
+    // Every voxel has the same material and state (variants may still differ)
+    bool IsUniform() const { return IsInitialized() && m_bits == 0; }
+    // That voxel, variant zeroed when procedural (valid while IsUniform)
+    uint32_t GetUniformVoxel() const { return static_cast<uint32_t>(m_palette[0]); }
+
+    uint32_t GetBitsPerIndex() const { return m_bits; }     // 0 when uniform, 1-16, or 32 when raw
+    uint32_t GetPaletteSize() const { return static_cast<uint32_t>(m_palette.size()); }
+    uint32_t GetVariantExceptionCount() const { return static_cast<uint32_t>(m_exceptionIndices.size()); }
+    size_t GetResidentBytes() const;
+
+    // Memory of the same chunk as packed uint32 voxels
+    size_t GetUncompressedBytes() const { return static_cast<size_t>(m_voxelCount) * sizeof(uint32_t); }
+
+    // ===== Serialization (region files) =====
+    // Append the storage as is (palette, packed indices, exceptions, variant
+    // origin) to `out`; little-endian hosts only
+    void Serialize(std::vector<uint8_t>& out) const;
+    // Restore from Serialize output. Malformed input returns false and leaves
+    // the storage unchanged.
+    bool Deserialize(const uint8_t* data, size_t size);
+
+private:
+    PalettedVoxels(const PalettedVoxels&) = default;
+
+    // Palette keys: the voxel value, with bit 32 set (and variant zeroed)
+    // when the variant is the procedural one for the voxel's position
+    static constexpr uint64_t PROCEDURAL_KEY = 1ull << 32;
+    static constexpr uint32_t RAW_BITS = 32;
+    static constexpr uint32_t MAX_PALETTE_BITS = 16;
+    static constexpr uint32_t EXCEPTION_DIVISOR = 16;   // Max exceptions = voxelCount / 16
+
+    uint32_t ProceduralVariant(uint32_t index) const;
+    uint64_t KeyFor(uint32_t index, uint32_t voxel) const;
+    uint32_t VoxelFor(uint32_t index, uint64_t key) const;
+
+    // Position of `index` in m_exceptionIndices (or where it would be inserted)
+    size_t FindException(uint32_t index) const;
+    void ClearExceptions();
+
+    uint32_t ReadIndex(uint32_t index) const;
+    void WriteIndex(uint32_t index, uint32_t value);
+
+    // Re-pack every index with `bits` bits (or switch to raw voxels at 32)
+    void Repack(uint32_t bits);
+    static uint32_t BitsForPaletteSize(size_t size);
+
+    uint32_t m_edge = 0;
+    uint32_t m_voxelCount = 0;
+    uint32_t m_bits = 0;
+    std::vector<uint64_t> m_palette;      // Keys, see PROCEDURAL_KEY
+    std::vector<uint64_t> m_words;        // Packed indices (or raw voxels, two per word)
+
+    // Voxels under a procedural entry whose variant is not the procedural one
+    std::vector<uint32_t> m_exceptionIndices;   // Ascending voxel indices
+    std::vector<uint8_t> m_exceptionVariants;
+
+    bool m_proceduralVariants = false;
+    int32_t m_originX = 0;
+    int32_t m_originY = 0;
+    int32_t m_originZ = 0;
+    uint32_t m_seed = 0;
+};
+
+} // namespace VENPOD::Simulation
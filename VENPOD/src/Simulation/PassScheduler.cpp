@@ -0,0 +1,18 @@
+#include "PassScheduler.h"
+
+namespace VENPOD::Simulation {
+
+void PassScheduler::Build(const std::vector<uint32_t>& activeChunks, uint32_t chunkCountX, uint32_t chunkCountY) {
+    for (auto& pass : m_passes) {
+        pass.clear();
+    }
+
+    for (uint32_t chunkIndex : activeChunks) {
+        uint32_t cx = chunkIndex % chunkCountX;
+        uint32_t cy = (chunkIndex / chunkCountX) % chunkCountY;
+        uint32_t cz = chunkIndex / (chunkCountX * chunkCountY);
+        m_passes[GetChunkColor(cx, cy, cz)].push_back(chunkIndex);
+    }
+}
+
+} // namespace VENPOD::Simulation
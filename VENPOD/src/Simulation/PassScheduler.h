@@ -0,0 +1,48 @@
+#pragma once
+
+// =============================================================================
+// VENPOD Pass Scheduler - Checkerboard chunk colouring for conflict-free updates
+// (plan.md §2.2 "Pass system"). Chunks are coloured by the parity of their
+// chunk coordinates (2x2x2 = 8 colours). Two chunks of the same colour are at
+// least one full chunk apart, so as long as no voxel writes further than
+// CHUNK_SIZE / 2 outside its chunk, every chunk in a pass has a disjoint
+// write set and can be updated without atomics or locks.
+// =============================================================================
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace VENPOD::Simulation {
+
+class PassScheduler {
+public:
+    static constexpr uint32_t PASS_COUNT = 8;
+
+    PassScheduler() = default;
+    ~PassScheduler() = default;
+
+    // Non-copyable
+    PassScheduler(const PassScheduler&) = delete;
+    PassScheduler& operator=(const PassScheduler&) = delete;
+
+    // Bucket the active chunk list by colour
+    void Build(const std::vector<uint32_t>& activeChunks, uint32_t chunkCountX, uint32_t chunkCountY);
+
+    // Colour that runs as pass `passIndex` on the given tick. The starting
+    // colour rotates every tick so no region consistently moves first.
+    static uint32_t GetPassColor(uint32_t frameIndex, uint32_t passIndex) {
+        return (frameIndex + passIndex) % PASS_COUNT;
+    }
+
+    static uint32_t GetChunkColor(uint32_t chunkX, uint32_t chunkY, uint32_t chunkZ) {
+        return (chunkX & 1u) | ((chunkY & 1u) << 1) | ((chunkZ & 1u) << 2);
+    }
+
+    const std::vector<uint32_t>& GetChunksForColor(uint32_t color) const { return m_passes[color]; }
+
+private:
+    std::array<std::vector<uint32_t>, PASS_COUNT> m_passes;
+};
+
+} // namespace VENPOD::Simulation
@@ -0,0 +1,283 @@
+#include "RegionFile.h"
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <cstring>
+
+namespace VENPOD::Simulation {
+
+namespace {
+
+constexpr uint32_t REGION_MAGIC = 0x4E475256u;     // "VRGN"
+constexpr uint32_t REGION_VERSION = 1;
+
+struct RegionHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t regionChunks;
+    uint32_t sectorBytes;
+};
+
+// Floor division, so chunk -1 lands in region -1 rather than 0
+inline int32_t FloorDiv(int32_t value, int32_t divisor) {
+    int32_t quotient = value / divisor;
+    return (value % divisor != 0 && value < 0) ? quotient - 1 : quotient;
+}
+
+} // namespace
+
+ChunkCoord RegionFile::RegionOf(const ChunkCoord& chunk) {
+    return ChunkCoord{ FloorDiv(chunk.x, REGION_CHUNKS), FloorDiv(chunk.y, REGION_CHUNKS),
+                       FloorDiv(chunk.z, REGION_CHUNKS) };
+}
+
+uint32_t RegionFile::SlotOf(const ChunkCoord& chunk) {
+    const ChunkCoord region = RegionOf(chunk);
+    const uint32_t x = static_cast<uint32_t>(chunk.x - region.x * REGION_CHUNKS);
+    const uint32_t y = static_cast<uint32_t>(chunk.y - region.y * REGION_CHUNKS);
+    const uint32_t z = static_cast<uint32_t>(chunk.z - region.z * REGION_CHUNKS);
+    return x + y * REGION_CHUNKS + z * REGION_CHUNKS * REGION_CHUNKS;
+}
+
+Result<void> RegionFile::Open(const std::filesystem::path& path, bool create) {
+    Close();
+    m_path = path;
+
+    std::error_code error;
+    const bool exists = std::filesystem::exists(path, error);
+    if (!exists && !create) {
+        return Error("RegionFile::Open - {} does not exist", path.string());
+    }
+
+    auto result = m_writer.Open(path);
+    if (!result) {
+        return result;
+    }
+    if (!exists) {
+        result = CreateEmpty();
+        if (!result) {
+            Close();
+            return result;
+        }
+    }
+
+    result = m_mapping.Open(path);
+    if (!result) {
+        Close();
+        return result;
+    }
+    result = LoadTable();
+    if (!result) {
+        Close();
+        return result;
+    }
+    return {};
+}
+
+void RegionFile::Close() {
+    // Unpublished table entries would lose their blobs
+    if (!m_pendingSlots.empty()) {
+        auto result = Flush();
+        if (!result) {
+            spdlog::warn("RegionFile::Close - {}", result.error());
+        }
+    }
+    m_mapping.Close();
+    m_writer.Close();
+    m_mappingStale = false;
+    m_table.clear();
+    m_sectorUsed.clear();
+    m_pendingFree.clear();
+    m_pendingSlots.clear();
+    m_chunkCount = 0;
+    m_firstFreeHint = FIRST_BLOB_SECTOR;
+}
+
+Result<void> RegionFile::CreateEmpty() {
+    // Header sector followed by an all-zero (empty) offset table
+    std::vector<uint8_t> sectors(static_cast<size_t>(FIRST_BLOB_SECTOR) * REGION_SECTOR_BYTES, 0);
+    const RegionHeader header{ REGION_MAGIC, REGION_VERSION, static_cast<uint32_t>(REGION_CHUNKS), REGION_SECTOR_BYTES };
+    std::memcpy(sectors.data(), &header, sizeof(header));
+    return m_writer.WriteAt(0, sectors.data(), sectors.size());
+}
+
+Result<void> RegionFile::LoadTable() {
+    const uint8_t* data = m_mapping.GetData();
+    const size_t size = m_mapping.GetSize();
+    if (size < static_cast<size_t>(FIRST_BLOB_SECTOR) * REGION_SECTOR_BYTES) {
+        return Error("RegionFile - {} is truncated ({} bytes)", m_path.string(), size);
+    }
+
+    RegionHeader header;
+    std::memcpy(&header, data, sizeof(header));
+    if (header.magic != REGION_MAGIC || header.version != REGION_VERSION ||
+        header.regionChunks != static_cast<uint32_t>(REGION_CHUNKS) || header.sectorBytes != REGION_SECTOR_BYTES) {
+        return Error("RegionFile - {} is not a version {} region file", m_path.string(), REGION_VERSION);
+    }
+
+    m_table.resize(REGION_CHUNK_COUNT);
+    std::memcpy(m_table.data(), data + static_cast<size_t>(HEADER_SECTORS) * REGION_SECTOR_BYTES,
+                REGION_CHUNK_COUNT * sizeof(TableEntry));
+
+    // Rebuild the sector map from the table
+    const uint32_t fileSectors = SectorsFor(size);
+    m_sectorUsed.assign(fileSectors, false);
+    MarkSectors(0, FIRST_BLOB_SECTOR, true);
+    m_chunkCount = 0;
+    for (uint32_t slot = 0; slot < REGION_CHUNK_COUNT; ++slot) {
+        TableEntry& entry = m_table[slot];
+        if (entry.length == 0) {
+            continue;
+        }
+        const uint64_t end = static_cast<uint64_t>(entry.sector) * REGION_SECTOR_BYTES + entry.length;
+        if (entry.sector < FIRST_BLOB_SECTOR || end > size) {
+            // Torn write or corruption: forget the chunk, it will be regenerated
+            spdlog::warn("RegionFile - {} slot {} points outside the file, dropped", m_path.string(), slot);
+            entry = TableEntry{ 0, 0 };
+            continue;
+        }
+        MarkSectors(entry.sector, SectorsFor(entry.length), true);
+        ++m_chunkCount;
+    }
+    m_firstFreeHint = FIRST_BLOB_SECTOR;
+    return {};
+}
+
+std::span<const uint8_t> RegionFile::Read(uint32_t slot) {
+    const TableEntry& entry = m_table[slot];
+    if (entry.length == 0) {
+        return {};
+    }
+
+    const size_t offset = static_cast<size_t>(entry.sector) * REGION_SECTOR_BYTES;
+    if (offset + entry.length > m_mapping.GetSize() && m_mappingStale) {
+        // Written since the file was mapped: map it at its new size
+        auto result = m_mapping.Remap();
+        if (!result) {
+            spdlog::warn("RegionFile - {}", result.error());
+            return {};
+        }
+        m_mappingStale = false;
+    }
+    if (offset + entry.length > m_mapping.GetSize()) {
+        return {};
+    }
+    return std::span<const uint8_t>(m_mapping.GetData() + offset, entry.length);
+}
+
+Result<void> RegionFile::Write(uint32_t slot, const uint8_t* data, size_t size) {
+    if (size == 0 || size > UINT32_MAX) {
+        return Error("RegionFile::Write - invalid blob size {}", size);
+    }
+
+    TableEntry& entry = m_table[slot];
+    const uint32_t needed = SectorsFor(size);
+    const uint32_t held = SectorsFor(entry.length);
+
+    // ===== STEP 1: Choose sectors =====
+    // Always somewhere new: the old blob stays intact (and allocated) until
+    // Flush has made the new table entry durable
+    const uint32_t first = AllocateSectors(needed);
+    MarkSectors(first, needed, true);
+    if (entry.length != 0) {
+        m_pendingFree.emplace_back(entry.sector, held);
+    }
+
+    // ===== STEP 2: Blob, zero-padded to the sector boundary =====
+    const uint64_t offset = static_cast<uint64_t>(first) * REGION_SECTOR_BYTES;
+    auto result = m_writer.WriteAt(offset, data, size);
+    if (!result) {
+        return result;
+    }
+    const size_t padding = static_cast<size_t>(needed) * REGION_SECTOR_BYTES - size;
+    if (padding > 0) {
+        m_padding.resize(REGION_SECTOR_BYTES, 0);
+        result = m_writer.WriteAt(offset + size, m_padding.data(), padding);
+        if (!result) {
+            return result;
+        }
+    }
+
+    // ===== STEP 3: Table entry, in memory until Flush has synced the blob =====
+    if (entry.length == 0) {
+        ++m_chunkCount;
+    }
+    entry = TableEntry{ first, static_cast<uint32_t>(size) };
+    m_pendingSlots.push_back(slot);
+
+    if (offset + static_cast<uint64_t>(needed) * REGION_SECTOR_BYTES > m_mapping.GetSize()) {
+        m_mappingStale = true;
+    }
+    return {};
+}
+
+Result<void> RegionFile::Flush() {
+    // ===== STEP 1: Blobs on disk before any entry points at them =====
+    auto result = m_writer.Sync();
+    if (!result) {
+        return result;
+    }
+
+    // ===== STEP 2: Publish their table entries =====
+    if (!m_pendingSlots.empty()) {
+        for (uint32_t slot : m_pendingSlots) {
+            result = m_writer.WriteAt(static_cast<uint64_t>(HEADER_SECTORS) * REGION_SECTOR_BYTES +
+                                      slot * sizeof(TableEntry), &m_table[slot], sizeof(TableEntry));
+            if (!result) {
+                return result;
+            }
+        }
+        m_pendingSlots.clear();
+        result = m_writer.Sync();
+        if (!result) {
+            return result;
+        }
+    }
+
+    // ===== STEP 3: Replaced blobs are unreferenced on disk now =====
+    for (const auto& [first, count] : m_pendingFree) {
+        MarkSectors(first, count, false);
+    }
+    m_pendingFree.clear();
+    return {};
+}
+
+uint32_t RegionFile::AllocateSectors(uint32_t count) {
+    const uint32_t total = static_cast<uint32_t>(m_sectorUsed.size());
+    uint32_t runStart = m_firstFreeHint;
+    bool allUsedBefore = true;      // No free sector below runStart yet
+    for (uint32_t sector = m_firstFreeHint; sector < total; ++sector) {
+        if (m_sectorUsed[sector]) {
+            runStart = sector + 1;
+            continue;
+        }
+        if (allUsedBefore) {
+            m_firstFreeHint = sector;
+            allUsedBefore = false;
+        }
+        if (sector + 1 - runStart == count) {
+            return runStart;
+        }
+    }
+    // A free tail (possibly empty) continues past the end of the file
+    if (allUsedBefore) {
+        m_firstFreeHint = total;
+    }
+    return runStart;
+}
+
+void RegionFile::MarkSectors(uint32_t first, uint32_t count, bool used) {
+    if (first + count > m_sectorUsed.size()) {
+        m_sectorUsed.resize(first + count, false);
+    }
+    std::fill(m_sectorUsed.begin() + first, m_sectorUsed.begin() + first + count, used);
+    if (!used && count > 0) {
+        m_firstFreeHint = std::min(m_firstFreeHint, first);
+    }
+}
+
+uint32_t RegionFile::GetFreeSectorCount() const {
+    return static_cast<uint32_t>(std::count(m_sectorUsed.begin() + std::min<size_t>(FIRST_BLOB_SECTOR, m_sectorUsed.size()),
+                                            m_sectorUsed.end(), false));
+}
+
+} // namespace VENPOD::Simulation
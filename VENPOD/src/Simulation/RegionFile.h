@@ -0,0 +1,106 @@
+#pragma once
+
+// =============================================================================
+// VENPOD Region File - One file per 32×32×32 chunks of saved world
+// Layout, in 4 KB sectors:
+//   sector 0       header (magic, version, region size)
+//   sectors 1-64   offset table: per chunk {first sector, byte length}, 0 = absent
+//   sectors 65+    chunk blobs, each starting on a sector boundary
+// Reads go through a read-only memory map: a stored chunk is a pointer into
+// the mapping plus its length, with no read() copy. Writes always go to the
+// first free run (or the end of the file), never over the chunk's current
+// blob: its sectors are only freed by the next Flush, once the new table
+// entry is on disk, so a torn write leaves the previous blob readable.
+// Table entries reach the file only in Flush, after a sync of the blobs they
+// point to, so the disk never holds an entry for a blob it does not have.
+// Sectors are never moved, so the file only grows.
+// =============================================================================
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <utility>
+#include <vector>
+#include "ChunkCoord.h"
+#include "../Utils/FileUtils.h"
+#include "../Utils/Result.h"
+
+namespace VENPOD::Simulation {
+
+static constexpr int32_t REGION_CHUNKS = 32;                // Chunks per region edge
+static constexpr uint32_t REGION_CHUNK_COUNT = REGION_CHUNKS * REGION_CHUNKS * REGION_CHUNKS;
+static constexpr uint32_t REGION_SECTOR_BYTES = 4096;
+
+class RegionFile {
+public:
+    RegionFile() = default;
+    ~RegionFile() = default;
+
+    // Non-copyable
+    RegionFile(const RegionFile&) = delete;
+    RegionFile& operator=(const RegionFile&) = delete;
+
+    // Open an existing region file, or create an empty one when `create` is set
+    Result<void> Open(const std::filesystem::path& path, bool create);
+    void Close();
+    bool IsOpen() const { return m_writer.IsOpen(); }
+
+    // Region containing a chunk, and the chunk's slot in it
+    static ChunkCoord RegionOf(const ChunkCoord& chunk);
+    static uint32_t SlotOf(const ChunkCoord& chunk);
+
+    bool Contains(uint32_t slot) const { return m_table[slot].length != 0; }
+
+    // Stored blob of a slot, pointing into the mapping (empty when absent).
+    // Valid until the next Write or Close.
+    std::span<const uint8_t> Read(uint32_t slot);
+
+    // Store (replace) a slot's blob. Read sees it at once; the file's table
+    // entry is published by the next Flush.
+    Result<void> Write(uint32_t slot, const uint8_t* data, size_t size);
+
+    // Sync written blobs, then write and sync their table entries, then
+    // release the sectors of the blobs they replaced
+    Result<void> Flush();
+
+    uint32_t GetChunkCount() const { return m_chunkCount; }
+    uint64_t GetFileBytes() const { return static_cast<uint64_t>(m_sectorUsed.size()) * REGION_SECTOR_BYTES; }
+    uint32_t GetFreeSectorCount() const;
+
+private:
+    struct TableEntry {
+        uint32_t sector;    // First sector of the blob
+        uint32_t length;    // Blob bytes, 0 = no chunk
+    };
+
+    static constexpr uint32_t HEADER_SECTORS = 1;
+    static constexpr uint32_t TABLE_SECTORS = REGION_CHUNK_COUNT * sizeof(TableEntry) / REGION_SECTOR_BYTES;
+    static constexpr uint32_t FIRST_BLOB_SECTOR = HEADER_SECTORS + TABLE_SECTORS;
+
+    static uint32_t SectorsFor(size_t bytes) {
+        return static_cast<uint32_t>((bytes + REGION_SECTOR_BYTES - 1) / REGION_SECTOR_BYTES);
+    }
+
+    Result<void> CreateEmpty();
+    Result<void> LoadTable();
+    // First run of `count` free sectors (may extend past the end of the file)
+    uint32_t AllocateSectors(uint32_t count);
+    void MarkSectors(uint32_t first, uint32_t count, bool used);
+
+    std::filesystem::path m_path;
+    Utils::MappedFile m_mapping;
+    Utils::WritableFile m_writer;
+    bool m_mappingStale = false;            // File grew since it was mapped
+
+    std::vector<TableEntry> m_table;
+    std::vector<bool> m_sectorUsed;         // One flag per sector in the file
+    uint32_t m_firstFreeHint = FIRST_BLOB_SECTOR;   // No free sector below this
+    std::vector<uint8_t> m_padding;         // Zero tail for sector-aligned writes
+    // Sectors of replaced blobs {first, count}, still referenced on disk until the next Flush
+    std::vector<std::pair<uint32_t, uint32_t>> m_pendingFree;
+    std::vector<uint32_t> m_pendingSlots;   // Slots whose table entry is not in the file yet
+    uint32_t m_chunkCount = 0;
+};
+
+} // namespace VENPOD::Simulation
@@ -0,0 +1,489 @@
+#include "RegionStore.h"
+#include <spdlog/spdlog.h>
+#include <cstring>
+#include <fmt/format.h>
+#include <utility>
+
+namespace VENPOD::Simulation {
+
+namespace {
+
+constexpr uint32_t JOURNAL_MAGIC = 0x4E524A56u;     // "VJRN"
+
+// Precedes every blob in the journal
+struct JournalRecord {
+    uint32_t magic;
+    int32_t x, y, z;
+    uint32_t size;          // Blob bytes that follow
+    uint32_t checksum;      // Of the blob, so a torn append is detected
+};
+
+} // namespace
+
+RegionStore::~RegionStore() {
+    Close();
+}
+
+Result<void> RegionStore::Open(const std::filesystem::path& directory) {
+    Close();
+
+    std::error_code error;
+    std::filesystem::create_directories(directory, error);
+    if (error) {
+        return Error("RegionStore::Open - cannot create {}: {}", directory.string(), error.message());
+    }
+    m_directory = directory;
+    m_stats = {};
+
+    auto result = OpenJournal();
+    if (!result) {
+        Close();
+        return result;
+    }
+
+    spdlog::info("RegionStore opened - {}", directory.string());
+    return {};
+}
+
+void RegionStore::Close() {
+    if (!IsOpen()) {
+        return;
+    }
+    if (m_journal.IsOpen()) {
+        auto compacted = CompactJournal(SIZE_MAX);
+        if (!compacted) {
+            spdlog::warn("RegionStore::Close - journal left for replay: {}", compacted.error());
+        }
+    }
+    auto result = Flush();
+    if (!result) {
+        spdlog::warn("RegionStore::Close - {}", result.error());
+    }
+    m_regions.Clear();
+    m_openRegionCount = 0;
+    m_journalMapping.Close();
+    m_journal.Close();
+    m_journalSize = 0;
+    m_journalDirty = false;
+    m_journalIndex.Clear();
+    m_compactQueue.clear();
+    m_compactCursor = 0;
+    m_directory.clear();
+}
+
+std::filesystem::path RegionStore::GetRegionPath(const ChunkCoord& region) const {
+    return m_directory / fmt::format("r.{}.{}.{}.vrg", region.x, region.y, region.z);
+}
+
+Result<RegionFile*> RegionStore::GetRegion(const ChunkCoord& chunk, bool create) {
+    const ChunkCoord region = RegionFile::RegionOf(chunk);
+    RegionSlot* slot = m_regions.Find(region);
+
+    // Known region: open, or known to have no file
+    if (slot && (slot->file || !create)) {
+        slot->lastUse = ++m_useCounter;
+        return Result<RegionFile*>::Ok(slot->file.get());
+    }
+
+    const std::filesystem::path path = GetRegionPath(region);
+    std::error_code error;
+    if (!create && !std::filesystem::exists(path, error)) {
+        m_regions.Insert(region, RegionSlot{});
+        return Result<RegionFile*>::Ok(nullptr);
+    }
+
+    if (m_openRegionCount >= MAX_OPEN_REGIONS) {
+        CloseLeastRecentlyUsed();
+    }
+    auto file = std::make_unique<RegionFile>();
+    auto result = file->Open(path, create);
+    if (!result) {
+        if (!create) {
+            // Unreadable region: don't retry for every chunk in it
+            m_regions.Insert(region, RegionSlot{});
+        }
+        return Result<RegionFile*>::Err(result.error());
+    }
+
+    RegionFile* opened = file.get();
+    m_regions.Insert(region, RegionSlot{ std::move(file), ++m_useCounter });
+    ++m_openRegionCount;
+    return Result<RegionFile*>::Ok(opened);
+}
+
+void RegionStore::CloseLeastRecentlyUsed() {
+    const ChunkCoord* oldest = nullptr;
+    uint64_t oldestUse = UINT64_MAX;
+    for (const auto& [region, slot] : m_regions) {
+        if (slot.file && slot.lastUse < oldestUse) {
+            oldest = &region;
+            oldestUse = slot.lastUse;
+        }
+    }
+    if (!oldest) {
+        return;
+    }
+
+    // Erased rather than nulled: the file exists and is reopened on next use
+    const ChunkCoord region = *oldest;
+    RegionSlot* slot = m_regions.Find(region);
+    auto result = slot->file->Flush();
+    if (!result) {
+        spdlog::warn("RegionStore - {}", result.error());
+    }
+    m_regions.Erase(region);
+    --m_openRegionCount;
+}
+
+Result<bool> RegionStore::LoadChunk(const ChunkCoord& coord, PalettedVoxels& out) {
+    // The journal holds the newest copy of a chunk until it is compacted
+    std::span<const uint8_t> blob;
+    if (const JournalEntry* entry = m_journalIndex.Find(coord)) {
+        blob = ReadJournal(entry->offset, entry->size);
+    } else {
+        auto region = GetRegion(coord, false);
+        if (!region) {
+            return Result<bool>::Err(region.error());
+        }
+        RegionFile* file = region.Value();
+        blob = file ? file->Read(RegionFile::SlotOf(coord)) : std::span<const uint8_t>{};
+    }
+    if (blob.empty()) {
+        ++m_stats.misses;
+        return Result<bool>::Ok(false);
+    }
+
+    // Decoded straight from the mapping
+    if (!DecodeBlob(blob, out)) {
+        ++m_stats.corruptBlobs;
+        spdlog::warn("RegionStore - chunk [{},{},{}] is damaged, ignoring it", coord.x, coord.y, coord.z);
+        return Result<bool>::Ok(false);
+    }
+
+    ++m_stats.loads;
+    return Result<bool>::Ok(true);
+}
+
+Result<bool> RegionStore::LoadChunk(const ChunkCoord& coord, uint32_t edge, uint32_t worldSeed, PalettedVoxels& out) {
+    PalettedVoxels loaded;
+    auto found = LoadChunk(coord, loaded);
+    if (!found || !found.Value()) {
+        return found;
+    }
+
+    int32_t originX, originY, originZ;
+    int32_t savedX, savedY, savedZ;
+    uint32_t savedSeed;
+    coord.GetWorldOrigin(originX, originY, originZ, edge);
+    if (loaded.GetEdge() != edge || !loaded.GetVariantOrigin(savedX, savedY, savedZ, savedSeed) ||
+        savedX != originX || savedY != originY || savedZ != originZ || savedSeed != worldSeed) {
+        spdlog::warn("RegionStore - chunk [{},{},{}] does not belong to this world, ignoring it", coord.x, coord.y, coord.z);
+        return Result<bool>::Ok(false);
+    }
+    out = std::move(loaded);
+    return Result<bool>::Ok(true);
+}
+
+Result<void> RegionStore::SaveChunk(const ChunkCoord& coord, const PalettedVoxels& voxels) {
+    if (m_journalIndex.Find(coord)) {
+        return JournalChunk(coord, voxels);
+    }
+    if (!voxels.IsInitialized()) {
+        return Error("RegionStore::SaveChunk - chunk [{},{},{}] has no voxels", coord.x, coord.y, coord.z);
+    }
+
+    EncodeBlob(voxels);
+    auto result = WriteRegionBlob(coord, m_blobScratch.data(), m_blobScratch.size());
+    if (!result) {
+        return result;
+    }
+    ++m_stats.saves;
+    m_stats.bytesWritten += m_blobScratch.size();
+    return {};
+}
+
+Result<void> RegionStore::WriteRegionBlob(const ChunkCoord& coord, const uint8_t* blob, size_t size) {
+    auto region = GetRegion(coord, true);
+    if (!region) {
+        return Error("RegionStore - {}", region.error());
+    }
+    return region.Value()->Write(RegionFile::SlotOf(coord), blob, size);
+}
+
+void RegionStore::EncodeBlob(const PalettedVoxels& voxels) {
+    // Header first, payload after it; the checksum is patched in afterwards
+    m_blobScratch.assign(sizeof(BlobHeader), 0);
+    if (m_codec == ChunkBlobCodec::PalettedLZ) {
+        m_imageScratch.clear();
+        voxels.Serialize(m_imageScratch);
+        const uint32_t imageSize = static_cast<uint32_t>(m_imageScratch.size());
+        m_blobScratch.resize(sizeof(BlobHeader) + sizeof(imageSize) + Utils::LZCompressBound(imageSize));
+        std::memcpy(m_blobScratch.data() + sizeof(BlobHeader), &imageSize, sizeof(imageSize));
+        const size_t blockSize = m_compressor.Compress(m_imageScratch.data(), imageSize,
+                                                       m_blobScratch.data() + sizeof(BlobHeader) + sizeof(imageSize));
+        m_blobScratch.resize(sizeof(BlobHeader) + sizeof(imageSize) + blockSize);
+    } else {
+        voxels.Serialize(m_blobScratch);
+    }
+    const BlobHeader header{ m_codec,
+                             Checksum(m_blobScratch.data() + sizeof(BlobHeader), m_blobScratch.size() - sizeof(BlobHeader)) };
+    std::memcpy(m_blobScratch.data(), &header, sizeof(header));
+}
+
+bool RegionStore::DecodeBlob(std::span<const uint8_t> blob, PalettedVoxels& out) {
+    BlobHeader header;
+    if (blob.size() < sizeof(header)) {
+        return false;
+    }
+    std::memcpy(&header, blob.data(), sizeof(header));
+    const uint8_t* payload = blob.data() + sizeof(header);
+    const size_t payloadSize = blob.size() - sizeof(header);
+    return header.checksum == Checksum(payload, payloadSize) && DecodePayload(header.codec, payload, payloadSize, out);
+}
+
+bool RegionStore::DecodePayload(ChunkBlobCodec codec, const uint8_t* payload, size_t size, PalettedVoxels& out) {
+    switch (codec) {
+        case ChunkBlobCodec::Paletted:
+            return out.Deserialize(payload, size);
+
+        case ChunkBlobCodec::PalettedLZ: {
+            uint32_t imageSize;
+            if (size < sizeof(imageSize)) {
+                return false;
+            }
+            std::memcpy(&imageSize, payload, sizeof(imageSize));
+            if (imageSize > static_cast<uint64_t>(size) * 255) {
+                return false;           // Beyond any LZ ratio: a damaged size
+            }
+            m_imageScratch.resize(imageSize);
+            return Utils::LZDecompress(payload + sizeof(imageSize), size - sizeof(imageSize), m_imageScratch.data(),
+                                       imageSize) &&
+                   out.Deserialize(m_imageScratch.data(), imageSize);
+        }
+    }
+    return false;
+}
+
+bool RegionStore::HasChunk(const ChunkCoord& coord) {
+    if (m_journalIndex.Contains(coord)) {
+        return true;
+    }
+    auto region = GetRegion(coord, false);
+    return region && region.Value() && region.Value()->Contains(RegionFile::SlotOf(coord));
+}
+
+Result<void> RegionStore::Flush() {
+    auto result = CommitJournal();
+    if (!result) {
+        return result;
+    }
+    return FlushRegions();
+}
+
+Result<void> RegionStore::FlushRegions() {
+    for (auto& [region, slot] : m_regions) {
+        if (!slot.file) {
+            continue;
+        }
+        auto result = slot.file->Flush();
+        if (!result) {
+            return result;
+        }
+    }
+    return {};
+}
+
+// =============================================================================
+// Journal
+// =============================================================================
+
+Result<void> RegionStore::OpenJournal() {
+    const std::filesystem::path path = GetJournalPath();
+    auto result = m_journal.Open(path);
+    if (!result) {
+        return result;
+    }
+    result = m_journalMapping.Open(path);
+    if (!result) {
+        return result;
+    }
+
+    // ===== Replay: every intact record, in order, into its region =====
+    const uint8_t* data = m_journalMapping.GetData();
+    const size_t size = m_journalMapping.GetSize();
+    size_t offset = 0;
+    uint64_t replayed = 0;
+    while (size - offset >= sizeof(JournalRecord)) {
+        JournalRecord record;
+        std::memcpy(&record, data + offset, sizeof(record));
+        const uint8_t* blob = data + offset + sizeof(record);
+        if (record.magic != JOURNAL_MAGIC || record.size > size - offset - sizeof(record) ||
+            record.checksum != Checksum(blob, record.size)) {
+            break;
+        }
+        result = WriteRegionBlob(ChunkCoord{ record.x, record.y, record.z }, blob, record.size);
+        if (!result) {
+            return Error("RegionStore - journal replay failed: {}", result.error());
+        }
+        offset += sizeof(record) + record.size;
+        ++replayed;
+    }
+    if (size == 0) {
+        return {};
+    }
+    if (offset < size) {
+        // Torn tail from a crash mid-append (never committed)
+        spdlog::warn("RegionStore - discarded {} bytes of incomplete journal", size - offset);
+    }
+
+    // Regions durable before the journal goes
+    m_stats.replayed = replayed;
+    spdlog::info("RegionStore - replayed {} journaled chunk(s)", replayed);
+    result = FlushRegions();
+    if (!result) {
+        return result;
+    }
+    return ResetJournal();
+}
+
+Result<void> RegionStore::ResetJournal() {
+    // Windows cannot truncate a file with a mapped view
+    m_journalMapping.Close();
+    auto result = m_journal.Truncate(0);
+    if (!result) {
+        return result;
+    }
+    result = m_journal.Sync();
+    if (!result) {
+        return result;
+    }
+    m_journalSize = 0;
+    m_journalDirty = false;
+    m_journalIndex.Clear();
+    m_compactQueue.clear();
+    m_compactCursor = 0;
+    return {};
+}
+
+std::span<const uint8_t> RegionStore::ReadJournal(uint64_t offset, size_t size) {
+    if (offset + size > m_journalMapping.GetSize()) {
+        // Appended since it was mapped (or closed by ResetJournal)
+        auto result = m_journalMapping.IsOpen() ? m_journalMapping.Remap() : m_journalMapping.Open(GetJournalPath());
+        if (!result) {
+            spdlog::warn("RegionStore - {}", result.error());
+            return {};
+        }
+        if (offset + size > m_journalMapping.GetSize()) {
+            return {};
+        }
+    }
+    return std::span<const uint8_t>(m_journalMapping.GetData() + offset, size);
+}
+
+Result<void> RegionStore::JournalChunk(const ChunkCoord& coord, const PalettedVoxels& voxels) {
+    if (!m_journal.IsOpen()) {
+        return Error("RegionStore::JournalChunk - store is not open");
+    }
+    if (!voxels.IsInitialized()) {
+        return Error("RegionStore::JournalChunk - chunk [{},{},{}] has no voxels", coord.x, coord.y, coord.z);
+    }
+
+    // Record, then the blob; a crash between them leaves a record that fails its checksum
+    EncodeBlob(voxels);
+    const size_t blobSize = m_blobScratch.size();
+    const JournalRecord record{ JOURNAL_MAGIC, coord.x, coord.y, coord.z, static_cast<uint32_t>(blobSize),
+                                Checksum(m_blobScratch.data(), blobSize) };
+    auto result = m_journal.WriteAt(m_journalSize, &record, sizeof(record));
+    if (result) {
+        result = m_journal.WriteAt(m_journalSize + sizeof(record), m_blobScratch.data(), blobSize);
+    }
+    if (!result) {
+        return result;
+    }
+
+    // Newest copy wins; requeue a chunk whose older copy was already compacted
+    JournalEntry* entry = m_journalIndex.Find(coord);
+    if (!entry || entry->compacted) {
+        m_compactQueue.push_back(coord);
+    }
+    m_journalIndex.Insert(coord, JournalEntry{ m_journalSize + sizeof(record), static_cast<uint32_t>(blobSize), false });
+
+    m_journalSize += sizeof(record) + blobSize;
+    m_journalDirty = true;
+    ++m_stats.journaled;
+    m_stats.journalBytes += sizeof(record) + blobSize;
+    return {};
+}
+
+Result<void> RegionStore::CommitJournal() {
+    if (!m_journalDirty) {
+        return {};
+    }
+    auto result = m_journal.Sync();
+    if (!result) {
+        return result;
+    }
+    m_journalDirty = false;
+    return {};
+}
+
+Result<size_t> RegionStore::CompactJournal(size_t maxChunks) {
+    if (m_journalSize == 0) {
+        return Result<size_t>::Ok(0);
+    }
+
+    // Only committed records move: a region must never get ahead of the journal
+    auto result = CommitJournal();
+    if (!result) {
+        return Result<size_t>::Err(result.error());
+    }
+
+    // ===== STEP 1: Move journaled blobs into their regions =====
+    size_t moved = 0;
+    while (moved < maxChunks && m_compactCursor < m_compactQueue.size()) {
+        const ChunkCoord coord = m_compactQueue[m_compactCursor];
+        JournalEntry* entry = m_journalIndex.Find(coord);
+        std::span<const uint8_t> blob = ReadJournal(entry->offset, entry->size);
+        if (blob.empty()) {
+            return MakeError<size_t>("RegionStore - journal entry of [{},{},{}] is unreadable", coord.x, coord.y, coord.z);
+        }
+        result = WriteRegionBlob(coord, blob.data(), blob.size());
+        if (!result) {
+            return Result<size_t>::Err(result.error());
+        }
+        entry->compacted = true;
+        ++m_compactCursor;
+        ++moved;
+        ++m_stats.compacted;
+    }
+
+    // ===== STEP 2: All in - sync the regions, then drop the journal =====
+    if (m_compactCursor == m_compactQueue.size()) {
+        result = FlushRegions();
+        if (result) {
+            result = ResetJournal();
+        }
+        if (!result) {
+            return Result<size_t>::Err(result.error());
+        }
+    }
+    return Result<size_t>::Ok(moved);
+}
+
+uint32_t RegionStore::Checksum(const uint8_t* data, size_t size) {
+    // FNV-1a over 8-byte words (byte-wise tail): catches torn and bit-rotted blobs
+    uint64_t hash = 0xCBF29CE484222325ull;
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        uint64_t word;
+        std::memcpy(&word, data + i, sizeof(word));
+        hash = (hash ^ word) * 0x100000001B3ull;
+        hash ^= hash >> 32;
+    }
+    for (; i < size; ++i) {
+        hash = (hash ^ data[i]) * 0x100000001B3ull;
+    }
+    return static_cast<uint32_t>(hash ^ (hash >> 32));
+}
+
+} // namespace VENPOD::Simulation
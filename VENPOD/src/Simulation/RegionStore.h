@@ -0,0 +1,168 @@
+#pragma once
+
+// =============================================================================
+// VENPOD Region Store - Saved chunks of one world, in a directory of region files
+// Chunks are stored as blobs in RegionFiles named r.<x>.<y>.<z>.vrg (region
+// coordinates). A blob is a small header (codec, checksum) followed by the
+// chunk's PalettedVoxels image - as is, or LZ-compressed (Utils/BlockCompression)
+// - so loading a chunk is a table lookup in the mapped region file, a checksum,
+// an optional decompress and a Deserialize - no generation, no read() copy.
+// Blobs of either codec load whatever SetCodec says for new saves. Regions
+// are opened on first use and the least recently used ones are closed past
+// MAX_OPEN_REGIONS. Main-thread only (not thread-safe).
+//
+// Write-ahead journal: autosaves append modified chunks to journal.vjl (one
+// sequential write per chunk, one sync per checkpoint) instead of rewriting
+// region files, so their cost scales with the edits, not the world.
+// CompactJournal moves journaled chunks into the region files a budget at a
+// time and empties the journal once all are in. Open replays a journal left
+// behind by a crash, up to its last intact record; Close compacts it.
+// =============================================================================
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <span>
+#include <vector>
+#include "ChunkCoord.h"
+#include "ChunkCoordMap.h"
+#include "PalettedVoxels.h"
+#include "RegionFile.h"
+#include "../Utils/BlockCompression.h"
+#include "../Utils/FileUtils.h"
+#include "../Utils/Result.h"
+
+namespace VENPOD::Simulation {
+
+// How a stored chunk blob's payload is encoded
+enum class ChunkBlobCodec : uint32_t {
+    Paletted = 1,       // PalettedVoxels::Serialize
+    PalettedLZ = 2,     // uint32 image size, then the image as one LZ block
+};
+
+struct RegionStoreStats {
+    uint64_t loads = 0;             // Chunks found and decoded
+    uint64_t misses = 0;            // Lookups of chunks never saved
+    uint64_t saves = 0;
+    uint64_t bytesWritten = 0;      // Blob bytes (before sector padding)
+    uint64_t corruptBlobs = 0;      // Failed checksum / decode, treated as missing
+    uint64_t journaled = 0;         // Chunks appended to the journal
+    uint64_t journalBytes = 0;      // Journal bytes appended (records + blobs)
+    uint64_t compacted = 0;         // Journaled chunks moved into region files
+    uint64_t replayed = 0;          // Journal records recovered by Open
+};
+
+class RegionStore {
+public:
+    RegionStore() = default;
+    ~RegionStore();
+
+    // Non-copyable
+    RegionStore(const RegionStore&) = delete;
+    RegionStore& operator=(const RegionStore&) = delete;
+
+    // Use `directory` (created if missing) for the world's region files,
+    // replaying any journal a crash left there
+    Result<void> Open(const std::filesystem::path& directory);
+    // Compacts the journal, flushes and closes every region
+    void Close();
+    bool IsOpen() const { return !m_directory.empty(); }
+
+    // Encoding of chunks saved from now on (default Paletted)
+    void SetCodec(ChunkBlobCodec codec) { m_codec = codec; }
+    ChunkBlobCodec GetCodec() const { return m_codec; }
+
+    // Load a saved chunk into `out`. Returns false (out untouched) when the
+    // chunk was never saved or its blob is damaged.
+    Result<bool> LoadChunk(const ChunkCoord& coord, PalettedVoxels& out);
+    // The same for a chunk of `edge`³ voxels of the world `worldSeed`: a blob
+    // of another chunk size, position or world (which would overrun an
+    // upload buffer or decode wrong variants) is also ignored
+    Result<bool> LoadChunk(const ChunkCoord& coord, uint32_t edge, uint32_t worldSeed, PalettedVoxels& out);
+    // Write straight into the region file (through the journal when the
+    // chunk is still journaled, so replay cannot bring back an older copy)
+    Result<void> SaveChunk(const ChunkCoord& coord, const PalettedVoxels& voxels);
+    // Saved in a region file or still only in the journal
+    bool HasChunk(const ChunkCoord& coord);
+
+    // ===== Journal =====
+    // Append a chunk to the journal; durable after the next CommitJournal
+    Result<void> JournalChunk(const ChunkCoord& coord, const PalettedVoxels& voxels);
+    // Sync the journal: everything appended so far survives a crash
+    Result<void> CommitJournal();
+    // Move up to maxChunks journaled chunks into their region files. Once
+    // none are left the regions are synced and the journal emptied.
+    // Returns the chunks moved.
+    Result<size_t> CompactJournal(size_t maxChunks);
+    size_t GetJournalPendingCount() const { return m_compactQueue.size() - m_compactCursor; }
+    uint64_t GetJournalBytes() const { return m_journalSize; }
+
+    // Force everything written so far (journal and regions) to disk
+    Result<void> Flush();
+
+    const RegionStoreStats& GetStats() const { return m_stats; }
+    size_t GetOpenRegionCount() const { return m_openRegionCount; }
+    std::filesystem::path GetRegionPath(const ChunkCoord& region) const;
+    std::filesystem::path GetJournalPath() const { return m_directory / "journal.vjl"; }
+
+    static constexpr size_t MAX_OPEN_REGIONS = 16;
+
+private:
+    struct BlobHeader {
+        ChunkBlobCodec codec;
+        uint32_t checksum;          // Of the payload
+    };
+
+    struct RegionSlot {
+        std::unique_ptr<RegionFile> file;   // Null: no file on disk for this region
+        uint64_t lastUse = 0;
+    };
+
+    // Latest journaled blob of a chunk
+    struct JournalEntry {
+        uint64_t offset = 0;        // Of the blob in the journal
+        uint32_t size = 0;
+        bool compacted = false;     // Also in its region file now
+    };
+
+    // Open region of a chunk; null when it has no file and `create` is false
+    Result<RegionFile*> GetRegion(const ChunkCoord& chunk, bool create);
+    void CloseLeastRecentlyUsed();
+
+    // Encode a chunk into m_blobScratch (header, payload) with the current codec
+    void EncodeBlob(const PalettedVoxels& voxels);
+    // Validate and decode a stored blob of any codec
+    bool DecodeBlob(std::span<const uint8_t> blob, PalettedVoxels& out);
+    bool DecodePayload(ChunkBlobCodec codec, const uint8_t* payload, size_t size, PalettedVoxels& out);
+    Result<void> WriteRegionBlob(const ChunkCoord& coord, const uint8_t* blob, size_t size);
+    Result<void> FlushRegions();
+
+    // Open journal.vjl, moving any records in it into the region files
+    Result<void> OpenJournal();
+    std::span<const uint8_t> ReadJournal(uint64_t offset, size_t size);
+    Result<void> ResetJournal();
+
+    static uint32_t Checksum(const uint8_t* data, size_t size);
+
+    std::filesystem::path m_directory;
+    ChunkCoordMap<RegionSlot> m_regions;
+    size_t m_openRegionCount = 0;
+    uint64_t m_useCounter = 0;
+    ChunkBlobCodec m_codec = ChunkBlobCodec::Paletted;
+    std::vector<uint8_t> m_blobScratch;
+    std::vector<uint8_t> m_imageScratch;        // Uncompressed image (PalettedLZ)
+    Utils::LZCompressor m_compressor;
+    RegionStoreStats m_stats;
+
+    // Journal: appended at m_journalSize, read back through its own mapping
+    Utils::WritableFile m_journal;
+    Utils::MappedFile m_journalMapping;
+    uint64_t m_journalSize = 0;
+    bool m_journalDirty = false;                // Appended since the last sync
+    ChunkCoordMap<JournalEntry> m_journalIndex;
+    std::vector<ChunkCoord> m_compactQueue;     // Journaled chunks in append order
+    size_t m_compactCursor = 0;                 // Queue entries before this are compacted
+};
+
+} // namespace VENPOD::Simulation
@@ -0,0 +1,79 @@
+#include "SimulationClock.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+namespace VENPOD::Simulation {
+
+// Weight of the newest tick in averageTickMs
+static constexpr double TICK_COST_SMOOTHING = 0.05;
+
+void SimulationClock::Initialize(const SimulationClockConfig& config) {
+    m_config = config;
+    m_config.ticksPerSecond = std::max(m_config.ticksPerSecond, 1u);
+    m_config.substeps = std::max(m_config.substeps, 1u);
+    m_config.maxStepsPerUpdate = std::max(m_config.maxStepsPerUpdate, 1u);
+    m_config.maxCatchUpSeconds = std::max(m_config.maxCatchUpSeconds, 0.0);
+
+    m_stepSeconds = 1.0 / m_config.ticksPerSecond;
+    Reset();
+}
+
+void SimulationClock::Reset() {
+    m_accumulator = 0.0;
+    m_stats = {};
+}
+
+uint32_t SimulationClock::Update(double elapsedSeconds, const TickFunction& tick) {
+    uint32_t steps = 0;
+
+    elapsedSeconds = std::max(elapsedSeconds, 0.0);
+    m_stats.wallSeconds += elapsedSeconds;
+
+    if (m_config.unthrottled) {
+        steps = m_config.maxStepsPerUpdate;
+    } else {
+        m_accumulator += elapsedSeconds;
+
+        // ===== Catch-up cap: drop lag the simulation can't make up =====
+        double maxLag = std::max(m_config.maxCatchUpSeconds, m_stepSeconds);
+        if (m_accumulator > maxLag) {
+            double dropped = std::floor((m_accumulator - maxLag) / m_stepSeconds) + 1.0;
+            m_stats.droppedSteps += static_cast<uint64_t>(dropped);
+            m_accumulator -= dropped * m_stepSeconds;
+        }
+
+        steps = std::min(static_cast<uint32_t>(m_accumulator / m_stepSeconds), m_config.maxStepsPerUpdate);
+        m_accumulator -= steps * m_stepSeconds;
+    }
+
+    // ===== Run the due fixed steps, `substeps` ticks each =====
+    const float tickSeconds = static_cast<float>(GetTickSeconds());
+    uint32_t ticksRun = 0;
+    for (uint32_t step = 0; step < steps; ++step) {
+        for (uint32_t substep = 0; substep < m_config.substeps; ++substep) {
+            SimulationTick info;
+            info.index = m_stats.ticks;
+            info.substep = substep;
+            info.deltaTime = tickSeconds;
+
+            auto start = std::chrono::steady_clock::now();
+            tick(info);
+            double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+            m_stats.lastTickMs = ms;
+            m_stats.maxTickMs = std::max(m_stats.maxTickMs, ms);
+            m_stats.averageTickMs = m_stats.ticks == 0
+                ? ms : m_stats.averageTickMs + (ms - m_stats.averageTickMs) * TICK_COST_SMOOTHING;
+            m_stats.ticks++;
+            ++ticksRun;
+        }
+        m_stats.simulatedSeconds += m_stepSeconds;
+    }
+
+    m_stats.lastUpdateTicks = ticksRun;
+    m_stats.lagMs = m_accumulator * 1000.0;
+    return ticksRun;
+}
+
+} // namespace VENPOD::Simulation
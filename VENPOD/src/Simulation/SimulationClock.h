@@ -0,0 +1,81 @@
+#pragma once
+
+// =============================================================================
+// VENPOD Simulation Clock - Fixed-timestep tick scheduler
+// Decouples physics ticks from rendered frames: wall time is accumulated and
+// converted into a fixed number of ticks per second, each split into
+// `substeps` physics ticks. A stalled frame is made up on the next one, but
+// only up to maxCatchUpSeconds of lag so a slow simulation cannot spiral.
+// In unthrottled mode (headless benchmarks) every Update runs a fixed batch
+// of ticks back to back, ignoring wall time.
+// =============================================================================
+
+#include <cstdint>
+#include <functional>
+
+namespace VENPOD::Simulation {
+
+struct SimulationClockConfig {
+    uint32_t ticksPerSecond = 60;       // Fixed steps per wall-clock second
+    uint32_t substeps = 1;              // Physics ticks per fixed step
+    double maxCatchUpSeconds = 0.25;    // Lag beyond this is dropped instead of simulated
+    uint32_t maxStepsPerUpdate = 8;     // Fixed steps run by one Update at most (batch size when unthrottled)
+    bool unthrottled = false;           // Ignore wall time and run maxStepsPerUpdate steps per Update
+};
+
+// One physics tick handed to the tick callback
+struct SimulationTick {
+    uint64_t index = 0;         // Monotonic tick counter (seeds the per-voxel RNG)
+    uint32_t substep = 0;       // Substep within the fixed step, [0, substeps)
+    float deltaTime = 0.0f;     // Seconds of simulated time per tick
+};
+
+struct SimulationClockStats {
+    uint64_t ticks = 0;             // Physics ticks run since Initialize/Reset
+    uint64_t droppedSteps = 0;      // Fixed steps discarded by the catch-up cap
+    uint32_t lastUpdateTicks = 0;   // Ticks run by the most recent Update
+    double lagMs = 0.0;             // Accumulated wall time not simulated yet
+    double lastTickMs = 0.0;        // Cost of the most recent tick
+    double averageTickMs = 0.0;     // Exponential moving average of the tick cost
+    double maxTickMs = 0.0;         // Most expensive tick since Initialize/Reset
+    double simulatedSeconds = 0.0;  // Simulated time since Initialize/Reset
+    double wallSeconds = 0.0;       // Wall time fed to Update since Initialize/Reset
+};
+
+class SimulationClock {
+public:
+    using TickFunction = std::function<void(const SimulationTick&)>;
+
+    SimulationClock() = default;
+    ~SimulationClock() = default;
+
+    // Non-copyable
+    SimulationClock(const SimulationClock&) = delete;
+    SimulationClock& operator=(const SimulationClock&) = delete;
+
+    void Initialize(const SimulationClockConfig& config = {});
+
+    // Clear the accumulator and counters (after a pause or a world reload)
+    void Reset();
+
+    // Feed the wall time since the previous Update and run every tick that is
+    // due through `tick`. Returns the number of ticks run.
+    uint32_t Update(double elapsedSeconds, const TickFunction& tick);
+
+    // Seconds of simulated time per physics tick
+    double GetTickSeconds() const { return m_stepSeconds / m_config.substeps; }
+
+    // Fraction of a fixed step accumulated but not simulated yet, for interpolation
+    float GetAlpha() const { return static_cast<float>(m_accumulator / m_stepSeconds); }
+
+    const SimulationClockConfig& GetConfig() const { return m_config; }
+    const SimulationClockStats& GetStats() const { return m_stats; }
+
+private:
+    SimulationClockConfig m_config;
+    double m_stepSeconds = 1.0 / 60.0;
+    double m_accumulator = 0.0;
+    SimulationClockStats m_stats;
+};
+
+} // namespace VENPOD::Simulation
@@ -0,0 +1,31 @@
+#pragma once
+
+// =============================================================================
+// VENPOD Simulation Constants - Shared by the GPU and CPU simulation paths
+// Header-only and platform-independent (no D3D12 includes)
+// =============================================================================
+
+#include <cstdint>
+
+namespace VENPOD::Simulation {
+
+// Chunk size in voxels (must be power of 2, must match shader constant)
+static constexpr uint32_t CHUNK_SIZE = 16;
+
+// Voxels per simulation chunk (16³ = 4096)
+static constexpr uint32_t CHUNK_VOXEL_COUNT = CHUNK_SIZE * CHUNK_SIZE * CHUNK_SIZE;
+
+// Dirty tracking granularity: a chunk is 4x4x4 bricks of 4³ voxels, one bit
+// each in a uint64_t mask (bit = bx + by * 4 + bz * 16)
+static constexpr uint32_t BRICK_SIZE = 4;
+static constexpr uint32_t CHUNK_BRICKS_PER_AXIS = CHUNK_SIZE / BRICK_SIZE;
+static constexpr uint32_t CHUNK_BRICK_COUNT = CHUNK_BRICKS_PER_AXIS * CHUNK_BRICKS_PER_AXIS * CHUNK_BRICKS_PER_AXIS;
+static_assert(CHUNK_BRICK_COUNT == 64, "Brick masks are stored in a uint64_t");
+
+// Brick bit of a voxel given its chunk-local coordinates
+constexpr uint32_t LocalBrickIndex(uint32_t lx, uint32_t ly, uint32_t lz) {
+    return (lx / BRICK_SIZE) + (ly / BRICK_SIZE) * CHUNK_BRICKS_PER_AXIS +
+           (lz / BRICK_SIZE) * CHUNK_BRICKS_PER_AXIS * CHUNK_BRICKS_PER_AXIS;
+}
+
+} // namespace VENPOD::Simulation
@@ -0,0 +1,81 @@
+#include "TerrainColumnCache.h"
+#include <vector>
+
+namespace VENPOD::Simulation {
+
+void TerrainColumnCache::Initialize(uint32_t chunkSize, uint32_t worldSeed) {
+    Shutdown();
+    m_chunkSize = chunkSize;
+    m_worldSeed = worldSeed;
+}
+
+void TerrainColumnCache::Shutdown() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_columns.Clear();
+    m_stats = {};
+}
+
+std::shared_ptr<const TerrainColumn> TerrainColumnCache::Acquire(int32_t chunkX, int32_t chunkZ) {
+    const ChunkCoord key{ chunkX, 0, chunkZ };
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (const auto* column = m_columns.Find(key)) {
+            ++m_stats.hits;
+            return *column;
+        }
+    }
+
+    // Compute outside the lock so workers on other columns don't wait
+    auto column = std::make_shared<TerrainColumn>();
+    const int32_t size = static_cast<int32_t>(m_chunkSize);
+    ComputeTerrainColumn(chunkX * size, chunkZ * size, m_chunkSize, m_worldSeed, *column);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    // Another worker may have computed the same column meanwhile: keep the first
+    if (const auto* existing = m_columns.Find(key)) {
+        ++m_stats.hits;
+        return *existing;
+    }
+    ++m_stats.misses;
+    m_columns.Insert(key, column);
+    return column;
+}
+
+size_t TerrainColumnCache::EvictOutside(int32_t centerX, int32_t centerZ, int32_t radius) {
+    const int64_t radiusSq = static_cast<int64_t>(radius) * radius;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    // Collect first: erasing shifts entries of the flat map under the iterator
+    std::vector<ChunkCoord> evicted;
+    for (const auto& [key, column] : m_columns) {
+        int64_t dx = static_cast<int64_t>(key.x) - centerX;
+        int64_t dz = static_cast<int64_t>(key.z) - centerZ;
+        if (dx * dx + dz * dz > radiusSq) {
+            evicted.push_back(key);
+        }
+    }
+    for (const ChunkCoord& key : evicted) {
+        m_columns.Erase(key);
+    }
+    m_stats.evictions += evicted.size();
+    return evicted.size();
+}
+
+size_t TerrainColumnCache::GetSize() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_columns.Size();
+}
+
+TerrainColumnCacheStats TerrainColumnCache::GetStats() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_stats;
+}
+
+size_t TerrainColumnCache::GetResidentBytes() const {
+    const size_t columnCount = static_cast<size_t>(m_chunkSize) * m_chunkSize;
+    const size_t bytesPerColumn = columnCount * (3 * sizeof(float) + sizeof(uint8_t)) + sizeof(TerrainColumn);
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_columns.Size() * bytesPerColumn;
+}
+
+} // namespace VENPOD::Simulation
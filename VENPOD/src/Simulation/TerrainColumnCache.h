@@ -0,0 +1,62 @@
+#pragma once
+
+// =============================================================================
+// VENPOD Terrain Column Cache - Per chunk column (x, z) terrain height and biome
+// GenerateTerrainHeight alone is 13 octaves of simplex noise, and it (with
+// the biome and shore noise) depends only on (x, z), so every vertically
+// stacked chunk of a column would recompute the same values. The cache keeps
+// one TerrainColumn per chunk column: computed by the first chunk generated
+// there, shared by all its Y layers, and evicted once the column leaves the
+// horizontal streaming radius. Safe to use from several generator threads.
+// =============================================================================
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include "ChunkCoordMap.h"
+#include "TerrainGenerator.h"
+
+namespace VENPOD::Simulation {
+
+struct TerrainColumnCacheStats {
+    uint64_t hits = 0;
+    uint64_t misses = 0;        // Columns computed
+    uint64_t evictions = 0;
+};
+
+class TerrainColumnCache {
+public:
+    TerrainColumnCache() = default;
+    ~TerrainColumnCache() = default;
+
+    // Non-copyable
+    TerrainColumnCache(const TerrainColumnCache&) = delete;
+    TerrainColumnCache& operator=(const TerrainColumnCache&) = delete;
+
+    void Initialize(uint32_t chunkSize, uint32_t worldSeed);
+    void Shutdown();
+
+    // Column of chunk column (chunkX, chunkZ), computed on first use. The
+    // pointer stays valid after eviction for as long as the caller holds it.
+    std::shared_ptr<const TerrainColumn> Acquire(int32_t chunkX, int32_t chunkZ);
+
+    // Drop columns beyond `radius` chunks (XZ distance, like the loading
+    // cylinder) from the chunk column (centerX, centerZ); returns how many
+    size_t EvictOutside(int32_t centerX, int32_t centerZ, int32_t radius);
+
+    size_t GetSize() const;
+    TerrainColumnCacheStats GetStats() const;
+    // Resident bytes of the cached columns
+    size_t GetResidentBytes() const;
+
+private:
+    uint32_t m_chunkSize = 64;
+    uint32_t m_worldSeed = 0;
+
+    mutable std::mutex m_mutex;
+    ChunkCoordMap<std::shared_ptr<const TerrainColumn>> m_columns;     // Keyed by { x, 0, z }
+    TerrainColumnCacheStats m_stats;
+};
+
+} // namespace VENPOD::Simulation
@@ -0,0 +1,481 @@
+#include "TerrainGenerator.h"
+#include "../Utils/BitPacking.h"
+#include "../Utils/PCGRandom.h"
+#include "../Utils/SimplexNoise.h"
+#include "../Utils/SimplexNoiseBatch.h"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace VENPOD::Simulation {
+
+using Utils::FBM3D;
+using Utils::RidgedNoise3D;
+using Utils::SimplexNoise3D;
+namespace Material = Utils::Material;
+
+// Sea level for oceans and lakes
+static constexpr float SEA_LEVEL = static_cast<float>(GENERATED_SEA_LEVEL);
+
+// Combine the height noise layers
+static float CombineTerrainHeight(float continents, float hills, float detail, float mountains) {
+    float height = 0.0f;
+    height += continents * 40.0f;                   // Large-scale elevation changes
+    height += hills * 25.0f;                        // Rolling terrain
+    height += detail * 8.0f;                        // Small bumps
+    height += std::max(0.0f, mountains) * 60.0f;    // Sharp mountain peaks (only positive)
+
+    // Base level at 60, with variation
+    height += 60.0f;
+
+    return std::clamp(height, 5.0f, static_cast<float>(GENERATED_MAX_TERRAIN_HEIGHT));
+}
+
+float GenerateTerrainHeight(float x, float z, uint32_t seed) {
+    // Add seed offset for variation
+    float px = x + static_cast<float>(seed) * 0.01f;
+    float py = 0.0f;
+    float pz = z + static_cast<float>(seed) * 0.01f;
+
+    // Base continent shape (very low frequency)
+    float continents = FBM3D(px * 0.0008f, py * 0.0008f, pz * 0.0008f, 2, 0.5f, 2.0f);
+
+    // Rolling hills (medium frequency)
+    float hills = FBM3D(px * 0.003f, py * 0.003f, pz * 0.003f, 4, 0.6f, 2.0f);
+
+    // Fine detail (high frequency)
+    float detail = FBM3D(px * 0.015f, py * 0.015f, pz * 0.015f, 3, 0.5f, 2.0f);
+
+    // Mountains (ridged noise for sharp peaks)
+    float mountains = RidgedNoise3D(px * 0.002f, py * 0.002f, pz * 0.002f, 4, 0.5f);
+
+    return CombineTerrainHeight(continents, hills, detail, mountains);
+}
+
+// Biome temperature (before the altitude falloff) and moisture
+static void ComputeClimate(float x, float z, uint32_t seed, float& outTemperature, float& outMoisture) {
+    float bx = x * 0.001f + static_cast<float>(seed) * 0.1f;
+    float by = 100.0f;
+    float bz = z * 0.001f + static_cast<float>(seed) * 0.1f;
+
+    // Temperature (decreases with height and latitude)
+    outTemperature = SimplexNoise3D(bx * 1.5f, by * 1.5f, bz * 1.5f) * 0.5f + 0.5f;
+
+    // Moisture
+    outMoisture = SimplexNoise3D(bx * 2.0f + 500.0f, by * 2.0f, bz * 2.0f) * 0.5f + 0.5f;
+}
+
+// Colder at high altitudes
+static float ApplyAltitude(float temperature, float height) {
+    return temperature - (height - 60.0f) * 0.003f;
+}
+
+uint8_t SelectSurfaceMaterial(float x, float z, uint32_t seed, float height, float seaLevel) {
+    float temperature, moisture;
+    ComputeClimate(x, z, seed, temperature, moisture);
+    return SelectSurfaceMaterial(height, ApplyAltitude(temperature, height), moisture, seaLevel);
+}
+
+uint8_t SelectSurfaceMaterial(float height, float temperature, float moisture, float seaLevel) {
+    // Underwater terrain gets different materials
+    if (height < seaLevel - 5.0f) {
+        return Material::Sand;  // Sandy ocean floor
+    }
+
+    // Determine surface material
+    if (temperature < 0.3f) {
+        return Material::Ice;  // Cold biome
+    } else if (temperature < 0.6f) {
+        return (moisture > 0.5f) ? Material::Dirt : Material::Stone;  // Temperate
+    } else {
+        return Material::Sand;  // Hot/desert
+    }
+}
+
+// Scratch rows for the batched noise calls (one set per thread)
+struct NoiseRowScratch {
+    std::vector<float> x, y, z;
+    std::vector<float> a, b, c, d;
+    std::vector<uint32_t> lanes;
+
+    void Resize(size_t count) {
+        if (x.size() < count) {
+            for (auto* v : { &x, &y, &z, &a, &b, &c, &d }) {
+                v->resize(count);
+            }
+            lanes.resize(count);
+        }
+    }
+};
+
+static NoiseRowScratch& GetNoiseRowScratch(size_t count) {
+    thread_local NoiseRowScratch scratch;
+    scratch.Resize(count);
+    return scratch;
+}
+
+// Samples the noise at (x[i], y, z) * scale for a whole row
+static void FillNoiseRow(NoiseRowScratch& s, const float* px, float py, float pz, float scale, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        s.x[i] = px[i] * scale;
+        s.y[i] = py * scale;
+        s.z[i] = pz * scale;
+    }
+}
+
+void ComputeTerrainColumn(int32_t originX, int32_t originZ, uint32_t chunkSize, uint32_t seed, TerrainColumn& out) {
+    const size_t columnCount = static_cast<size_t>(chunkSize) * chunkSize;
+    out.originX = originX;
+    out.originZ = originZ;
+    out.chunkSize = chunkSize;
+    out.height.resize(columnCount);
+    out.temperature.resize(columnCount);
+    out.moisture.resize(columnCount);
+    out.shore.resize(columnCount);
+
+    // Same arithmetic as GenerateTerrainHeight / ComputeClimate, one X row per
+    // batch call so the noise runs eight samples at a time
+    NoiseRowScratch& s = GetNoiseRowScratch(chunkSize);
+    std::vector<float> px(chunkSize), bx(chunkSize);
+    const float heightSeedOffset = static_cast<float>(seed) * 0.01f;
+    const float climateSeedOffset = static_cast<float>(seed) * 0.1f;
+
+    for (uint32_t lz = 0; lz < chunkSize; ++lz) {
+        const float worldZ = static_cast<float>(originZ + static_cast<int32_t>(lz));
+        const float pz = worldZ + heightSeedOffset;
+        const float bz = worldZ * 0.001f + climateSeedOffset;
+        const size_t rowStart = static_cast<size_t>(lz) * chunkSize;
+        float* height = out.height.data() + rowStart;
+
+        for (uint32_t lx = 0; lx < chunkSize; ++lx) {
+            const float worldX = static_cast<float>(originX + static_cast<int32_t>(lx));
+            px[lx] = worldX + heightSeedOffset;
+            bx[lx] = worldX * 0.001f + climateSeedOffset;
+        }
+
+        // ===== Height layers =====
+        FillNoiseRow(s, px.data(), 0.0f, pz, 0.0008f, chunkSize);
+        Utils::FBM3DBatch(s.x.data(), s.y.data(), s.z.data(), s.a.data(), chunkSize, 2, 0.5f, 2.0f);
+        FillNoiseRow(s, px.data(), 0.0f, pz, 0.003f, chunkSize);
+        Utils::FBM3DBatch(s.x.data(), s.y.data(), s.z.data(), s.b.data(), chunkSize, 4, 0.6f, 2.0f);
+        FillNoiseRow(s, px.data(), 0.0f, pz, 0.015f, chunkSize);
+        Utils::FBM3DBatch(s.x.data(), s.y.data(), s.z.data(), s.c.data(), chunkSize, 3, 0.5f, 2.0f);
+        FillNoiseRow(s, px.data(), 0.0f, pz, 0.002f, chunkSize);
+        Utils::RidgedNoise3DBatch(s.x.data(), s.y.data(), s.z.data(), s.d.data(), chunkSize, 4, 0.5f);
+
+        for (uint32_t lx = 0; lx < chunkSize; ++lx) {
+            height[lx] = CombineTerrainHeight(s.a[lx], s.b[lx], s.c[lx], s.d[lx]);
+        }
+
+        // ===== Climate =====
+        FillNoiseRow(s, bx.data(), 100.0f, bz, 1.5f, chunkSize);
+        Utils::SimplexNoise3DBatch(s.x.data(), s.y.data(), s.z.data(), s.a.data(), chunkSize);
+        for (uint32_t lx = 0; lx < chunkSize; ++lx) {
+            s.x[lx] = bx[lx] * 2.0f + 500.0f;
+            s.y[lx] = 100.0f * 2.0f;
+            s.z[lx] = bz * 2.0f;
+        }
+        Utils::SimplexNoise3DBatch(s.x.data(), s.y.data(), s.z.data(), s.b.data(), chunkSize);
+
+        // ===== Shore =====
+        for (uint32_t lx = 0; lx < chunkSize; ++lx) {
+            s.x[lx] = static_cast<float>(originX + static_cast<int32_t>(lx)) * 0.05f;
+            s.y[lx] = 0.0f;
+            s.z[lx] = worldZ * 0.05f;
+        }
+        Utils::SimplexNoise3DBatch(s.x.data(), s.y.data(), s.z.data(), s.c.data(), chunkSize);
+
+        for (uint32_t lx = 0; lx < chunkSize; ++lx) {
+            const size_t index = rowStart + lx;
+            out.temperature[index] = ApplyAltitude(s.a[lx] * 0.5f + 0.5f, height[lx]);
+            out.moisture[index] = s.b[lx] * 0.5f + 0.5f;
+
+            // Noise-based shore detection, creates irregular shorelines
+            out.shore[index] = s.c[lx] > -0.3f ? 1 : 0;
+        }
+    }
+}
+
+// Cave FBM input for world voxel coordinates (same in both cave modes)
+static void FillCaveNoiseInput(NoiseRowScratch& s, size_t slot, int32_t worldX, int32_t worldY, int32_t worldZ,
+                               float caveSeedOffset) {
+    s.x[slot] = static_cast<float>(worldX) * 0.03f + caveSeedOffset;
+    s.y[slot] = static_cast<float>(worldY) * 0.03f;
+    s.z[slot] = static_cast<float>(worldZ) * 0.03f;
+}
+
+static bool IsCaveLatticeUsable(uint32_t caveLattice, uint32_t chunkSize) {
+    return caveLattice > 1 && caveLattice <= chunkSize && chunkSize % caveLattice == 0;
+}
+
+// Cave noise sampled every `spacing` voxels of one chunk, far faces included
+struct CaveNoiseLattice {
+    uint32_t spacing = 0;
+    uint32_t nodesXZ = 0;               // Nodes along X and Z (chunkSize / spacing + 1)
+    uint32_t nodesY = 0;                // Node layers built (only up to the highest terrain)
+    std::vector<float> values;          // Index x + y * nodesXZ + z * nodesXZ * nodesY
+    std::vector<float> rowNodes;        // Scratch: one voxel row interpolated in Y/Z
+
+    // Sample the lattice for local Y in [0, localYLimit)
+    void Build(int32_t originX, int32_t originY, int32_t originZ, uint32_t chunkSize, uint32_t seed,
+               uint32_t latticeSpacing, uint32_t localYLimit, NoiseRowScratch& s) {
+        spacing = latticeSpacing;
+        nodesXZ = chunkSize / spacing + 1;
+        nodesY = localYLimit == 0 ? 0 : (localYLimit - 1) / spacing + 2;
+        values.resize(static_cast<size_t>(nodesXZ) * nodesY * nodesXZ);
+        rowNodes.resize(nodesXZ);
+
+        const float caveSeedOffset = static_cast<float>(seed) * 0.01f;
+        for (uint32_t nz = 0; nz < nodesXZ; ++nz) {
+            const int32_t worldZ = originZ + static_cast<int32_t>(nz * spacing);
+            for (uint32_t ny = 0; ny < nodesY; ++ny) {
+                const int32_t worldY = originY + static_cast<int32_t>(ny * spacing);
+                for (uint32_t nx = 0; nx < nodesXZ; ++nx) {
+                    FillCaveNoiseInput(s, nx, originX + static_cast<int32_t>(nx * spacing), worldY, worldZ, caveSeedOffset);
+                }
+                float* row = values.data() + (static_cast<size_t>(nz) * nodesY + ny) * nodesXZ;
+                Utils::FBM3DBatch(s.x.data(), s.y.data(), s.z.data(), row, nodesXZ, 3, 0.5f, 2.0f);
+            }
+        }
+    }
+
+    // Trilinear noise for voxels (lanes[i], ly, lz) into out[i]; ly must be
+    // below the Build limit
+    void InterpolateRow(uint32_t ly, uint32_t lz, const uint32_t* lanes, size_t count, float* out) {
+        if (count == 0) {
+            return;
+        }
+        const float inverseSpacing = 1.0f / static_cast<float>(spacing);
+        const uint32_t ny = ly / spacing;
+        const uint32_t nz = lz / spacing;
+        const float fy = static_cast<float>(ly % spacing) * inverseSpacing;
+        const float fz = static_cast<float>(lz % spacing) * inverseSpacing;
+
+        const float* v00 = values.data() + (static_cast<size_t>(nz) * nodesY + ny) * nodesXZ;
+        const float* v10 = v00 + nodesXZ;                                       // y + 1
+        const float* v01 = v00 + static_cast<size_t>(nodesY) * nodesXZ;         // z + 1
+        const float* v11 = v01 + nodesXZ;
+        for (uint32_t nx = 0; nx < nodesXZ; ++nx) {
+            const float lowZ = v00[nx] + (v10[nx] - v00[nx]) * fy;
+            const float highZ = v01[nx] + (v11[nx] - v01[nx]) * fy;
+            rowNodes[nx] = lowZ + (highZ - lowZ) * fz;
+        }
+
+        for (size_t i = 0; i < count; ++i) {
+            const uint32_t nx = lanes[i] / spacing;
+            const float fx = static_cast<float>(lanes[i] % spacing) * inverseSpacing;
+            out[i] = rowNodes[nx] + (rowNodes[nx + 1] - rowNodes[nx]) * fx;
+        }
+    }
+};
+
+static CaveNoiseLattice& GetCaveNoiseLattice() {
+    thread_local CaveNoiseLattice lattice;
+    return lattice;
+}
+
+void SampleCaveNoise(
+    int32_t originX, int32_t originY, int32_t originZ,
+    uint32_t chunkSize,
+    uint32_t worldSeed,
+    uint32_t caveLattice,
+    float* outNoise)
+{
+    NoiseRowScratch& s = GetNoiseRowScratch(chunkSize + 1);
+    const bool useLattice = IsCaveLatticeUsable(caveLattice, chunkSize);
+    CaveNoiseLattice& lattice = GetCaveNoiseLattice();
+    if (useLattice) {
+        lattice.Build(originX, originY, originZ, chunkSize, worldSeed, caveLattice, chunkSize, s);
+    }
+    for (uint32_t lx = 0; lx < chunkSize; ++lx) {
+        s.lanes[lx] = lx;
+    }
+
+    const float caveSeedOffset = static_cast<float>(worldSeed) * 0.01f;
+    for (uint32_t lz = 0; lz < chunkSize; ++lz) {
+        for (uint32_t ly = 0; ly < chunkSize; ++ly) {
+            float* row = outNoise + static_cast<size_t>(ly) * chunkSize + static_cast<size_t>(lz) * chunkSize * chunkSize;
+            if (useLattice) {
+                lattice.InterpolateRow(ly, lz, s.lanes.data(), chunkSize, row);
+                continue;
+            }
+            for (uint32_t lx = 0; lx < chunkSize; ++lx) {
+                FillCaveNoiseInput(s, lx, originX + static_cast<int32_t>(lx), originY + static_cast<int32_t>(ly),
+                    originZ + static_cast<int32_t>(lz), caveSeedOffset);
+            }
+            Utils::FBM3DBatch(s.x.data(), s.y.data(), s.z.data(), row, chunkSize, 3, 0.5f, 2.0f);
+        }
+    }
+}
+
+bool PredictUniformChunk(int32_t originY, uint32_t chunkSize, const TerrainColumn& column, uint32_t& outVoxel) {
+    const int32_t endY = originY + static_cast<int32_t>(chunkSize);
+    if (column.height.empty() || (originY <= 0 && endY > 0)) {
+        return false;   // Bedrock row inside the chunk
+    }
+
+    // Only voxels below their column's height are solid (or caves)
+    const float maxHeight = *std::max_element(column.height.begin(), column.height.end());
+    if (maxHeight > static_cast<float>(originY)) {
+        return false;
+    }
+
+    // Above the terrain: air, filled with water below sea level
+    if (static_cast<float>(originY) >= SEA_LEVEL) {
+        outVoxel = Utils::PackVoxel(Material::Air, 0, 0, 0);
+        return true;
+    }
+    if (static_cast<float>(endY - 1) < SEA_LEVEL) {
+        outVoxel = Utils::PackVoxel(Material::Water, 0, 0, 0);
+        return true;
+    }
+    return false;   // Straddles the sea surface
+}
+
+void GenerateChunkVoxels(
+    int32_t originX, int32_t originY, int32_t originZ,
+    uint32_t chunkSize,
+    uint32_t worldSeed,
+    uint32_t* outVoxels,
+    const TerrainColumn* column,
+    uint32_t caveLattice)
+{
+    // Column values depend only on (x, z): shared by every Y layer when cached
+    if (!column) {
+        thread_local TerrainColumn localColumn;
+        ComputeTerrainColumn(originX, originZ, chunkSize, worldSeed, localColumn);
+        column = &localColumn;
+    }
+
+    const float caveSeedOffset = static_cast<float>(worldSeed) * 0.01f;
+    NoiseRowScratch& s = GetNoiseRowScratch(chunkSize + 1);
+
+    // Coarse cave lattice, built only as high as the terrain reaches
+    CaveNoiseLattice* lattice = nullptr;
+    if (IsCaveLatticeUsable(caveLattice, chunkSize)) {
+        const float maxHeight = *std::max_element(column->height.begin(), column->height.end());
+        const float localTop = std::ceil(maxHeight) - static_cast<float>(originY);
+        const uint32_t localYLimit = static_cast<uint32_t>(std::clamp(localTop, 0.0f, static_cast<float>(chunkSize)));
+        lattice = &GetCaveNoiseLattice();
+        lattice->Build(originX, originY, originZ, chunkSize, worldSeed, caveLattice, localYLimit, s);
+    }
+    std::vector<uint8_t> materials(chunkSize), states(chunkSize);
+    float* caveNoise = s.a.data();
+    float* oreNoise = s.b.data();
+    uint32_t* lanes = s.lanes.data();
+
+    for (uint32_t lz = 0; lz < chunkSize; ++lz) {
+        const int32_t worldZ = originZ + static_cast<int32_t>(lz);
+        const size_t columnRow = static_cast<size_t>(lz) * chunkSize;
+
+        for (uint32_t ly = 0; ly < chunkSize; ++ly) {
+            const int32_t worldY = originY + static_cast<int32_t>(ly);
+            uint32_t* row = outVoxels + static_cast<size_t>(ly) * chunkSize + static_cast<size_t>(lz) * chunkSize * chunkSize;
+
+            // ===== STEP 1: Cave noise for every voxel of the row below the surface =====
+            // Bedrock (y == 0) and air above the terrain never read it
+            size_t caveCount = 0;
+            if (worldY != 0) {
+                for (uint32_t lx = 0; lx < chunkSize; ++lx) {
+                    if (static_cast<float>(worldY) < column->height[columnRow + lx]) {
+                        FillCaveNoiseInput(s, caveCount, originX + static_cast<int32_t>(lx), worldY, worldZ, caveSeedOffset);
+                        lanes[caveCount++] = lx;
+                    }
+                }
+                if (lattice) {
+                    lattice->InterpolateRow(ly, lz, lanes, caveCount, caveNoise);
+                } else {
+                    Utils::FBM3DBatch(s.x.data(), s.y.data(), s.z.data(), caveNoise, caveCount, 3, 0.5f, 2.0f);
+                }
+            }
+
+            // ===== STEP 2: Materials from height, caves and biome =====
+            std::fill(materials.begin(), materials.end(), Material::Air);
+            std::fill(states.begin(), states.end(), uint8_t{ 0 });
+            size_t oreCount = 0;
+
+            if (worldY == 0) {
+                // Bedrock floor (unbreakable bottom layer)
+                std::fill(materials.begin(), materials.end(), Material::Bedrock);
+                std::fill(states.begin(), states.end(), static_cast<uint8_t>(Utils::StateFlags::IsStatic));
+            }
+
+            for (size_t i = 0; i < caveCount; ++i) {
+                const uint32_t lx = lanes[i];
+                const size_t columnIndex = columnRow + lx;
+                const float terrainHeight = column->height[columnIndex];
+
+                // Carve caves where noise is below threshold
+                if (caveNoise[i] < CAVE_NOISE_THRESHOLD) {
+                    continue;  // Cave hollow
+                }
+
+                // Determine subsurface material
+                float depthFromSurface = terrainHeight - static_cast<float>(worldY);
+                states[lx] = Utils::StateFlags::IsStatic;
+
+                if (depthFromSurface < 1.5f) {
+                    // Surface layer - biome-specific
+                    materials[lx] = SelectSurfaceMaterial(terrainHeight, column->temperature[columnIndex],
+                        column->moisture[columnIndex], SEA_LEVEL);
+                } else if (depthFromSurface < 5.0f) {
+                    // Subsoil
+                    materials[lx] = Material::Dirt;
+                } else {
+                    // Deep underground - mostly stone with ore veins
+                    materials[lx] = Material::Stone;
+
+                    // Ore deposits (rare); sampled in STEP 3. Reuses the cave
+                    // input and lane slots, which are behind the read position.
+                    if (worldY < 50) {
+                        const int32_t worldX = originX + static_cast<int32_t>(lx);
+                        s.x[oreCount] = static_cast<float>(worldX) * 0.08f + 1000.0f;
+                        s.y[oreCount] = static_cast<float>(worldY) * 0.08f;
+                        s.z[oreCount] = static_cast<float>(worldZ) * 0.08f;
+                        lanes[oreCount++] = lx;
+                    }
+                }
+            }
+
+            // ===== STEP 3: Ore noise =====
+            if (oreCount > 0) {
+                Utils::SimplexNoise3DBatch(s.x.data(), s.y.data(), s.z.data(), oreNoise, oreCount);
+                for (size_t i = 0; i < oreCount; ++i) {
+                    if (oreNoise[i] > 0.7f) {
+                        materials[lanes[i]] = Material::Lava;  // Rare lava pockets (placeholder for ore)
+                    }
+                }
+            }
+
+            // ===== STEP 4: Water, beaches and packing =====
+            for (uint32_t lx = 0; lx < chunkSize; ++lx) {
+                const int32_t worldX = originX + static_cast<int32_t>(lx);
+                uint8_t material = materials[lx];
+                uint8_t state = states[lx];
+
+                // Random variant for visual variety (uses world position for consistency)
+                uint32_t random = Utils::Random3D(
+                    static_cast<uint32_t>(worldX), static_cast<uint32_t>(worldY), static_cast<uint32_t>(worldZ), worldSeed);
+                uint8_t variant = static_cast<uint8_t>(random & 0xFF);
+
+                // Water bodies - fill air below sea level with water
+                if (material == Material::Air && static_cast<float>(worldY) < SEA_LEVEL) {
+                    material = Material::Water;
+                    state = 0;  // Water is movable (not static)
+                }
+
+                // Beach transition - convert dirt/stone to sand near water level
+                if (material == Material::Dirt || material == Material::Stone) {
+                    if (static_cast<float>(worldY) >= SEA_LEVEL - 3.0f && static_cast<float>(worldY) <= SEA_LEVEL + 2.0f &&
+                        column->shore[columnRow + lx]) {
+                        material = Material::Sand;
+                    }
+                }
+
+                row[lx] = Utils::PackVoxel(material, variant, 0, state);
+            }
+        }
+    }
+}
+
+} // namespace VENPOD::Simulation
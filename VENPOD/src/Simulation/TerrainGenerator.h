@@ -0,0 +1,88 @@
+#pragma once
+
+// =============================================================================
+// VENPOD Terrain Generator - C++ port of CS_GenerateChunk.hlsl
+// Produces the same packed voxels for a cubic chunk as the compute shader:
+// FBM + ridged terrain height, biome surface material, cave carving, lava
+// pockets, sea fill and beach sand, with the shader's Random3D variants. Runs
+// without a GPU, so chunks can be generated on worker threads (see
+// AsyncChunkGenerator), pre-generated offline, or checked in tools.
+// =============================================================================
+
+#include <cstdint>
+#include <vector>
+
+namespace VENPOD::Simulation {
+
+// Terrain bounds of CS_GenerateChunk (must match the shader's clamp and SEA_LEVEL)
+static constexpr int32_t GENERATED_MAX_TERRAIN_HEIGHT = 246;
+static constexpr int32_t GENERATED_SEA_LEVEL = 80;
+
+// Terrain surface height of world column (x, z) - GenerateTerrainHeight
+float GenerateTerrainHeight(float x, float z, uint32_t seed);
+
+// Biome material of the top voxel of column (x, z) - SelectSurfaceMaterial
+uint8_t SelectSurfaceMaterial(float x, float z, uint32_t seed, float height, float seaLevel);
+// Same, from the column's (altitude-adjusted) temperature and moisture
+uint8_t SelectSurfaceMaterial(float height, float temperature, float moisture, float seaLevel);
+
+// Everything CS_GenerateChunk derives from (x, z) alone, for the
+// chunkSize × chunkSize columns of one chunk column (all Y layers share it).
+// Index x + z * chunkSize.
+struct TerrainColumn {
+    int32_t originX = 0;
+    int32_t originZ = 0;
+    uint32_t chunkSize = 0;
+
+    std::vector<float> height;          // GenerateTerrainHeight
+    std::vector<float> temperature;     // Biome temperature, after the altitude falloff
+    std::vector<float> moisture;        // Biome moisture
+    std::vector<uint8_t> shore;         // Shore noise allows beach sand
+};
+
+void ComputeTerrainColumn(int32_t originX, int32_t originZ, uint32_t chunkSize, uint32_t seed, TerrainColumn& out);
+
+// True when GenerateChunkVoxels would give every voxel of the chunk at
+// originY the same material and state, decided from the column's heights
+// alone: a chunk clear of the terrain and of the bedrock row is all air above
+// the sea and all water below it. Solid chunks need the cave and ore noise,
+// so they are never predicted. outVoxel has variant 0 (procedural per voxel).
+bool PredictUniformChunk(int32_t originY, uint32_t chunkSize, const TerrainColumn& column, uint32_t& outVoxel);
+
+// Cave noise modes for GenerateChunkVoxels. CAVE_LATTICE_EXACT evaluates the
+// 3-octave cave FBM at every voxel below the surface, like the shader. A
+// lattice spacing (4 or 8; any divisor of chunkSize above 1) samples it only
+// on that coarse lattice - including the far chunk faces, so neighbours agree
+// at the seam - and trilinearly interpolates inside each cell: about spacing³
+// fewer noise evaluations, at the cost of smoother cave walls that no longer
+// match CS_GenerateChunk voxel for voxel (see venpod_bench caves).
+static constexpr uint32_t CAVE_LATTICE_EXACT = 0;
+
+// Generate a chunkSize³ chunk whose first voxel sits at world (originX,
+// originY, originZ). outVoxels holds chunkSize³ packed voxels, index
+// x + y * chunkSize + z * chunkSize * chunkSize, exactly like ChunkVoxelOutput.
+// `column` (see TerrainColumnCache) must match originX/originZ; without one
+// the column values are computed for this chunk alone. caveLattice values
+// that do not divide chunkSize fall back to exact cave noise.
+void GenerateChunkVoxels(
+    int32_t originX, int32_t originY, int32_t originZ,
+    uint32_t chunkSize,
+    uint32_t worldSeed,
+    uint32_t* outVoxels,
+    const TerrainColumn* column = nullptr,
+    uint32_t caveLattice = CAVE_LATTICE_EXACT
+);
+
+// The cave density field GenerateChunkVoxels thresholds (caves where it is
+// below CAVE_NOISE_THRESHOLD) for every voxel of the chunk, in the same
+// layout, exact or lattice-interpolated. For tools comparing the two modes.
+static constexpr float CAVE_NOISE_THRESHOLD = -0.25f;
+void SampleCaveNoise(
+    int32_t originX, int32_t originY, int32_t originZ,
+    uint32_t chunkSize,
+    uint32_t worldSeed,
+    uint32_t caveLattice,
+    float* outNoise
+);
+
+} // namespace VENPOD::Simulation
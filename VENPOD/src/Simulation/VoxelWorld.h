@@ -24,14 +24,6 @@ struct VoxelWorldConfig {
     float voxelScale = 1.0f;       // World units per voxel
 };
 
-// Material properties for simulation
-struct MaterialProperties {
-    float density = 1.0f;
-    float friction = 0.5f;
-    float restitution = 0.3f;
-    uint32_t flags = 0;  // Solid, liquid, gas, etc.
-};
-
 class VoxelWorld {
 public:
     VoxelWorld() = default;
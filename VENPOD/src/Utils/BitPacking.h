@@ -24,6 +24,13 @@ namespace Material {
     constexpr uint8_t Ice = 8;
     constexpr uint8_t Oil = 9;
     constexpr uint8_t Glass = 10;
+    constexpr uint8_t Smoke = 11;
+    constexpr uint8_t Acid = 12;
+    constexpr uint8_t Honey = 13;
+    constexpr uint8_t Concrete = 14;
+    constexpr uint8_t Gunpowder = 15;
+    constexpr uint8_t Crystal = 16;
+    constexpr uint8_t Steam = 17;
     constexpr uint8_t Bedrock = 255;
 }
 
@@ -63,6 +70,11 @@ inline uint8_t UnpackState(uint32_t voxel) {
     return static_cast<uint8_t>((voxel >> 24) & 0xFF);
 }
 
+// Unpack life counter (low 4 bits of state)
+inline uint8_t UnpackLife(uint32_t voxel) {
+    return UnpackState(voxel) & StateFlags::LifeMask;
+}
+
 // Check if voxel is air (empty)
 inline bool IsAir(uint32_t voxel) {
     return UnpackMaterial(voxel) == Material::Air;
@@ -0,0 +1,324 @@
+#include "BlockCompression.h"
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+namespace VENPOD::Utils {
+
+namespace {
+
+// LZ4 block format limits
+constexpr size_t MIN_MATCH = 4;
+constexpr size_t LAST_LITERALS = 5;     // The block ends with at least this many literals
+constexpr size_t MF_LIMIT = 12;         // No match starts within this many bytes of the end
+constexpr size_t MAX_OFFSET = 65535;
+constexpr uint32_t SKIP_TRIGGER = 6;    // Misses before the search starts skipping ahead
+
+// Smallest multiple of each period 1-7 that is at least 8 bytes
+constexpr size_t SHORT_PERIOD_DISTANCE[8] = { 0, 8, 8, 9, 8, 10, 12, 14 };
+
+struct VoxelBlockHeader {
+    uint32_t count;         // Voxels
+    uint32_t blockBytes;    // Compressed plane bytes that follow
+};
+
+inline uint32_t Read32(const uint8_t* p) {
+    uint32_t value;
+    std::memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+inline uint64_t Read64(const uint8_t* p) {
+    uint64_t value;
+    std::memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+// Bytes at a and b that match, up to (not past) limit - a
+inline size_t CountMatch(const uint8_t* a, const uint8_t* b, const uint8_t* limit) {
+    const uint8_t* start = a;
+    while (a + 8 <= limit) {
+        const uint64_t diff = Read64(a) ^ Read64(b);
+        if (diff != 0) {
+            // Little-endian: the lowest set bit is in the first differing byte
+            return static_cast<size_t>(a - start) + static_cast<size_t>(std::countr_zero(diff)) / 8;
+        }
+        a += 8;
+        b += 8;
+    }
+    while (a < limit && *a == *b) {
+        ++a;
+        ++b;
+    }
+    return static_cast<size_t>(a - start);
+}
+
+// LZ4 length extension: 255-valued bytes, then the remainder
+inline uint8_t* WriteLength(uint8_t* op, size_t length) {
+    while (length >= 255) {
+        *op++ = 255;
+        length -= 255;
+    }
+    *op++ = static_cast<uint8_t>(length);
+    return op;
+}
+
+inline uint8_t* WriteLiterals(uint8_t* op, uint8_t* token, const uint8_t* literals, size_t count) {
+    if (count >= 15) {
+        *token = 15 << 4;
+        op = WriteLength(op, count - 15);
+    } else {
+        *token = static_cast<uint8_t>(count << 4);
+    }
+    std::memcpy(op, literals, count);
+    return op + count;
+}
+
+// Length extension after a token nibble of 15; false when it runs off the block
+inline bool ReadLength(const uint8_t*& ip, const uint8_t* iend, size_t& length) {
+    uint8_t byte;
+    do {
+        if (ip >= iend) {
+            return false;
+        }
+        byte = *ip++;
+        length += byte;
+    } while (byte == 255);
+    return true;
+}
+
+} // namespace
+
+// =============================================================================
+// LZ block codec
+// =============================================================================
+
+size_t LZCompressBound(size_t size) {
+    return size + size / 255 + 16;
+}
+
+LZCompressor::LZCompressor()
+    : m_hashTable(size_t(1) << HASH_LOG, 0)
+{
+}
+
+size_t LZCompressor::Compress(const uint8_t* src, size_t size, uint8_t* dst) {
+    const uint8_t* ip = src;
+    const uint8_t* anchor = src;
+    const uint8_t* iend = src + size;
+    uint8_t* op = dst;
+
+    auto hash = [](uint32_t sequence) { return (sequence * 2654435761u) >> (32 - HASH_LOG); };
+
+    if (size > MF_LIMIT) {
+        // Stale positions are harmless: every candidate is verified before use
+        std::fill(m_hashTable.begin(), m_hashTable.end(), 0u);
+        const uint8_t* mfLimit = iend - MF_LIMIT;
+        const uint8_t* matchLimit = iend - LAST_LITERALS;
+
+        while (ip <= mfLimit) {
+            // ===== STEP 1: Find a match, skipping faster the longer we miss =====
+            const uint8_t* match = nullptr;
+            uint32_t attempts = 1u << SKIP_TRIGGER;
+            while (true) {
+                const uint32_t sequence = Read32(ip);
+                uint32_t& slot = m_hashTable[hash(sequence)];
+                const uint8_t* candidate = src + slot;
+                slot = static_cast<uint32_t>(ip - src);
+                if (candidate < ip && static_cast<size_t>(ip - candidate) <= MAX_OFFSET &&
+                    Read32(candidate) == sequence) {
+                    match = candidate;
+                    break;
+                }
+                ip += attempts++ >> SKIP_TRIGGER;
+                if (ip > mfLimit) {
+                    break;
+                }
+            }
+            if (!match) {
+                break;
+            }
+
+            // ===== STEP 2: Extend backwards over pending literals, then forwards =====
+            while (ip > anchor && match > src && ip[-1] == match[-1]) {
+                --ip;
+                --match;
+            }
+            const size_t length = MIN_MATCH + CountMatch(ip + MIN_MATCH, match + MIN_MATCH, matchLimit);
+
+            // ===== STEP 3: Emit the sequence =====
+            uint8_t* token = op++;
+            op = WriteLiterals(op, token, anchor, static_cast<size_t>(ip - anchor));
+            const uint16_t offset = static_cast<uint16_t>(ip - match);
+            std::memcpy(op, &offset, sizeof(offset));
+            op += sizeof(offset);
+            if (length - MIN_MATCH >= 15) {
+                *token |= 15;
+                op = WriteLength(op, length - MIN_MATCH - 15);
+            } else {
+                *token |= static_cast<uint8_t>(length - MIN_MATCH);
+            }
+
+            ip += length;
+            anchor = ip;
+            if (ip <= mfLimit) {
+                m_hashTable[hash(Read32(ip - 2))] = static_cast<uint32_t>(ip - 2 - src);
+            }
+        }
+    }
+
+    // Last sequence: literals only
+    uint8_t* token = op++;
+    op = WriteLiterals(op, token, anchor, static_cast<size_t>(iend - anchor));
+    return static_cast<size_t>(op - dst);
+}
+
+bool LZDecompress(const uint8_t* src, size_t srcSize, uint8_t* dst, size_t dstSize) {
+    const uint8_t* ip = src;
+    const uint8_t* iend = src + srcSize;
+    uint8_t* op = dst;
+    uint8_t* oend = dst + dstSize;
+
+    while (ip < iend) {
+        const uint8_t token = *ip++;
+
+        // ===== Literals =====
+        size_t literals = token >> 4;
+        if (literals == 15 && !ReadLength(ip, iend, literals)) {
+            return false;
+        }
+        if (literals > static_cast<size_t>(iend - ip) || literals > static_cast<size_t>(oend - op)) {
+            return false;
+        }
+        if (literals <= 16 && iend - ip >= 16 && oend - op >= 16) {
+            std::memcpy(op, ip, 16);    // Over-copy; the tail is overwritten next
+        } else {
+            std::memcpy(op, ip, literals);
+        }
+        ip += literals;
+        op += literals;
+        if (ip == iend) {
+            break;                      // Last sequence has no match
+        }
+
+        // ===== Match =====
+        if (iend - ip < 2) {
+            return false;
+        }
+        uint16_t offset16;
+        std::memcpy(&offset16, ip, sizeof(offset16));
+        ip += sizeof(offset16);
+        const size_t offset = offset16;
+        if (offset == 0 || offset > static_cast<size_t>(op - dst)) {
+            return false;
+        }
+        size_t length = token & 15;
+        if (length == 15 && !ReadLength(ip, iend, length)) {
+            return false;
+        }
+        length += MIN_MATCH;
+        if (length > static_cast<size_t>(oend - op)) {
+            return false;
+        }
+
+        const uint8_t* match = op - offset;
+        uint8_t* matchEnd = op + length;
+        if (oend - matchEnd < 16) {
+            // Too close to the end for over-copying
+            while (op < matchEnd) {
+                *op++ = *match++;
+            }
+        } else if (offset >= 16) {
+            // Each 16-byte source block is fully written before it is read
+            do {
+                std::memcpy(op, match, 16);
+                op += 16;
+                match += 16;
+            } while (op < matchEnd);
+        } else {
+            // Short period (a repeated voxel, a byte run): the first 8 bytes
+            // byte by byte, then 8-byte copies from a whole number of periods
+            // back that is at least 8 bytes away
+            if (offset < 8) {
+                for (size_t i = 0; i < 8; ++i) {
+                    op[i] = match[i];
+                }
+                op += 8;
+                match = op - SHORT_PERIOD_DISTANCE[offset];
+            }
+            while (op < matchEnd) {
+                std::memcpy(op, match, 8);
+                op += 8;
+                match += 8;
+            }
+        }
+        op = matchEnd;
+    }
+    return ip == iend && op == oend;
+}
+
+// =============================================================================
+// Voxel byte planes
+// =============================================================================
+
+void ShuffleVoxelBytes(const uint32_t* voxels, size_t count, uint8_t* planes) {
+    uint8_t* material = planes;
+    uint8_t* variant = planes + count;
+    uint8_t* velocity = planes + count * 2;
+    uint8_t* state = planes + count * 3;
+    for (size_t i = 0; i < count; ++i) {
+        const uint32_t voxel = voxels[i];
+        material[i] = static_cast<uint8_t>(voxel);
+        variant[i] = static_cast<uint8_t>(voxel >> 8);
+        velocity[i] = static_cast<uint8_t>(voxel >> 16);
+        state[i] = static_cast<uint8_t>(voxel >> 24);
+    }
+}
+
+void UnshuffleVoxelBytes(const uint8_t* planes, size_t count, uint32_t* voxels) {
+    const uint8_t* material = planes;
+    const uint8_t* variant = planes + count;
+    const uint8_t* velocity = planes + count * 2;
+    const uint8_t* state = planes + count * 3;
+    for (size_t i = 0; i < count; ++i) {
+        voxels[i] = static_cast<uint32_t>(material[i]) | (static_cast<uint32_t>(variant[i]) << 8) |
+                    (static_cast<uint32_t>(velocity[i]) << 16) | (static_cast<uint32_t>(state[i]) << 24);
+    }
+}
+
+void LZCompressor::CompressVoxels(const uint32_t* voxels, size_t count, std::vector<uint8_t>& out) {
+    const size_t planeBytes = count * sizeof(uint32_t);
+    m_planes.resize(planeBytes);
+    ShuffleVoxelBytes(voxels, count, m_planes.data());
+
+    const size_t headerOffset = out.size();
+    out.resize(headerOffset + sizeof(VoxelBlockHeader) + LZCompressBound(planeBytes));
+    const size_t blockBytes = Compress(m_planes.data(), planeBytes, out.data() + headerOffset + sizeof(VoxelBlockHeader));
+    out.resize(headerOffset + sizeof(VoxelBlockHeader) + blockBytes);
+
+    const VoxelBlockHeader header{ static_cast<uint32_t>(count), static_cast<uint32_t>(blockBytes) };
+    std::memcpy(out.data() + headerOffset, &header, sizeof(header));
+}
+
+size_t GetCompressedVoxelCount(const uint8_t* data, size_t size) {
+    VoxelBlockHeader header;
+    if (size < sizeof(header)) {
+        return 0;
+    }
+    std::memcpy(&header, data, sizeof(header));
+    return header.blockBytes == size - sizeof(header) ? header.count : 0;
+}
+
+bool DecompressVoxels(const uint8_t* data, size_t size, uint32_t* voxels, size_t count, std::vector<uint8_t>& planes) {
+    if (count == 0 || GetCompressedVoxelCount(data, size) != count) {
+        return false;
+    }
+    planes.resize(count * sizeof(uint32_t));
+    if (!LZDecompress(data + sizeof(VoxelBlockHeader), size - sizeof(VoxelBlockHeader), planes.data(), planes.size())) {
+        return false;
+    }
+    UnshuffleVoxelBytes(planes.data(), count, voxels);
+    return true;
+}
+
+} // namespace VENPOD::Utils
@@ -0,0 +1,62 @@
+#pragma once
+
+// =============================================================================
+// VENPOD Block Compression - Dependency-free LZ codec for voxel payloads
+// An LZ4-style block codec (LZ4 block format: token, literals, 16-bit offset,
+// match length; greedy hash-chain-free match finder) for chunk blobs, RLE
+// streams and snapshots. Decoding is built for speed: literals and matches are
+// copied 16 bytes at a time, and short-period matches (a repeated voxel is a
+// 4-byte period, a run of one byte a 1-byte period) are expanded from a
+// pattern register instead of byte by byte.
+//
+// Packed voxels interleave a coherent material / state byte with a random
+// variant byte, which hides nearly every match from a byte-oriented LZ. The
+// voxel entry points first shuffle the words into byte planes (all material
+// bytes, then all variant bytes, then velocity, then state), so the material,
+// velocity and state planes become long runs and only the variant plane stays
+// incompressible.
+// =============================================================================
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace VENPOD::Utils {
+
+// Worst-case compressed size of `size` input bytes
+size_t LZCompressBound(size_t size);
+
+class LZCompressor {
+public:
+    LZCompressor();
+
+    // Compress `size` bytes into dst (at least LZCompressBound(size) bytes);
+    // returns the compressed size
+    size_t Compress(const uint8_t* src, size_t size, uint8_t* dst);
+
+    // Shuffle into byte planes and compress, appending to `out` (a small
+    // header, then the block)
+    void CompressVoxels(const uint32_t* voxels, size_t count, std::vector<uint8_t>& out);
+
+private:
+    static constexpr uint32_t HASH_LOG = 14;
+    std::vector<uint32_t> m_hashTable;      // Last position of each 4-byte hash
+    std::vector<uint8_t> m_planes;          // CompressVoxels shuffle scratch
+};
+
+// Decompress exactly `dstSize` bytes; false when the block is malformed or
+// does not decode to that size
+bool LZDecompress(const uint8_t* src, size_t srcSize, uint8_t* dst, size_t dstSize);
+
+// ===== Voxel byte planes =====
+// planes[k * count + i] = byte k of voxels[i]
+void ShuffleVoxelBytes(const uint32_t* voxels, size_t count, uint8_t* planes);
+void UnshuffleVoxelBytes(const uint8_t* planes, size_t count, uint32_t* voxels);
+
+// Voxel count of a CompressVoxels stream (0 when it is not one)
+size_t GetCompressedVoxelCount(const uint8_t* data, size_t size);
+// Decode a CompressVoxels stream into `count` voxels; false when malformed or
+// of another count. `planes` is scratch, reusable across calls.
+bool DecompressVoxels(const uint8_t* data, size_t size, uint32_t* voxels, size_t count, std::vector<uint8_t>& planes);
+
+} // namespace VENPOD::Utils
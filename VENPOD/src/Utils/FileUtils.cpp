@@ -1,3 +1,305 @@
 #include "FileUtils.h"
+#include <utility>
 
-// Stub - will be implemented in Phase 5
+#ifdef _WIN32
+#include <algorithm>
+#include <windows.h>
+#else
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace VENPOD::Utils {
+
+namespace {
+
+#ifdef _WIN32
+std::string LastErrorString() {
+    return fmt::format("error {}", static_cast<unsigned long>(GetLastError()));
+}
+#else
+std::string LastErrorString() {
+    return std::strerror(errno);
+}
+#endif
+
+} // namespace
+
+// =============================================================================
+// MappedFile
+// =============================================================================
+
+MappedFile::~MappedFile() {
+    Close();
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept {
+    *this = std::move(other);
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+        Close();
+        m_path = std::move(other.m_path);
+        m_data = std::exchange(other.m_data, nullptr);
+        m_size = std::exchange(other.m_size, 0);
+        m_open = std::exchange(other.m_open, false);
+#ifdef _WIN32
+        m_fileHandle = std::exchange(other.m_fileHandle, nullptr);
+        m_mappingHandle = std::exchange(other.m_mappingHandle, nullptr);
+#else
+        m_fd = std::exchange(other.m_fd, -1);
+#endif
+    }
+    return *this;
+}
+
+Result<void> MappedFile::Open(const std::filesystem::path& path) {
+    Close();
+    m_path = path;
+
+#ifdef _WIN32
+    // Share write access: the same file may be open in a WritableFile
+    HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                              nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return Error("MappedFile::Open - cannot open {}: {}", path.string(), LastErrorString());
+    }
+    m_fileHandle = file;
+#else
+    m_fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (m_fd < 0) {
+        return Error("MappedFile::Open - cannot open {}: {}", path.string(), LastErrorString());
+    }
+#endif
+
+    m_open = true;
+    auto result = Remap();
+    if (!result) {
+        Close();
+        return result;
+    }
+    return {};
+}
+
+void MappedFile::Unmap() {
+#ifdef _WIN32
+    if (m_data) {
+        UnmapViewOfFile(m_data);
+    }
+    if (m_mappingHandle) {
+        CloseHandle(m_mappingHandle);
+        m_mappingHandle = nullptr;
+    }
+#else
+    if (m_data) {
+        munmap(const_cast<uint8_t*>(m_data), m_size);
+    }
+#endif
+    m_data = nullptr;
+    m_size = 0;
+}
+
+Result<void> MappedFile::Remap() {
+    if (!m_open) {
+        return Error("MappedFile::Remap - file is not open");
+    }
+    Unmap();
+
+#ifdef _WIN32
+    LARGE_INTEGER size{};
+    if (!GetFileSizeEx(m_fileHandle, &size)) {
+        return Error("MappedFile::Remap - cannot stat {}: {}", m_path.string(), LastErrorString());
+    }
+    if (size.QuadPart == 0) {
+        return {};      // Nothing to map
+    }
+    m_mappingHandle = CreateFileMappingW(m_fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!m_mappingHandle) {
+        return Error("MappedFile::Remap - cannot map {}: {}", m_path.string(), LastErrorString());
+    }
+    void* view = MapViewOfFile(m_mappingHandle, FILE_MAP_READ, 0, 0, 0);
+    if (!view) {
+        CloseHandle(m_mappingHandle);
+        m_mappingHandle = nullptr;
+        return Error("MappedFile::Remap - cannot map {}: {}", m_path.string(), LastErrorString());
+    }
+    m_data = static_cast<const uint8_t*>(view);
+    m_size = static_cast<size_t>(size.QuadPart);
+#else
+    struct stat info {};
+    if (fstat(m_fd, &info) != 0) {
+        return Error("MappedFile::Remap - cannot stat {}: {}", m_path.string(), LastErrorString());
+    }
+    if (info.st_size == 0) {
+        return {};      // mmap rejects empty ranges
+    }
+    void* view = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_SHARED, m_fd, 0);
+    if (view == MAP_FAILED) {
+        return Error("MappedFile::Remap - cannot map {}: {}", m_path.string(), LastErrorString());
+    }
+    m_data = static_cast<const uint8_t*>(view);
+    m_size = static_cast<size_t>(info.st_size);
+#endif
+    return {};
+}
+
+void MappedFile::Close() {
+    Unmap();
+#ifdef _WIN32
+    if (m_fileHandle) {
+        CloseHandle(m_fileHandle);
+        m_fileHandle = nullptr;
+    }
+#else
+    if (m_fd >= 0) {
+        ::close(m_fd);
+        m_fd = -1;
+    }
+#endif
+    m_open = false;
+}
+
+// =============================================================================
+// WritableFile
+// =============================================================================
+
+WritableFile::~WritableFile() {
+    Close();
+}
+
+WritableFile::WritableFile(WritableFile&& other) noexcept {
+    *this = std::move(other);
+}
+
+WritableFile& WritableFile::operator=(WritableFile&& other) noexcept {
+    if (this != &other) {
+        Close();
+#ifdef _WIN32
+        m_handle = std::exchange(other.m_handle, nullptr);
+#else
+        m_fd = std::exchange(other.m_fd, -1);
+#endif
+    }
+    return *this;
+}
+
+Result<void> WritableFile::Open(const std::filesystem::path& path) {
+    Close();
+#ifdef _WIN32
+    HANDLE file = CreateFileW(path.c_str(), GENERIC_READ | GENERIC_WRITE,
+                              FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                              nullptr, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return Error("WritableFile::Open - cannot open {}: {}", path.string(), LastErrorString());
+    }
+    m_handle = file;
+#else
+    m_fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if (m_fd < 0) {
+        return Error("WritableFile::Open - cannot open {}: {}", path.string(), LastErrorString());
+    }
+#endif
+    return {};
+}
+
+void WritableFile::Close() {
+#ifdef _WIN32
+    if (m_handle) {
+        CloseHandle(m_handle);
+        m_handle = nullptr;
+    }
+#else
+    if (m_fd >= 0) {
+        ::close(m_fd);
+        m_fd = -1;
+    }
+#endif
+}
+
+bool WritableFile::IsOpen() const {
+#ifdef _WIN32
+    return m_handle != nullptr;
+#else
+    return m_fd >= 0;
+#endif
+}
+
+Result<void> WritableFile::WriteAt(uint64_t offset, const void* data, size_t size) {
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    while (size > 0) {
+#ifdef _WIN32
+        // WriteFile takes 32-bit lengths; the offset goes in the OVERLAPPED
+        DWORD chunk = static_cast<DWORD>(std::min<size_t>(size, 1u << 30));
+        OVERLAPPED overlapped{};
+        overlapped.Offset = static_cast<DWORD>(offset);
+        overlapped.OffsetHigh = static_cast<DWORD>(offset >> 32);
+        DWORD written = 0;
+        if (!WriteFile(m_handle, bytes, chunk, &written, &overlapped)) {
+            return Error("WritableFile::WriteAt - write of {} bytes at {} failed: {}", size, offset, LastErrorString());
+        }
+#else
+        ssize_t written = ::pwrite(m_fd, bytes, size, static_cast<off_t>(offset));
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return Error("WritableFile::WriteAt - write of {} bytes at {} failed: {}", size, offset, LastErrorString());
+        }
+#endif
+        bytes += written;
+        offset += static_cast<uint64_t>(written);
+        size -= static_cast<size_t>(written);
+    }
+    return {};
+}
+
+Result<void> WritableFile::Sync() {
+#ifdef _WIN32
+    if (!FlushFileBuffers(m_handle)) {
+        return Error("WritableFile::Sync - flush failed: {}", LastErrorString());
+    }
+#else
+    if (fsync(m_fd) != 0) {
+        return Error("WritableFile::Sync - fsync failed: {}", LastErrorString());
+    }
+#endif
+    return {};
+}
+
+Result<void> WritableFile::Truncate(uint64_t size) {
+#ifdef _WIN32
+    FILE_END_OF_FILE_INFO info{};
+    info.EndOfFile.QuadPart = static_cast<LONGLONG>(size);
+    if (!SetFileInformationByHandle(m_handle, FileEndOfFileInfo, &info, sizeof(info))) {
+        return Error("WritableFile::Truncate - cannot resize to {} bytes: {}", size, LastErrorString());
+    }
+#else
+    if (ftruncate(m_fd, static_cast<off_t>(size)) != 0) {
+        return Error("WritableFile::Truncate - cannot resize to {} bytes: {}", size, LastErrorString());
+    }
+#endif
+    return {};
+}
+
+Result<uint64_t> WritableFile::GetSize() const {
+#ifdef _WIN32
+    LARGE_INTEGER size{};
+    if (!GetFileSizeEx(m_handle, &size)) {
+        return MakeError<uint64_t>("WritableFile::GetSize - stat failed: {}", LastErrorString());
+    }
+    return Result<uint64_t>::Ok(static_cast<uint64_t>(size.QuadPart));
+#else
+    struct stat info {};
+    if (fstat(m_fd, &info) != 0) {
+        return MakeError<uint64_t>("WritableFile::GetSize - stat failed: {}", LastErrorString());
+    }
+    return Result<uint64_t>::Ok(static_cast<uint64_t>(info.st_size));
+#endif
+}
+
+} // namespace VENPOD::Utils
@@ -1,13 +1,93 @@
 #pragma once
 
-// Stub - will be implemented in Phase 5
+// =============================================================================
+// VENPOD File Utils - Memory-mapped reads and positioned writes
+// MappedFile maps a whole file read-only, so stored data (region files) is
+// read in place through a pointer instead of being copied by read(). A
+// WritableFile writes at explicit offsets into a file that stays open. Both
+// can be open on the same file at once: the mapping sees writes to the range
+// it covers, and Remap() picks up a file that has grown since it was mapped.
+// =============================================================================
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include "Result.h"
 
 namespace VENPOD::Utils {
 
-class FileUtils {
+class MappedFile {
+public:
+    MappedFile() = default;
+    ~MappedFile();
+
+    // Non-copyable, movable
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    // Map the whole file read-only (an empty file maps to no data)
+    Result<void> Open(const std::filesystem::path& path);
+    void Close();
+
+    // Map the file again at its current size
+    Result<void> Remap();
+
+    bool IsOpen() const { return m_open; }
+    const uint8_t* GetData() const { return m_data; }
+    size_t GetSize() const { return m_size; }
+
+private:
+    void Unmap();
+
+    std::filesystem::path m_path;
+    const uint8_t* m_data = nullptr;
+    size_t m_size = 0;
+    bool m_open = false;
+#ifdef _WIN32
+    void* m_fileHandle = nullptr;
+    void* m_mappingHandle = nullptr;
+#else
+    int m_fd = -1;
+#endif
+};
+
+class WritableFile {
 public:
-    FileUtils() = default;
-    ~FileUtils() = default;
+    WritableFile() = default;
+    ~WritableFile();
+
+    // Non-copyable, movable
+    WritableFile(const WritableFile&) = delete;
+    WritableFile& operator=(const WritableFile&) = delete;
+    WritableFile(WritableFile&& other) noexcept;
+    WritableFile& operator=(WritableFile&& other) noexcept;
+
+    // Open for writing; creates the file when it does not exist yet
+    Result<void> Open(const std::filesystem::path& path);
+    void Close();
+
+    bool IsOpen() const;
+
+    // Write `size` bytes at `offset`, growing the file as needed
+    Result<void> WriteAt(uint64_t offset, const void* data, size_t size);
+
+    // Force written data to the storage device
+    Result<void> Sync();
+
+    // Cut (or extend with zeros) the file to `size` bytes. On Windows no
+    // MappedFile may be open on the file at the time.
+    Result<void> Truncate(uint64_t size);
+
+    Result<uint64_t> GetSize() const;
+
+private:
+#ifdef _WIN32
+    void* m_handle = nullptr;
+#else
+    int m_fd = -1;
+#endif
 };
 
 } // namespace VENPOD::Utils
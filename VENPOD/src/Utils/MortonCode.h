@@ -40,4 +40,9 @@ inline void DecodeMorton3D(uint32_t morton, uint32_t& x, uint32_t& y, uint32_t&
     z = CompactBits3D(morton >> 2);
 }
 
+// Simple linear 3D index (non-Morton), matches LinearIndex3D in MortonCode.hlsli
+inline uint32_t LinearIndex3D(uint32_t x, uint32_t y, uint32_t z, uint32_t sizeX, uint32_t sizeY) {
+    return x + y * sizeX + z * sizeX * sizeY;
+}
+
 } // namespace VENPOD::Utils
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstdint>
+
+// Header-only PCG hash, bit-identical to PCGHash in PCGRandom.hlsli
+// Used by CPU simulation paths that must reproduce shader randomness
+
+namespace VENPOD::Utils {
+
+// PCG hash function - generates random uint from seed
+inline uint32_t PCGHash(uint32_t seed) {
+    uint32_t state = seed * 747796405u + 2891336453u;
+    uint32_t word = ((state >> ((state >> 28u) + 4u)) ^ state) * 277803737u;
+    return (word >> 22u) ^ word;
+}
+
+// 64 random bits from one seed (two chained hashes)
+inline uint64_t PCGHash64(uint32_t seed) {
+    uint32_t low = PCGHash(seed);
+    uint32_t high = PCGHash(low ^ 0x9E3779B9u);
+    return (static_cast<uint64_t>(high) << 32) | low;
+}
+
+// Position hash, bit-identical to Random3D in PCGRandom.hlsli (coordinates wrap like uint3(int3))
+inline uint32_t Random3D(uint32_t x, uint32_t y, uint32_t z, uint32_t frame) {
+    return PCGHash(x + y * 256u + z * 65536u + frame * 16777213u);
+}
+
+} // namespace VENPOD::Utils
@@ -0,0 +1,157 @@
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+
+// Header-only 3D simplex noise, a C++ port of SimplexNoise.hlsli
+// Same constants (F3/G3 are the shader's rounded 0.3333333 / 0.1666667, not
+// 1/3 and 1/6), permutation table, gradients and evaluation order, so CPU
+// terrain generation follows the shader's rules exactly. Results match the
+// GPU to float rounding (a driver may fuse multiply-adds the CPU keeps separate).
+
+namespace VENPOD::Utils {
+
+// Simplex skewing constants (as written in the shader)
+constexpr float SIMPLEX_F3 = 0.3333333f;
+constexpr float SIMPLEX_G3 = 0.1666667f;
+
+// Permutation table (the shader repeats it to 512 entries; indices here wrap instead)
+inline constexpr uint8_t SIMPLEX_PERM[256] = {
+    151, 160, 137, 91, 90, 15, 131, 13, 201, 95, 96, 53, 194, 233, 7, 225,
+    140, 36, 103, 30, 69, 142, 8, 99, 37, 240, 21, 10, 23, 190, 6, 148,
+    247, 120, 234, 75, 0, 26, 197, 62, 94, 252, 219, 203, 117, 35, 11, 32,
+    57, 177, 33, 88, 237, 149, 56, 87, 174, 20, 125, 136, 171, 168, 68, 175,
+    74, 165, 71, 134, 139, 48, 27, 166, 77, 146, 158, 231, 83, 111, 229, 122,
+    60, 211, 133, 230, 220, 105, 92, 41, 55, 46, 245, 40, 244, 102, 143, 54,
+    65, 25, 63, 161, 1, 216, 80, 73, 209, 76, 132, 187, 208, 89, 18, 169,
+    200, 196, 135, 130, 116, 188, 159, 86, 164, 100, 109, 198, 173, 186, 3, 64,
+    52, 217, 226, 250, 124, 123, 5, 202, 38, 147, 118, 126, 255, 82, 85, 212,
+    207, 206, 59, 227, 47, 16, 58, 17, 182, 189, 28, 42, 223, 183, 170, 213,
+    119, 248, 152, 2, 44, 154, 163, 70, 221, 153, 101, 155, 167, 43, 172, 9,
+    129, 22, 39, 253, 19, 98, 108, 110, 79, 113, 224, 232, 178, 185, 112, 104,
+    218, 246, 97, 228, 251, 34, 242, 193, 238, 210, 144, 12, 191, 179, 162, 241,
+    81, 51, 145, 235, 249, 14, 239, 107, 49, 192, 214, 31, 181, 199, 106, 157,
+    184, 84, 204, 176, 115, 121, 50, 45, 127, 4, 150, 254, 138, 236, 205, 93,
+    222, 114, 67, 29, 24, 72, 243, 141, 128, 195, 78, 66, 215, 61, 156, 180,
+};
+
+// Gradient vectors for 3D simplex noise
+inline constexpr int8_t SIMPLEX_GRAD3[12][3] = {
+    { 1, 1, 0 }, { -1, 1, 0 }, { 1, -1, 0 }, { -1, -1, 0 },
+    { 1, 0, 1 }, { -1, 0, 1 }, { 1, 0, -1 }, { -1, 0, -1 },
+    { 0, 1, 1 }, { 0, -1, 1 }, { 0, 1, -1 }, { 0, -1, -1 }
+};
+
+// Contribution of one simplex corner
+inline float SimplexCorner(uint32_t hash, float dx, float dy, float dz) {
+    float t = 0.6f - (dx * dx + dy * dy + dz * dz);
+    if (t < 0.0f) {
+        return 0.0f;
+    }
+    t *= t;
+    const int8_t* g = SIMPLEX_GRAD3[hash % 12];
+    return t * t * (g[0] * dx + g[1] * dy + g[2] * dz);
+}
+
+// 3D Simplex Noise
+// Returns value in [-1, 1] range
+inline float SimplexNoise3D(float x, float y, float z) {
+    // Skew input space to determine simplex cell
+    float s = (x + y + z) * SIMPLEX_F3;
+    int32_t i = static_cast<int32_t>(std::floor(x + s));
+    int32_t j = static_cast<int32_t>(std::floor(y + s));
+    int32_t k = static_cast<int32_t>(std::floor(z + s));
+
+    float t = static_cast<float>(i + j + k) * SIMPLEX_G3;
+    float d0x = x - (static_cast<float>(i) - t);   // Distance from cell origin
+    float d0y = y - (static_cast<float>(j) - t);
+    float d0z = z - (static_cast<float>(k) - t);
+
+    // Determine which simplex we're in (of 6 possible)
+    int32_t i1, j1, k1, i2, j2, k2;
+    if (d0x >= d0y) {
+        if (d0y >= d0z) {
+            i1 = 1; j1 = 0; k1 = 0; i2 = 1; j2 = 1; k2 = 0;  // X Y Z order
+        } else if (d0x >= d0z) {
+            i1 = 1; j1 = 0; k1 = 0; i2 = 1; j2 = 0; k2 = 1;  // X Z Y order
+        } else {
+            i1 = 0; j1 = 0; k1 = 1; i2 = 1; j2 = 0; k2 = 1;  // Z X Y order
+        }
+    } else {
+        if (d0y < d0z) {
+            i1 = 0; j1 = 0; k1 = 1; i2 = 0; j2 = 1; k2 = 1;  // Z Y X order
+        } else if (d0x < d0z) {
+            i1 = 0; j1 = 1; k1 = 0; i2 = 0; j2 = 1; k2 = 1;  // Y Z X order
+        } else {
+            i1 = 0; j1 = 1; k1 = 0; i2 = 1; j2 = 1; k2 = 0;  // Y X Z order
+        }
+    }
+
+    // Offsets for corners
+    float d1x = d0x - static_cast<float>(i1) + SIMPLEX_G3;
+    float d1y = d0y - static_cast<float>(j1) + SIMPLEX_G3;
+    float d1z = d0z - static_cast<float>(k1) + SIMPLEX_G3;
+    float d2x = d0x - static_cast<float>(i2) + 2.0f * SIMPLEX_G3;
+    float d2y = d0y - static_cast<float>(j2) + 2.0f * SIMPLEX_G3;
+    float d2z = d0z - static_cast<float>(k2) + 2.0f * SIMPLEX_G3;
+    float d3x = d0x - 1.0f + 3.0f * SIMPLEX_G3;
+    float d3y = d0y - 1.0f + 3.0f * SIMPLEX_G3;
+    float d3z = d0z - 1.0f + 3.0f * SIMPLEX_G3;
+
+    // Hash coordinates for gradient lookup
+    uint32_t ii = static_cast<uint32_t>(i) & 255u;
+    uint32_t jj = static_cast<uint32_t>(j) & 255u;
+    uint32_t kk = static_cast<uint32_t>(k) & 255u;
+    auto perm = [](uint32_t index) -> uint32_t { return SIMPLEX_PERM[index & 255u]; };
+
+    uint32_t gi0 = perm(ii + perm(jj + perm(kk)));
+    uint32_t gi1 = perm(ii + i1 + perm(jj + j1 + perm(kk + k1)));
+    uint32_t gi2 = perm(ii + i2 + perm(jj + j2 + perm(kk + k2)));
+    uint32_t gi3 = perm(ii + 1 + perm(jj + 1 + perm(kk + 1)));
+
+    // Sum contributions and scale to [-1, 1]
+    float n0 = SimplexCorner(gi0, d0x, d0y, d0z);
+    float n1 = SimplexCorner(gi1, d1x, d1y, d1z);
+    float n2 = SimplexCorner(gi2, d2x, d2y, d2z);
+    float n3 = SimplexCorner(gi3, d3x, d3y, d3z);
+    return 32.0f * (n0 + n1 + n2 + n3);
+}
+
+// Fractional Brownian Motion (multi-octave noise), normalised to [-1, 1]
+inline float FBM3D(float x, float y, float z, int octaves, float persistence, float lacunarity) {
+    float value = 0.0f;
+    float amplitude = 1.0f;
+    float frequency = 1.0f;
+    float maxValue = 0.0f;
+
+    for (int i = 0; i < octaves; i++) {
+        value += amplitude * SimplexNoise3D(x * frequency, y * frequency, z * frequency);
+        maxValue += amplitude;
+        amplitude *= persistence;
+        frequency *= lacunarity;
+    }
+
+    return value / maxValue;
+}
+
+// Ridged noise (inverted for mountain ridges)
+inline float RidgedNoise3D(float x, float y, float z, int octaves, float persistence) {
+    float value = 0.0f;
+    float amplitude = 1.0f;
+    float frequency = 1.0f;
+    float maxValue = 0.0f;
+
+    for (int i = 0; i < octaves; i++) {
+        float n = SimplexNoise3D(x * frequency, y * frequency, z * frequency);
+        n = 1.0f - std::fabs(n);  // Ridge shape
+        n = n * n;                // Sharpen
+        value += amplitude * n;
+        maxValue += amplitude;
+        amplitude *= persistence;
+        frequency *= 2.0f;
+    }
+
+    return value / maxValue;
+}
+
+} // namespace VENPOD::Utils
@@ -0,0 +1,216 @@
+// AVX2 kernels for SimplexNoiseBatch.h. This file alone is compiled with
+// AVX2 enabled (see CMakeLists.txt) and is only entered after the runtime CPU
+// check in SimplexNoiseBatch.cpp, so it must not instantiate inline or
+// template code shared with other translation units (no SimplexNoise.h
+// functions, no STL algorithms) - the linker could keep the AVX2 copy.
+
+#include "SimplexNoise.h"
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace VENPOD::Utils::Detail {
+
+#if defined(__AVX2__)
+
+extern const bool NOISE_AVX2_COMPILED = true;
+
+namespace {
+
+// SIMPLEX_PERM widened for 32-bit gathers
+struct PermTable {
+    int32_t values[256];
+    constexpr PermTable() : values() {
+        for (int i = 0; i < 256; ++i) {
+            values[i] = SIMPLEX_PERM[i];
+        }
+    }
+};
+
+// Gradient components by hash (hash % 12 resolved ahead of time)
+struct GradientTable {
+    float x[256];
+    float y[256];
+    float z[256];
+    constexpr GradientTable() : x(), y(), z() {
+        for (int i = 0; i < 256; ++i) {
+            x[i] = SIMPLEX_GRAD3[i % 12][0];
+            y[i] = SIMPLEX_GRAD3[i % 12][1];
+            z[i] = SIMPLEX_GRAD3[i % 12][2];
+        }
+    }
+};
+
+constexpr PermTable PERM_TABLE;
+constexpr GradientTable GRADIENT_TABLE;
+
+inline __m256i Perm8(__m256i index) {
+    return _mm256_i32gather_epi32(PERM_TABLE.values, _mm256_and_si256(index, _mm256_set1_epi32(255)), 4);
+}
+
+// Contribution of one simplex corner (SimplexCorner)
+inline __m256 Corner8(__m256i hash, __m256 dx, __m256 dy, __m256 dz) {
+    __m256 t = _mm256_sub_ps(_mm256_set1_ps(0.6f),
+        _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy)), _mm256_mul_ps(dz, dz)));
+    __m256 gx = _mm256_i32gather_ps(GRADIENT_TABLE.x, hash, 4);
+    __m256 gy = _mm256_i32gather_ps(GRADIENT_TABLE.y, hash, 4);
+    __m256 gz = _mm256_i32gather_ps(GRADIENT_TABLE.z, hash, 4);
+    __m256 dot = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(gx, dx), _mm256_mul_ps(gy, dy)), _mm256_mul_ps(gz, dz));
+
+    __m256 t2 = _mm256_mul_ps(t, t);
+    __m256 n = _mm256_mul_ps(_mm256_mul_ps(t2, t2), dot);
+    // t < 0 contributes nothing
+    return _mm256_and_ps(n, _mm256_cmp_ps(t, _mm256_setzero_ps(), _CMP_GE_OQ));
+}
+
+// SimplexNoise3D for 8 points, operation for operation
+inline __m256 Noise8(__m256 x, __m256 y, __m256 z) {
+    const __m256 f3 = _mm256_set1_ps(SIMPLEX_F3);
+    const __m256 g3 = _mm256_set1_ps(SIMPLEX_G3);
+    const __m256 one = _mm256_set1_ps(1.0f);
+    const __m256 allBits = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+    const __m256i oneInt = _mm256_set1_epi32(1);
+
+    // Skew input space to determine simplex cell
+    __m256 s = _mm256_mul_ps(_mm256_add_ps(_mm256_add_ps(x, y), z), f3);
+    __m256i i = _mm256_cvttps_epi32(_mm256_floor_ps(_mm256_add_ps(x, s)));
+    __m256i j = _mm256_cvttps_epi32(_mm256_floor_ps(_mm256_add_ps(y, s)));
+    __m256i k = _mm256_cvttps_epi32(_mm256_floor_ps(_mm256_add_ps(z, s)));
+
+    __m256 t = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_add_epi32(_mm256_add_epi32(i, j), k)), g3);
+    __m256 d0x = _mm256_sub_ps(x, _mm256_sub_ps(_mm256_cvtepi32_ps(i), t));
+    __m256 d0y = _mm256_sub_ps(y, _mm256_sub_ps(_mm256_cvtepi32_ps(j), t));
+    __m256 d0z = _mm256_sub_ps(z, _mm256_sub_ps(_mm256_cvtepi32_ps(k), t));
+
+    // Simplex selection without branches (same ties as the scalar if-chain)
+    __m256 xy = _mm256_cmp_ps(d0x, d0y, _CMP_GE_OQ);
+    __m256 yz = _mm256_cmp_ps(d0y, d0z, _CMP_GE_OQ);
+    __m256 xz = _mm256_cmp_ps(d0x, d0z, _CMP_GE_OQ);
+    __m256 i1 = _mm256_and_ps(xy, xz);
+    __m256 j1 = _mm256_andnot_ps(xy, yz);
+    __m256 k1 = _mm256_andnot_ps(_mm256_or_ps(xz, yz), allBits);
+    __m256 i2 = _mm256_or_ps(xy, xz);
+    __m256 j2 = _mm256_or_ps(_mm256_andnot_ps(xy, allBits), yz);
+    __m256 k2 = _mm256_andnot_ps(_mm256_and_ps(yz, xz), allBits);
+
+    // Offsets for corners
+    const __m256 g3x2 = _mm256_set1_ps(2.0f * SIMPLEX_G3);
+    const __m256 g3x3 = _mm256_set1_ps(3.0f * SIMPLEX_G3);
+    __m256 d1x = _mm256_add_ps(_mm256_sub_ps(d0x, _mm256_and_ps(i1, one)), g3);
+    __m256 d1y = _mm256_add_ps(_mm256_sub_ps(d0y, _mm256_and_ps(j1, one)), g3);
+    __m256 d1z = _mm256_add_ps(_mm256_sub_ps(d0z, _mm256_and_ps(k1, one)), g3);
+    __m256 d2x = _mm256_add_ps(_mm256_sub_ps(d0x, _mm256_and_ps(i2, one)), g3x2);
+    __m256 d2y = _mm256_add_ps(_mm256_sub_ps(d0y, _mm256_and_ps(j2, one)), g3x2);
+    __m256 d2z = _mm256_add_ps(_mm256_sub_ps(d0z, _mm256_and_ps(k2, one)), g3x2);
+    __m256 d3x = _mm256_add_ps(_mm256_sub_ps(d0x, one), g3x3);
+    __m256 d3y = _mm256_add_ps(_mm256_sub_ps(d0y, one), g3x3);
+    __m256 d3z = _mm256_add_ps(_mm256_sub_ps(d0z, one), g3x3);
+
+    // Hash coordinates for gradient lookup
+    const __m256i mask = _mm256_set1_epi32(255);
+    __m256i ii = _mm256_and_si256(i, mask);
+    __m256i jj = _mm256_and_si256(j, mask);
+    __m256i kk = _mm256_and_si256(k, mask);
+    auto offset = [&](__m256 selected) { return _mm256_and_si256(_mm256_castps_si256(selected), oneInt); };
+
+    __m256i gi0 = Perm8(_mm256_add_epi32(ii, Perm8(_mm256_add_epi32(jj, Perm8(kk)))));
+    __m256i gi1 = Perm8(_mm256_add_epi32(_mm256_add_epi32(ii, offset(i1)),
+        Perm8(_mm256_add_epi32(_mm256_add_epi32(jj, offset(j1)), Perm8(_mm256_add_epi32(kk, offset(k1)))))));
+    __m256i gi2 = Perm8(_mm256_add_epi32(_mm256_add_epi32(ii, offset(i2)),
+        Perm8(_mm256_add_epi32(_mm256_add_epi32(jj, offset(j2)), Perm8(_mm256_add_epi32(kk, offset(k2)))))));
+    __m256i gi3 = Perm8(_mm256_add_epi32(_mm256_add_epi32(ii, oneInt),
+        Perm8(_mm256_add_epi32(_mm256_add_epi32(jj, oneInt), Perm8(_mm256_add_epi32(kk, oneInt))))));
+
+    // Sum contributions and scale to [-1, 1]
+    __m256 n0 = Corner8(gi0, d0x, d0y, d0z);
+    __m256 n1 = Corner8(gi1, d1x, d1y, d1z);
+    __m256 n2 = Corner8(gi2, d2x, d2y, d2z);
+    __m256 n3 = Corner8(gi3, d3x, d3y, d3z);
+    return _mm256_mul_ps(_mm256_set1_ps(32.0f), _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(n0, n1), n2), n3));
+}
+
+enum class Kind { Simplex, FBM, Ridged };
+
+inline __m256 Evaluate8(Kind kind, __m256 x, __m256 y, __m256 z, int octaves, float persistence, float lacunarity) {
+    if (kind == Kind::Simplex) {
+        return Noise8(x, y, z);
+    }
+
+    // FBM3D / RidgedNoise3D: amplitude and frequency are uniform across lanes
+    __m256 value = _mm256_setzero_ps();
+    float amplitude = 1.0f;
+    float frequency = 1.0f;
+    float maxValue = 0.0f;
+    for (int octave = 0; octave < octaves; ++octave) {
+        __m256 f = _mm256_set1_ps(frequency);
+        __m256 n = Noise8(_mm256_mul_ps(x, f), _mm256_mul_ps(y, f), _mm256_mul_ps(z, f));
+        if (kind == Kind::Ridged) {
+            // 1 - |n|, squared
+            n = _mm256_sub_ps(_mm256_set1_ps(1.0f), _mm256_andnot_ps(_mm256_set1_ps(-0.0f), n));
+            n = _mm256_mul_ps(n, n);
+        }
+        value = _mm256_add_ps(value, _mm256_mul_ps(_mm256_set1_ps(amplitude), n));
+        maxValue += amplitude;
+        amplitude *= persistence;
+        frequency *= (kind == Kind::Ridged) ? 2.0f : lacunarity;
+    }
+    return _mm256_div_ps(value, _mm256_set1_ps(maxValue));
+}
+
+void EvaluateBatch(Kind kind, const float* x, const float* y, const float* z, float* out, size_t count,
+                   int octaves, float persistence, float lacunarity) {
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256 result = Evaluate8(kind, _mm256_loadu_ps(x + i), _mm256_loadu_ps(y + i), _mm256_loadu_ps(z + i),
+            octaves, persistence, lacunarity);
+        _mm256_storeu_ps(out + i, result);
+    }
+
+    // Tail: pad to a full vector
+    if (i < count) {
+        alignas(32) float tx[8] = {}, ty[8] = {}, tz[8] = {}, tout[8];
+        size_t remaining = count - i;
+        for (size_t lane = 0; lane < remaining; ++lane) {
+            tx[lane] = x[i + lane];
+            ty[lane] = y[i + lane];
+            tz[lane] = z[i + lane];
+        }
+        _mm256_store_ps(tout, Evaluate8(kind, _mm256_load_ps(tx), _mm256_load_ps(ty), _mm256_load_ps(tz),
+            octaves, persistence, lacunarity));
+        for (size_t lane = 0; lane < remaining; ++lane) {
+            out[i + lane] = tout[lane];
+        }
+    }
+}
+
+} // namespace
+
+void SimplexNoise3DBatchAVX2(const float* x, const float* y, const float* z, float* out, size_t count) {
+    EvaluateBatch(Kind::Simplex, x, y, z, out, count, 1, 0.0f, 0.0f);
+}
+
+void FBM3DBatchAVX2(const float* x, const float* y, const float* z, float* out, size_t count,
+                    int octaves, float persistence, float lacunarity) {
+    EvaluateBatch(Kind::FBM, x, y, z, out, count, octaves, persistence, lacunarity);
+}
+
+void RidgedNoise3DBatchAVX2(const float* x, const float* y, const float* z, float* out, size_t count,
+                            int octaves, float persistence) {
+    EvaluateBatch(Kind::Ridged, x, y, z, out, count, octaves, persistence, 2.0f);
+}
+
+#else
+
+// Not an AVX2 build of this file (non-x86 target): the dispatcher never calls these
+extern const bool NOISE_AVX2_COMPILED = false;
+
+void SimplexNoise3DBatchAVX2(const float*, const float*, const float*, float*, size_t) {}
+void FBM3DBatchAVX2(const float*, const float*, const float*, float*, size_t, int, float, float) {}
+void RidgedNoise3DBatchAVX2(const float*, const float*, const float*, float*, size_t, int, float) {}
+
+#endif
+
+} // namespace VENPOD::Utils::Detail
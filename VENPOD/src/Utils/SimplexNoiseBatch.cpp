@@ -0,0 +1,121 @@
+#include "SimplexNoiseBatch.h"
+#include "SimplexNoise.h"
+#include <atomic>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <immintrin.h>
+#include <intrin.h>
+#endif
+
+namespace VENPOD::Utils {
+
+namespace Detail {
+// SimplexNoiseAVX2.cpp (the only file built with AVX2 code generation)
+extern const bool NOISE_AVX2_COMPILED;
+void SimplexNoise3DBatchAVX2(const float* x, const float* y, const float* z, float* out, size_t count);
+void FBM3DBatchAVX2(const float* x, const float* y, const float* z, float* out, size_t count,
+                    int octaves, float persistence, float lacunarity);
+void RidgedNoise3DBatchAVX2(const float* x, const float* y, const float* z, float* out, size_t count,
+                            int octaves, float persistence);
+} // namespace Detail
+
+namespace {
+
+bool CpuSupportsAVX2() {
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] < 7) {
+        return false;
+    }
+    // AVX needs OSXSAVE and the OS saving YMM state
+    __cpuid(info, 1);
+    const bool osxsave = (info[2] & (1 << 27)) != 0;
+    const bool avx = (info[2] & (1 << 28)) != 0;
+    if (!osxsave || !avx || (_xgetbv(0) & 0x6) != 0x6) {
+        return false;
+    }
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+    return __builtin_cpu_supports("avx2");
+#else
+    return false;
+#endif
+}
+
+NoiseBackend DetectBestBackend() {
+    return IsNoiseBackendSupported(NoiseBackend::AVX2) ? NoiseBackend::AVX2 : NoiseBackend::Scalar;
+}
+
+std::atomic<NoiseBackend>& ActiveBackend() {
+    static std::atomic<NoiseBackend> backend{ DetectBestBackend() };
+    return backend;
+}
+
+} // namespace
+
+NoiseBackend GetNoiseBackend() {
+    return ActiveBackend().load(std::memory_order_relaxed);
+}
+
+void SetNoiseBackend(NoiseBackend backend) {
+    if (!IsNoiseBackendSupported(backend)) {
+        backend = NoiseBackend::Scalar;
+    }
+    ActiveBackend().store(backend, std::memory_order_relaxed);
+}
+
+bool IsNoiseBackendSupported(NoiseBackend backend) {
+    switch (backend) {
+        case NoiseBackend::Scalar:
+            return true;
+        case NoiseBackend::AVX2: {
+            static const bool supported = Detail::NOISE_AVX2_COMPILED && CpuSupportsAVX2();
+            return supported;
+        }
+    }
+    return false;
+}
+
+const char* GetNoiseBackendName(NoiseBackend backend) {
+    switch (backend) {
+        case NoiseBackend::Scalar: return "scalar";
+        case NoiseBackend::AVX2:   return "avx2";
+    }
+    return "unknown";
+}
+
+void SimplexNoise3DBatch(const float* x, const float* y, const float* z, float* out, size_t count) {
+    if (GetNoiseBackend() == NoiseBackend::AVX2) {
+        Detail::SimplexNoise3DBatchAVX2(x, y, z, out, count);
+        return;
+    }
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = SimplexNoise3D(x[i], y[i], z[i]);
+    }
+}
+
+void FBM3DBatch(const float* x, const float* y, const float* z, float* out, size_t count,
+                int octaves, float persistence, float lacunarity) {
+    if (GetNoiseBackend() == NoiseBackend::AVX2) {
+        Detail::FBM3DBatchAVX2(x, y, z, out, count, octaves, persistence, lacunarity);
+        return;
+    }
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = FBM3D(x[i], y[i], z[i], octaves, persistence, lacunarity);
+    }
+}
+
+void RidgedNoise3DBatch(const float* x, const float* y, const float* z, float* out, size_t count,
+                        int octaves, float persistence) {
+    if (GetNoiseBackend() == NoiseBackend::AVX2) {
+        Detail::RidgedNoise3DBatchAVX2(x, y, z, out, count, octaves, persistence);
+        return;
+    }
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = RidgedNoise3D(x[i], y[i], z[i], octaves, persistence);
+    }
+}
+
+} // namespace VENPOD::Utils
@@ -0,0 +1,41 @@
+#pragma once
+
+// =============================================================================
+// VENPOD Simplex Noise Batch - SimplexNoise3D / FBM3D / RidgedNoise3D over
+// arrays of sample points
+// Noise dominates CPU terrain generation (height, caves, ores, shores), and
+// the samples of one voxel row are independent, so they are evaluated eight
+// at a time with AVX2 when the CPU has it. The vector kernel performs the
+// same float operations in the same order as the scalar SimplexNoise.h
+// (no FMA contraction), so both backends return identical values; the
+// scalar backend is the reference and the fallback on other CPUs.
+// =============================================================================
+
+#include <cstddef>
+
+namespace VENPOD::Utils {
+
+enum class NoiseBackend {
+    Scalar,     // SimplexNoise.h, one point at a time
+    AVX2        // 8 points per instruction (x86-64 with AVX2 only)
+};
+
+// Backend the batch functions use: the fastest supported one unless overridden
+NoiseBackend GetNoiseBackend();
+// Force a backend (unsupported requests fall back to Scalar); for tools and comparisons
+void SetNoiseBackend(NoiseBackend backend);
+bool IsNoiseBackendSupported(NoiseBackend backend);
+const char* GetNoiseBackendName(NoiseBackend backend);
+
+// out[i] = SimplexNoise3D(x[i], y[i], z[i]) for i in [0, count)
+void SimplexNoise3DBatch(const float* x, const float* y, const float* z, float* out, size_t count);
+
+// out[i] = FBM3D(x[i], y[i], z[i], octaves, persistence, lacunarity)
+void FBM3DBatch(const float* x, const float* y, const float* z, float* out, size_t count,
+                int octaves, float persistence, float lacunarity);
+
+// out[i] = RidgedNoise3D(x[i], y[i], z[i], octaves, persistence)
+void RidgedNoise3DBatch(const float* x, const float* y, const float* z, float* out, size_t count,
+                        int octaves, float persistence);
+
+} // namespace VENPOD::Utils
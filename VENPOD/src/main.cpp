@@ -10,11 +10,13 @@
 #include "Simulation/VoxelWorld.h"
 #include "Simulation/PhysicsDispatcher.h"
 #include "Simulation/ChunkManager.h"
+#include "Simulation/SimulationClock.h"
 #include "Input/InputManager.h"
 #include "Input/BrushController.h"
 #include <spdlog/spdlog.h>
 #include <SDL3/SDL.h>
 #include <glm/glm.hpp>
+#include <algorithm>
 #include <memory>
 #include <filesystem>
 #include <cmath>
@@ -262,7 +264,21 @@ int main(int argc, char* argv[]) {
     uint64_t frameCount = 0;
     bool mouseInitialized = false;  // Track if mouse capture has been enabled
 
+    // Physics runs at a fixed rate, independent of the frame rate
+    Simulation::SimulationClockConfig clockConfig;
+    clockConfig.ticksPerSecond = 60;
+    clockConfig.substeps = 1;
+    Simulation::SimulationClock simulationClock;
+    simulationClock.Initialize(clockConfig);
+
+    // Wall time between frames (camera movement and the simulation clock)
+    uint64_t lastFrameTicksNS = SDL_GetTicksNS();
+
     while (running) {
+        uint64_t frameTicksNS = SDL_GetTicksNS();
+        double frameSeconds = static_cast<double>(frameTicksNS - lastFrameTicksNS) / 1e9;
+        lastFrameTicksNS = frameTicksNS;
+
         // Process SDL events FIRST to update mouse/keyboard state
         SDL_Event event;
         while (SDL_PollEvent(&event)) {
@@ -355,7 +371,7 @@ int main(int argc, char* argv[]) {
         glm::vec3 cameraUp = glm::cross(cameraRight, cameraForward);
 
         // Camera movement with WASD + Space/Shift
-        float dt = 1.0f / 60.0f;  // Approximate delta time
+        float dt = static_cast<float>(std::min(frameSeconds, 0.1));  // Clamped so a stall doesn't teleport the camera
         float moveSpeed = cameraSpeed * dt;
         if (inputManager.IsActionDown(Input::KeyAction::CameraForward)) {
             cameraPos += cameraForward * moveSpeed;
@@ -479,24 +495,27 @@ int main(int argc, char* argv[]) {
             physicsDispatcher->DispatchBrush(commandList.Get(), *voxelWorld, brushConstants);
         }
 
-        // Run physics simulation (if not paused)
+        // Run the physics ticks that are due this frame (if not paused).
+        // Slow frames run several ticks, fast frames may run none.
         if (!paused) {
-            // Scan chunks to determine which are active (includes newly painted voxels)
-            physicsDispatcher->DispatchChunkScan(
-                commandList.Get(),
-                *voxelWorld,
-                *chunkManager,
-                static_cast<uint32_t>(frameCount)
-            );
-
-            // Run physics on active chunks using ExecuteIndirect
-            physicsDispatcher->DispatchPhysicsIndirect(
-                commandList.Get(),
-                *voxelWorld,
-                *chunkManager,
-                1.0f/60.0f,
-                static_cast<uint32_t>(frameCount)
-            );
+            simulationClock.Update(frameSeconds, [&](const Simulation::SimulationTick& tick) {
+                // Scan chunks to determine which are active (includes newly painted voxels)
+                physicsDispatcher->DispatchChunkScan(
+                    commandList.Get(),
+                    *voxelWorld,
+                    *chunkManager,
+                    static_cast<uint32_t>(tick.index)
+                );
+
+                // Run physics on active chunks using ExecuteIndirect
+                physicsDispatcher->DispatchPhysicsIndirect(
+                    commandList.Get(),
+                    *voxelWorld,
+                    *chunkManager,
+                    tick.deltaTime,
+                    static_cast<uint32_t>(tick.index)
+                );
+            });
         }
 
         // Transition read buffer to pixel shader resource for rendering
@@ -573,7 +592,9 @@ int main(int argc, char* argv[]) {
 
         // Log FPS every 100 frames
         if (frameCount % 100 == 0) {
-            spdlog::debug("Frame {}", frameCount);
+            const Simulation::SimulationClockStats& clockStats = simulationClock.GetStats();
+            spdlog::debug("Frame {}: {} ticks, {:.2f} ms/tick recorded, lag {:.1f} ms, {} steps dropped",
+                frameCount, clockStats.ticks, clockStats.averageTickMs, clockStats.lagMs, clockStats.droppedSteps);
         }
     }
 
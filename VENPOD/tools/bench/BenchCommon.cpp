@@ -0,0 +1,48 @@
+#include "BenchCommon.h"
+#include "Utils/BitPacking.h"
+#include <algorithm>
+
+namespace VENPOD::Bench {
+
+using namespace Simulation;
+
+void SeedScalingWorld(CPUSimulation& sim) {
+    uint32_t sx = sim.GetGridSizeX();
+    uint32_t sy = sim.GetGridSizeY();
+    uint32_t sz = sim.GetGridSizeZ();
+
+    for (uint32_t z = 0; z < sz; ++z) {
+        for (uint32_t x = 0; x < sx; ++x) {
+            sim.SetVoxel(x, 0, z, Utils::PackVoxel(Utils::Material::Stone, 0, 0, Utils::StateFlags::IsStatic));
+
+            for (uint32_t y = sy / 2; y < sy - 2; ++y) {
+                uint32_t band = (y / 4 + x / 16 + z / 16) % 3;
+                uint8_t material = band == 0 ? Utils::Material::Sand
+                                 : band == 1 ? Utils::Material::Water
+                                             : Utils::Material::Air;
+                if (material != Utils::Material::Air) {
+                    sim.SetVoxel(x, y, z, Utils::PackVoxel(material, static_cast<uint8_t>(x ^ z), 0, 0));
+                }
+            }
+        }
+    }
+}
+
+uint64_t HashWorld(const std::vector<uint32_t>& voxels) {
+    uint64_t hash = 14695981039346656037ull;   // FNV-1a
+    for (uint32_t voxel : voxels) {
+        hash = (hash ^ voxel) * 1099511628211ull;
+    }
+    return hash;
+}
+
+std::vector<ChunkCoord> MakeTerrainBenchChunks(uint32_t count) {
+    std::vector<ChunkCoord> coords;
+    for (uint32_t i = 0; coords.size() < std::max(count, 1u); ++i) {
+        coords.push_back(ChunkCoord{ static_cast<int32_t>(i / 4 % 8), static_cast<int32_t>(i % 4) - 1,
+                                     static_cast<int32_t>(i / 32) });
+    }
+    return coords;
+}
+
+} // namespace VENPOD::Bench
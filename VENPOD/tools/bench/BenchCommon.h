@@ -0,0 +1,72 @@
+#pragma once
+
+// =============================================================================
+// VENPOD Bench Common - Options, subcommand entry points and shared worlds
+// Each subcommand lives in its own <Name>Bench.cpp; main.cpp parses the
+// command line and dispatches through its command table.
+// =============================================================================
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "Simulation/CPUSimulation.h"
+#include "Simulation/ChunkCoord.h"
+#include <spdlog/spdlog.h>
+#include <fmt/format.h>
+
+namespace VENPOD::Bench {
+
+struct BenchOptions {
+    uint32_t gridSize = 128;
+    uint32_t ticks = 100;
+    uint32_t maxThreads = 64;
+    Simulation::CPUScheduleMode scheduleMode = Simulation::CPUScheduleMode::Checkerboard;
+    Simulation::CPUKernelMode kernelMode = Simulation::CPUKernelMode::Scalar;
+    uint32_t threads = 0;       // liquid: worker count, 0 = hardware concurrency
+    uint32_t rate = 60;         // clock: fixed steps per second
+    uint32_t substeps = 1;      // clock: ticks per fixed step
+    const char* scenario = nullptr;  // scenarios: run only this scene
+    const char* outPath = nullptr;   // scenarios: JSON report file instead of stdout
+    bool validateMass = false;       // scenarios: per-tick mass check
+};
+
+// Subcommands (exit code 0 = ok, non-zero = failed check)
+int RunScaling(const BenchOptions& options);
+int RunLiquid(const BenchOptions& options);
+int RunSleep(const BenchOptions& options);
+int RunClock(const BenchOptions& options);
+int RunScenarios(const BenchOptions& options);
+int RunPalette(const BenchOptions& options);
+int RunCoordMap(const BenchOptions& options);
+int RunGenQueue(const BenchOptions& options);
+int RunStreaming(const BenchOptions& options);
+int RunTerrain(const BenchOptions& options);
+int RunNoise(const BenchOptions& options);
+int RunCaves(const BenchOptions& options);
+int RunRegion(const BenchOptions& options);
+int RunRle(const BenchOptions& options);
+int RunLz(const BenchOptions& options);
+int RunJournal(const BenchOptions& options);
+int RunSnapshot(const BenchOptions& options);
+
+// Sand and water slabs suspended over a stone floor - keeps most chunks busy
+void SeedScalingWorld(Simulation::CPUSimulation& sim);
+
+// FNV-1a over a voxel grid, to compare final worlds between runs
+uint64_t HashWorld(const std::vector<uint32_t>& voxels);
+
+// Columns of four layers: y = -1 (deep), 0 (bedrock, sea level), 1, 2
+std::vector<Simulation::ChunkCoord> MakeTerrainBenchChunks(uint32_t count);
+
+// ChunkCoord::Hash before the flat map: 32-bit FNV constants over sign-extended size_t
+struct LegacyChunkCoordHash {
+    size_t operator()(const Simulation::ChunkCoord& coord) const noexcept {
+        size_t hash = 2166136261u;
+        hash = (hash ^ static_cast<size_t>(coord.x)) * 16777619u;
+        hash = (hash ^ static_cast<size_t>(coord.y)) * 16777619u;
+        hash = (hash ^ static_cast<size_t>(coord.z)) * 16777619u;
+        return hash;
+    }
+};
+
+} // namespace VENPOD::Bench
@@ -0,0 +1,139 @@
+// =============================================================================
+// VENPOD Bench - caves
+//
+// caves: generates the terrain bench's --ticks chunks with exact cave noise
+// and with the coarse cave lattice at spacings 2, 4 and 8, and reports
+// chunks/s, cave FBM evaluations per chunk, the mean / max error of the
+// interpolated density below the surface, how often it lands on the other
+// side of the cave threshold (flip rate) and the fraction of voxels that end
+// up different from exact generation.
+// =============================================================================
+
+#include "BenchCommon.h"
+#include "Simulation/TerrainGenerator.h"
+#include "Simulation/TerrainColumnCache.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <string>
+#include <memory>
+
+namespace VENPOD::Bench {
+
+using namespace Simulation;
+
+int RunCaves(const BenchOptions& options) {
+    using Clock = std::chrono::steady_clock;
+    const uint32_t chunkSize = 64;
+    const uint32_t seed = 12345;
+    const size_t voxelCount = static_cast<size_t>(chunkSize) * chunkSize * chunkSize;
+    const std::vector<ChunkCoord> coords = MakeTerrainBenchChunks(options.ticks);
+
+    // Columns shared by every mode so the timings isolate cave carving
+    TerrainColumnCache columnCache;
+    columnCache.Initialize(chunkSize, seed);
+    std::vector<std::shared_ptr<const TerrainColumn>> columns;
+    for (const ChunkCoord& coord : coords) {
+        columns.push_back(columnCache.Acquire(coord.x, coord.z));
+    }
+
+    // Exact reference: voxels and cave density
+    std::vector<std::vector<uint32_t>> exactVoxels(coords.size(), std::vector<uint32_t>(voxelCount));
+    std::vector<std::vector<float>> exactNoise(coords.size(), std::vector<float>(voxelCount));
+    size_t subsurfaceVoxels = 0;
+    for (size_t i = 0; i < coords.size(); ++i) {
+        int32_t ox, oy, oz;
+        coords[i].GetWorldOrigin(ox, oy, oz, chunkSize);
+        SampleCaveNoise(ox, oy, oz, chunkSize, seed, CAVE_LATTICE_EXACT, exactNoise[i].data());
+        for (uint32_t lz = 0; lz < chunkSize; ++lz) {
+            for (uint32_t ly = 0; ly < chunkSize; ++ly) {
+                for (uint32_t lx = 0; lx < chunkSize; ++lx) {
+                    const int32_t worldY = oy + static_cast<int32_t>(ly);
+                    if (worldY != 0 && static_cast<float>(worldY) < columns[i]->height[lx + lz * chunkSize]) {
+                        ++subsurfaceVoxels;
+                    }
+                }
+            }
+        }
+    }
+
+    fmt::print("{} chunks of {}³, seed {}, {} sub-surface voxels ({:.1f}%) use cave noise\n", coords.size(), chunkSize,
+        seed, subsurfaceVoxels, 100.0 * subsurfaceVoxels / (static_cast<double>(voxelCount) * coords.size()));
+    fmt::print("{:>8} {:>10} {:>9} {:>14} {:>11} {:>11} {:>11} {:>12}\n", "lattice", "chunks/s", "speedup",
+        "FBM evals/chk", "mean err", "max err", "flip rate", "voxels diff");
+
+    std::vector<uint32_t> voxels(voxelCount);
+    std::vector<float> noise(voxelCount);
+    double exactRate = 0.0;
+    for (uint32_t lattice : { CAVE_LATTICE_EXACT, 2u, 4u, 8u }) {
+        // ===== Generation throughput =====
+        size_t differentVoxels = 0;
+        double seconds = 0.0;
+        for (size_t i = 0; i < coords.size(); ++i) {
+            int32_t ox, oy, oz;
+            coords[i].GetWorldOrigin(ox, oy, oz, chunkSize);
+            auto start = Clock::now();
+            GenerateChunkVoxels(ox, oy, oz, chunkSize, seed, voxels.data(), columns[i].get(), lattice);
+            seconds += std::chrono::duration<double>(Clock::now() - start).count();
+            for (size_t v = 0; v < voxelCount; ++v) {
+                differentVoxels += voxels[v] != exactVoxels[i][v] && lattice != CAVE_LATTICE_EXACT;
+            }
+            if (lattice == CAVE_LATTICE_EXACT) {
+                exactVoxels[i] = voxels;
+            }
+        }
+        const double rate = coords.size() / seconds;
+        if (lattice == CAVE_LATTICE_EXACT) {
+            exactRate = rate;
+        }
+
+        // ===== Density error below the surface =====
+        double errorSum = 0.0;
+        float maxError = 0.0f;
+        size_t flips = 0;
+        size_t evaluations = 0;
+        for (size_t i = 0; i < coords.size(); ++i) {
+            int32_t ox, oy, oz;
+            coords[i].GetWorldOrigin(ox, oy, oz, chunkSize);
+            SampleCaveNoise(ox, oy, oz, chunkSize, seed, lattice, noise.data());
+
+            float maxHeight = 0.0f;
+            for (uint32_t lz = 0; lz < chunkSize; ++lz) {
+                for (uint32_t ly = 0; ly < chunkSize; ++ly) {
+                    const int32_t worldY = oy + static_cast<int32_t>(ly);
+                    for (uint32_t lx = 0; lx < chunkSize; ++lx) {
+                        const float height = columns[i]->height[lx + lz * chunkSize];
+                        maxHeight = std::max(maxHeight, height);
+                        if (worldY == 0 || static_cast<float>(worldY) >= height) {
+                            continue;
+                        }
+                        const size_t index = lx + ly * chunkSize + static_cast<size_t>(lz) * chunkSize * chunkSize;
+                        const float error = std::fabs(noise[index] - exactNoise[i][index]);
+                        errorSum += error;
+                        maxError = std::max(maxError, error);
+                        flips += (noise[index] < CAVE_NOISE_THRESHOLD) != (exactNoise[i][index] < CAVE_NOISE_THRESHOLD);
+                        evaluations += lattice == CAVE_LATTICE_EXACT;
+                    }
+                }
+            }
+
+            // Lattice nodes GenerateChunkVoxels samples (up to the highest terrain)
+            if (lattice != CAVE_LATTICE_EXACT) {
+                const float localTop = std::clamp(std::ceil(maxHeight) - static_cast<float>(oy), 0.0f,
+                    static_cast<float>(chunkSize));
+                const size_t nodesXZ = chunkSize / lattice + 1;
+                const size_t nodesY = localTop < 1.0f ? 0 : (static_cast<uint32_t>(localTop) - 1) / lattice + 2;
+                evaluations += nodesXZ * nodesXZ * nodesY;
+            }
+        }
+
+        const double subsurface = static_cast<double>(std::max<size_t>(subsurfaceVoxels, 1));
+        fmt::print("{:>8} {:>10.1f} {:>8.1f}x {:>14.0f} {:>11.4f} {:>11.4f} {:>10.3f}% {:>11.3f}%\n",
+            lattice == CAVE_LATTICE_EXACT ? std::string("exact") : std::to_string(lattice), rate, rate / exactRate,
+            static_cast<double>(evaluations) / coords.size(), errorSum / subsurface, maxError,
+            100.0 * flips / subsurface, 100.0 * differentVoxels / (static_cast<double>(voxelCount) * coords.size()));
+    }
+    return 0;
+}
+
+} // namespace VENPOD::Bench
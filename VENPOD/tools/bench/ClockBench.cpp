@@ -0,0 +1,120 @@
+// =============================================================================
+// VENPOD Bench - clock
+//
+// clock: drives the scaling world through SimulationClock, first unthrottled
+// for --ticks ticks (maximum throughput), then throttled to --rate steps per
+// second for two seconds of 120 Hz frames with a 300 ms stall half way, to
+// show the catch-up cap and the lag counters.
+// =============================================================================
+
+#include "BenchCommon.h"
+#include "Simulation/SimulationClock.h"
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+namespace VENPOD::Bench {
+
+using namespace Simulation;
+
+namespace {
+
+// Nearest-rank percentile of an ascending sample list
+
+} // namespace
+
+int RunClock(const BenchOptions& options) {
+    CPUSimulationConfig config;
+    config.gridSizeX = options.gridSize;
+    config.gridSizeY = options.gridSize;
+    config.gridSizeZ = options.gridSize;
+    config.workerCount = options.threads;
+    config.kernelMode = options.kernelMode;
+    config.validateMass = false;
+
+    fmt::print("Clock benchmark: {}^3 grid, {} steps/s x {} substeps\n",
+        options.gridSize, options.rate, options.substeps);
+
+    // ===== Unthrottled: ticks back to back =====
+    {
+        CPUSimulation sim;
+        auto result = sim.Initialize(config);
+        if (!result) {
+            spdlog::error("Failed to initialize simulation: {}", result.error());
+            return 1;
+        }
+        SeedScalingWorld(sim);
+
+        SimulationClockConfig clockConfig;
+        clockConfig.ticksPerSecond = options.rate;
+        clockConfig.substeps = options.substeps;
+        clockConfig.maxStepsPerUpdate = 16;
+        clockConfig.unthrottled = true;
+        SimulationClock clock;
+        clock.Initialize(clockConfig);
+
+        uint64_t totalVoxels = 0;
+        auto start = std::chrono::steady_clock::now();
+        while (clock.GetStats().ticks < options.ticks) {
+            clock.Update(0.0, [&](const SimulationTick& tick) {
+                sim.Step(static_cast<uint32_t>(tick.index));
+                totalVoxels += sim.GetStats().voxelsProcessed;
+            });
+        }
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        const SimulationClockStats& stats = clock.GetStats();
+        fmt::print("unthrottled: {} ticks in {:.2f} s, {:.1f} ticks/s ({:.1f}x real time), "
+                   "{:.2f} Mvoxels/s, tick avg {:.3f} ms, max {:.3f} ms\n",
+            stats.ticks, seconds, stats.ticks / seconds, stats.simulatedSeconds / seconds,
+            totalVoxels / (seconds * 1e6), stats.averageTickMs, stats.maxTickMs);
+    }
+
+    // ===== Throttled: 120 Hz frames for two seconds, one 300 ms stall =====
+    {
+        CPUSimulation sim;
+        auto result = sim.Initialize(config);
+        if (!result) {
+            spdlog::error("Failed to initialize simulation: {}", result.error());
+            return 1;
+        }
+        SeedScalingWorld(sim);
+
+        SimulationClockConfig clockConfig;
+        clockConfig.ticksPerSecond = options.rate;
+        clockConfig.substeps = options.substeps;
+        SimulationClock clock;
+        clock.Initialize(clockConfig);
+
+        const auto frameTime = std::chrono::microseconds(1000000 / 120);
+        auto start = std::chrono::steady_clock::now();
+        auto last = start;
+        bool stalled = false;
+        uint32_t maxUpdateTicks = 0;
+        while (last - start < std::chrono::seconds(2)) {
+            std::this_thread::sleep_until(last + frameTime);
+            if (!stalled && last - start >= std::chrono::seconds(1)) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(300));
+                stalled = true;
+            }
+            auto now = std::chrono::steady_clock::now();
+            double elapsed = std::chrono::duration<double>(now - last).count();
+            last = now;
+
+            clock.Update(elapsed, [&](const SimulationTick& tick) {
+                sim.Step(static_cast<uint32_t>(tick.index));
+            });
+            maxUpdateTicks = std::max(maxUpdateTicks, clock.GetStats().lastUpdateTicks);
+        }
+
+        const SimulationClockStats& stats = clock.GetStats();
+        fmt::print("throttled:   {} ticks in {:.2f} s wall, {:.1f} ticks/s (target {}), "
+                   "{:.2f} s simulated, {} steps dropped, max {} ticks/frame, lag {:.2f} ms, tick avg {:.3f} ms\n",
+            stats.ticks, stats.wallSeconds, stats.ticks / stats.wallSeconds, options.rate * options.substeps,
+            stats.simulatedSeconds, stats.droppedSteps, maxUpdateTicks, stats.lagMs, stats.averageTickMs);
+    }
+
+    return 0;
+}
+
+} // namespace VENPOD::Bench
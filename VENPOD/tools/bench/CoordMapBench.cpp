@@ -0,0 +1,180 @@
+// =============================================================================
+// VENPOD Bench - coordmap
+//
+// coordmap: fills a loaded-chunk cylinder (±10 horizontal, ±4 vertical,
+// centred on the origin so half the coordinates are negative) into
+// std::unordered_map with the old FNV ChunkCoord hash, std::unordered_map
+// with the current hash, and ChunkCoordMap, then reports insert, 6-neighbour
+// lookup, erase and camera-streaming throughput over --ticks rounds.
+// =============================================================================
+
+#include "BenchCommon.h"
+#include "Simulation/ChunkCoordMap.h"
+#include "Utils/PCGRandom.h"
+#include <algorithm>
+#include <chrono>
+#include <unordered_map>
+
+namespace VENPOD::Bench {
+
+using namespace Simulation;
+
+namespace {
+
+// Same operations over both map interfaces
+template <typename Hash>
+struct StdCoordMap {
+    std::unordered_map<ChunkCoord, uint32_t, Hash> map;
+    void Insert(const ChunkCoord& c, uint32_t v) { map[c] = v; }
+    const uint32_t* Find(const ChunkCoord& c) const { auto it = map.find(c); return it != map.end() ? &it->second : nullptr; }
+    void Erase(const ChunkCoord& c) { map.erase(c); }
+    size_t Size() const { return map.size(); }
+    // Longest bucket chain
+    uint32_t LongestProbe() const {
+        size_t longest = 0;
+        for (size_t b = 0; b < map.bucket_count(); ++b) {
+            longest = std::max(longest, map.bucket_size(b));
+        }
+        return static_cast<uint32_t>(longest);
+    }
+};
+
+struct FlatCoordMap {
+    ChunkCoordMap<uint32_t> map;
+    void Insert(const ChunkCoord& c, uint32_t v) { map.Insert(c, v); }
+    const uint32_t* Find(const ChunkCoord& c) const { return map.Find(c); }
+    void Erase(const ChunkCoord& c) { map.Erase(c); }
+    size_t Size() const { return map.Size(); }
+    uint32_t LongestProbe() const { return map.GetMaxProbeLength(); }
+};
+
+struct CoordMapResult {
+    double insertMops = 0.0;
+    double lookupMops = 0.0;
+    double eraseMops = 0.0;
+    double streamMops = 0.0;
+    uint32_t longestProbe = 0;
+    uint64_t checksum = 0;
+};
+
+template <typename Map>
+CoordMapResult RunCoordMapCase(const std::vector<ChunkCoord>& coords, int32_t radius, int32_t vertical, uint32_t rounds) {
+    using Clock = std::chrono::steady_clock;
+    auto seconds = [](Clock::time_point a, Clock::time_point b) { return std::chrono::duration<double>(b - a).count(); };
+    static const int32_t neighbours[6][3] = { {1,0,0}, {-1,0,0}, {0,1,0}, {0,-1,0}, {0,0,1}, {0,0,-1} };
+
+    CoordMapResult result;
+    double insertSeconds = 0.0, lookupSeconds = 0.0, eraseSeconds = 0.0, streamSeconds = 0.0;
+    uint64_t lookups = 0, streamOps = 0;
+
+    for (uint32_t round = 0; round < rounds; ++round) {
+        Map map;
+
+        // ===== Insert the whole loaded set =====
+        auto start = Clock::now();
+        for (uint32_t i = 0; i < coords.size(); ++i) {
+            map.Insert(coords[i], i);
+        }
+        insertSeconds += seconds(start, Clock::now());
+        result.longestProbe = map.LongestProbe();
+
+        // ===== Cross-chunk neighbour lookups (mostly hits, misses at the rim) =====
+        start = Clock::now();
+        for (const ChunkCoord& c : coords) {
+            for (const auto& n : neighbours) {
+                const uint32_t* value = map.Find(ChunkCoord{ c.x + n[0], c.y + n[1], c.z + n[2] });
+                result.checksum += value ? *value + 1 : 0;
+            }
+        }
+        lookupSeconds += seconds(start, Clock::now());
+        lookups += coords.size() * 6;
+
+        // ===== Camera streaming along +X: unload the trailing slab, load the leading one =====
+        start = Clock::now();
+        for (int32_t step = 0; step < 2 * radius; ++step) {
+            for (int32_t dy = -vertical; dy <= vertical; ++dy) {
+                for (int32_t dz = -radius; dz <= radius; ++dz) {
+                    map.Erase(ChunkCoord{ step - radius, dy, dz });
+                    map.Insert(ChunkCoord{ step + radius + 1, dy, dz }, static_cast<uint32_t>(step));
+                    streamOps += 2;
+                }
+            }
+        }
+        streamSeconds += seconds(start, Clock::now());
+        result.checksum += map.Size();
+
+        // ===== Erase everything that is left =====
+        std::vector<ChunkCoord> remaining;
+        for (int32_t x = radius; x <= 3 * radius; ++x) {
+            for (int32_t dy = -vertical; dy <= vertical; ++dy) {
+                for (int32_t dz = -radius; dz <= radius; ++dz) {
+                    remaining.push_back(ChunkCoord{ x, dy, dz });
+                }
+            }
+        }
+        for (const ChunkCoord& c : coords) {
+            remaining.push_back(c);
+        }
+        start = Clock::now();
+        for (const ChunkCoord& c : remaining) {
+            map.Erase(c);
+        }
+        eraseSeconds += seconds(start, Clock::now());
+        result.checksum += map.Size();
+    }
+
+    double inserts = static_cast<double>(coords.size()) * rounds;
+    result.insertMops = inserts / insertSeconds / 1e6;
+    result.lookupMops = lookups / lookupSeconds / 1e6;
+    result.streamMops = streamOps / streamSeconds / 1e6;
+    result.eraseMops = inserts / eraseSeconds / 1e6;
+    return result;
+}
+
+} // namespace
+
+int RunCoordMap(const BenchOptions& options) {
+    const int32_t radius = 10;
+    const int32_t vertical = 4;
+
+    // Same cylinder as InfiniteChunkManager's loading pattern, shuffled
+    std::vector<ChunkCoord> coords;
+    for (int32_t dy = -vertical; dy <= vertical; ++dy) {
+        for (int32_t dx = -radius; dx <= radius; ++dx) {
+            for (int32_t dz = -radius; dz <= radius; ++dz) {
+                if (dx * dx + dz * dz <= radius * radius) {
+                    coords.push_back(ChunkCoord{ dx, dy, dz });
+                }
+            }
+        }
+    }
+    for (size_t i = coords.size() - 1; i > 0; --i) {
+        std::swap(coords[i], coords[Utils::PCGHash(static_cast<uint32_t>(i)) % (i + 1)]);
+    }
+
+    fmt::print("{} chunk coordinates (±{} horizontal, ±{} vertical), {} rounds\n",
+        coords.size(), radius, vertical, options.ticks);
+    fmt::print("{:>26} {:>12} {:>12} {:>12} {:>12} {:>8}\n",
+        "map", "insert Mop/s", "lookup Mop/s", "stream Mop/s", "erase Mop/s", "probe");
+
+    auto print = [](const char* name, const CoordMapResult& r) {
+        fmt::print("{:>26} {:>12.1f} {:>12.1f} {:>12.1f} {:>12.1f} {:>8}\n",
+            name, r.insertMops, r.lookupMops, r.streamMops, r.eraseMops, r.longestProbe);
+    };
+
+    CoordMapResult legacy = RunCoordMapCase<StdCoordMap<LegacyChunkCoordHash>>(coords, radius, vertical, options.ticks);
+    CoordMapResult stdMap = RunCoordMapCase<StdCoordMap<std::hash<ChunkCoord>>>(coords, radius, vertical, options.ticks);
+    CoordMapResult flat = RunCoordMapCase<FlatCoordMap>(coords, radius, vertical, options.ticks);
+    print("unordered_map (old hash)", legacy);
+    print("unordered_map (new hash)", stdMap);
+    print("ChunkCoordMap", flat);
+    fmt::print("probe: longest bucket chain (unordered_map) or probe sequence (ChunkCoordMap)\n");
+
+    if (legacy.checksum != flat.checksum || stdMap.checksum != flat.checksum) {
+        spdlog::error("Maps disagree: checksums {} / {} / {}", legacy.checksum, stdMap.checksum, flat.checksum);
+        return 2;
+    }
+    return 0;
+}
+
+} // namespace VENPOD::Bench
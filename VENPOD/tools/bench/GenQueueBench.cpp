@@ -0,0 +1,174 @@
+// =============================================================================
+// VENPOD Bench - genqueue
+//
+// genqueue: teleports the camera and queues InfiniteChunkManager's default
+// render cylinder (±8 horizontal, ±2 vertical) in the old order (FIFO over an
+// unordered_set with the old hash) and through ChunkGenerationQueue, then
+// reports how many chunks are generated before the camera chunk and every
+// in-view chunk within 2 and 4 chunks exist, plus the cost of re-prioritising
+// the full queue (SetView) averaged over --ticks rounds.
+// =============================================================================
+
+#include "BenchCommon.h"
+#include "Simulation/ChunkGenerationQueue.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <unordered_set>
+
+namespace VENPOD::Bench {
+
+using namespace Simulation;
+
+namespace {
+
+struct GenQueueResult {
+    uint32_t cameraChunk = 0;       // Chunks generated until the camera chunk exists
+    uint32_t inView2 = 0;           // ... until every in-view chunk within 2 chunks exists
+    uint32_t inView4 = 0;           // ... within 4 chunks
+    uint32_t total = 0;
+};
+
+// Replays a generation order and records when each milestone is reached
+GenQueueResult MeasureGenerationOrder(const std::vector<ChunkCoord>& order, const ChunkGenerationQueue& view) {
+    const ChunkGenerationView& v = view.GetView();
+    const float invSize = 1.0f / static_cast<float>(v.chunkSize);
+
+    // Milestone sets, judged by distance and angle to the chunk centre
+    auto inView = [&](const ChunkCoord& c, float radius) {
+        float dx = c.x + 0.5f - v.position[0] * invSize;
+        float dy = c.y + 0.5f - v.position[1] * invSize;
+        float dz = c.z + 0.5f - v.position[2] * invSize;
+        float distance = std::sqrt(dx * dx + dy * dy + dz * dz);
+        if (distance > radius) {
+            return false;
+        }
+        return distance <= v.nearRadius ||
+               (dx * v.forward[0] + dy * v.forward[1] + dz * v.forward[2]) / distance >= v.viewConeCos;
+    };
+    uint32_t need2 = 0, need4 = 0;
+    for (const ChunkCoord& c : order) {
+        need2 += inView(c, 2.0f) ? 1 : 0;
+        need4 += inView(c, 4.0f) ? 1 : 0;
+    }
+
+    const ChunkCoord camera = ChunkCoord::FromWorldPosition(
+        static_cast<int32_t>(std::floor(v.position[0])),
+        static_cast<int32_t>(std::floor(v.position[1])),
+        static_cast<int32_t>(std::floor(v.position[2])),
+        v.chunkSize);
+
+    GenQueueResult result;
+    result.total = static_cast<uint32_t>(order.size());
+    uint32_t have2 = 0, have4 = 0;
+    for (uint32_t i = 0; i < order.size(); ++i) {
+        const ChunkCoord& c = order[i];
+        if (c == camera) {
+            result.cameraChunk = i + 1;
+        }
+        if (inView(c, 2.0f) && ++have2 == need2) {
+            result.inView2 = i + 1;
+        }
+        if (inView(c, 4.0f) && ++have4 == need4) {
+            result.inView4 = i + 1;
+        }
+    }
+    return result;
+}
+
+} // namespace
+
+int RunGenQueue(const BenchOptions& options) {
+    using Clock = std::chrono::steady_clock;
+    const int32_t radius = 8;
+    const int32_t vertical = 2;
+    const uint32_t chunkSize = 64;
+
+    // Teleport target: far from the origin, looking along +X and slightly down
+    ChunkGenerationView view;
+    view.position[0] = 1000.5f * chunkSize;
+    view.position[1] = 2.25f * chunkSize;
+    view.position[2] = -700.5f * chunkSize;
+    view.forward[0] = 0.9f;
+    view.forward[1] = -0.2f;
+    view.forward[2] = 0.4f;
+    view.chunkSize = chunkSize;
+
+    const ChunkCoord camera = ChunkCoord::FromWorldPosition(
+        static_cast<int32_t>(view.position[0]), static_cast<int32_t>(view.position[1]),
+        static_cast<int32_t>(view.position[2]), chunkSize);
+
+    // Old order: QueueChunksAroundCamera's unordered_set iteration, then FIFO
+    std::unordered_set<ChunkCoord, LegacyChunkCoordHash> chunksToLoad;
+    for (int32_t dy = -vertical; dy <= vertical; ++dy) {
+        for (int32_t dx = -radius; dx <= radius; ++dx) {
+            for (int32_t dz = -radius; dz <= radius; ++dz) {
+                if (dx * dx + dz * dz <= radius * radius) {
+                    chunksToLoad.insert(ChunkCoord{ camera.x + dx, camera.y + dy, camera.z + dz });
+                }
+            }
+        }
+    }
+    std::vector<ChunkCoord> fifoOrder(chunksToLoad.begin(), chunksToLoad.end());
+
+    // New order: the priority queue, distance only and view-weighted
+    auto drain = [&](const ChunkGenerationView& queueView, ChunkGenerationQueue& queue) {
+        queue.SetView(queueView);
+        for (const ChunkCoord& c : fifoOrder) {
+            queue.Push(c);
+        }
+        std::vector<ChunkCoord> order;
+        ChunkCoord c;
+        while (queue.Pop(c)) {
+            order.push_back(c);
+        }
+        return order;
+    };
+    ChunkGenerationView distanceView = view;
+    distanceView.forward[0] = distanceView.forward[1] = distanceView.forward[2] = 0.0f;
+    ChunkGenerationQueue distanceQueue, viewQueue;
+    std::vector<ChunkCoord> distanceOrder = drain(distanceView, distanceQueue);
+    std::vector<ChunkCoord> viewOrder = drain(view, viewQueue);
+
+    // Milestones are always judged against the view-weighted cone
+    GenQueueResult fifo = MeasureGenerationOrder(fifoOrder, viewQueue);
+    GenQueueResult distance = MeasureGenerationOrder(distanceOrder, viewQueue);
+    GenQueueResult weighted = MeasureGenerationOrder(viewOrder, viewQueue);
+
+    fmt::print("{} chunks queued after teleport (±{} horizontal, ±{} vertical)\n", fifoOrder.size(), radius, vertical);
+    fmt::print("chunks generated before ... exist (= frames at chunksPerFrame 1)\n");
+    fmt::print("{:>20} {:>14} {:>14} {:>14}\n", "order", "camera chunk", "in view <= 2", "in view <= 4");
+    auto print = [](const char* name, const GenQueueResult& r) {
+        fmt::print("{:>20} {:>14} {:>14} {:>14}\n", name, r.cameraChunk, r.inView2, r.inView4);
+    };
+    print("FIFO (old)", fifo);
+    print("distance", distance);
+    print("distance + view", weighted);
+
+    // ===== Re-prioritise a full queue, as after a turn or chunk change =====
+    ChunkGenerationQueue queue;
+    queue.SetView(view);
+    for (const ChunkCoord& c : fifoOrder) {
+        queue.Push(c);
+    }
+    double totalSeconds = 0.0;
+    for (uint32_t round = 0; round < options.ticks; ++round) {
+        ChunkGenerationView turned = view;
+        float angle = 0.3f * static_cast<float>(round + 1);
+        turned.forward[0] = std::cos(angle);
+        turned.forward[2] = std::sin(angle);
+        auto start = Clock::now();
+        queue.SetView(turned);
+        totalSeconds += std::chrono::duration<double>(Clock::now() - start).count();
+    }
+    fmt::print("SetView over {} queued chunks: {:.1f} us (mean of {} rounds)\n",
+        queue.Size(), totalSeconds * 1e6 / std::max(options.ticks, 1u), options.ticks);
+
+    if (distance.total != fifo.total || weighted.total != fifo.total || queue.Size() != fifoOrder.size()) {
+        spdlog::error("Priority queue lost or duplicated chunks");
+        return 2;
+    }
+    return 0;
+}
+
+} // namespace VENPOD::Bench
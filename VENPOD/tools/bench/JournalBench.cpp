@@ -0,0 +1,297 @@
+// =============================================================================
+// VENPOD Bench - journal
+//
+// journal: settles a world of resting sand dunes, saves all of its 16³ chunks
+// once, then runs --ticks ticks of physics with a brush dropping sand every
+// few ticks.
+// Every 10 ticks an autosave journals only the chunks the simulation reports
+// changed and syncs the journal, while a few journaled chunks per tick are
+// compacted into the region files. Reports autosave ms and chunks per
+// checkpoint against the full save and the time compaction takes per tick,
+// then copies the directory as a crash would leave it, reopens the copy
+// (journal replay) and the cleanly closed original, and checks every chunk
+// against the simulation.
+// Last, one chunk goes the way of an InfiniteChunkManager chunk: loaded, a
+// GPU edit read back through SharedVoxels::Edit(), journaled as it unloads
+// and loaded again after the store is reopened; the edit must be there.
+// =============================================================================
+
+#include "BenchCommon.h"
+#include "Simulation/PalettedVoxels.h"
+#include "Simulation/ChunkCoordMap.h"
+#include "Simulation/RegionStore.h"
+#include "Simulation/ChunkSnapshot.h"
+#include "Utils/BitPacking.h"
+#include "Utils/MortonCode.h"
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+
+namespace VENPOD::Bench {
+
+using namespace Simulation;
+
+namespace {
+
+// One CPU simulation chunk as a PalettedVoxels of edge CHUNK_SIZE
+void EncodeSimChunk(const CPUSimulation& sim, const ChunkCoord& coord, std::vector<uint32_t>& scratch, PalettedVoxels& out) {
+    scratch.resize(static_cast<size_t>(CHUNK_SIZE) * CHUNK_SIZE * CHUNK_SIZE);
+    for (uint32_t z = 0; z < CHUNK_SIZE; ++z) {
+        for (uint32_t y = 0; y < CHUNK_SIZE; ++y) {
+            for (uint32_t x = 0; x < CHUNK_SIZE; ++x) {
+                scratch[Utils::LinearIndex3D(x, y, z, CHUNK_SIZE, CHUNK_SIZE)] = sim.GetVoxel(
+                    coord.x * CHUNK_SIZE + x, coord.y * CHUNK_SIZE + y, coord.z * CHUNK_SIZE + z);
+            }
+        }
+    }
+    out.Initialize(CHUNK_SIZE);
+    out.Encode(scratch.data());
+}
+
+// True when every chunk of the simulation loads from `store` as its current voxels
+bool VerifySimChunks(RegionStore& store, const CPUSimulation& sim, const std::vector<ChunkCoord>& coords) {
+    std::vector<uint32_t> expected;
+    std::vector<uint32_t> decoded(static_cast<size_t>(CHUNK_SIZE) * CHUNK_SIZE * CHUNK_SIZE);
+    PalettedVoxels current;
+    PalettedVoxels loaded;
+    for (const ChunkCoord& coord : coords) {
+        auto found = store.LoadChunk(coord, loaded);
+        if (!found || !found.Value()) {
+            return false;
+        }
+        EncodeSimChunk(sim, coord, expected, current);
+        loaded.Decode(decoded.data());
+        if (decoded != expected) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+int RunJournal(const BenchOptions& options) {
+    using Clock = std::chrono::steady_clock;
+    constexpr uint32_t SETTLE_TICKS = 200;
+    constexpr uint32_t AUTOSAVE_TICKS = 10;
+    constexpr uint32_t BRUSH_TICKS = 5;
+    constexpr size_t COMPACTION_BUDGET = 4;
+
+    CPUSimulationConfig config;
+    config.gridSizeX = options.gridSize;
+    config.gridSizeY = options.gridSize;
+    config.gridSizeZ = options.gridSize;
+    config.workerCount = options.threads;
+    config.validateMass = false;
+    CPUSimulation sim;
+    auto simResult = sim.Initialize(config);
+    if (!simResult) {
+        spdlog::error("Failed to initialize simulation: {}", simResult.error());
+        return 1;
+    }
+    const uint32_t size = options.gridSize;
+    for (uint32_t z = 0; z < size; ++z) {
+        for (uint32_t x = 0; x < size; ++x) {
+            sim.SetVoxel(x, 0, z, Utils::PackVoxel(Utils::Material::Stone, 0, 0, Utils::StateFlags::IsStatic));
+            const uint32_t height = size / 8 + (x / 8 + z / 8) % 4;
+            for (uint32_t y = 1; y < height; ++y) {
+                sim.SetVoxel(x, y, z, Utils::PackVoxel(Utils::Material::Sand, static_cast<uint8_t>(x ^ z), 0, 0));
+            }
+        }
+    }
+    for (uint32_t tick = 0; tick < SETTLE_TICKS; ++tick) {
+        sim.Step(tick);
+    }
+    std::vector<CPUDirtyRegion> dirty;
+    sim.CollectDirtyRegions(dirty);     // Everything so far goes into the full save
+
+    const uint32_t chunksPerAxis = (options.gridSize + CHUNK_SIZE - 1) / CHUNK_SIZE;
+    std::vector<ChunkCoord> coords;
+    for (uint32_t z = 0; z < chunksPerAxis; ++z) {
+        for (uint32_t y = 0; y < chunksPerAxis; ++y) {
+            for (uint32_t x = 0; x < chunksPerAxis; ++x) {
+                coords.push_back(ChunkCoord{ static_cast<int32_t>(x), static_cast<int32_t>(y), static_cast<int32_t>(z) });
+            }
+        }
+    }
+    fmt::print("Journal benchmark: {}^3 grid ({} chunks of {}³), {} ticks after {} settling ticks\n",
+        options.gridSize, coords.size(), CHUNK_SIZE, options.ticks, SETTLE_TICKS);
+
+    std::error_code error;
+    const uint64_t stamp = static_cast<uint64_t>(Clock::now().time_since_epoch().count());
+    const std::filesystem::path directory = std::filesystem::temp_directory_path(error) / fmt::format("venpod_bench_journal_{}", stamp);
+    const std::filesystem::path crashDirectory = directory.string() + "_crash";
+
+    // ===== Full save: every chunk straight into the region files =====
+    RegionStore store;
+    auto result = store.Open(directory);
+    if (!result) {
+        fmt::print("cannot open region store: {}\n", result.error());
+        return 1;
+    }
+    store.SetCodec(ChunkBlobCodec::PalettedLZ);
+    std::vector<uint32_t> scratch;
+    PalettedVoxels encoded;
+    auto start = Clock::now();
+    for (const ChunkCoord& coord : coords) {
+        EncodeSimChunk(sim, coord, scratch, encoded);
+        result = store.SaveChunk(coord, encoded);
+        if (!result) {
+            fmt::print("save failed: {}\n", result.error());
+            return 1;
+        }
+    }
+    result = store.Flush();
+    const double fullSaveMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+    // ===== Edit, tick, autosave the dirty chunks, compact a few per tick =====
+    std::vector<double> autosaveMs;
+    size_t journaledChunks = 0;
+    size_t maxChunks = 0;
+    uint64_t peakJournalBytes = 0;
+    std::vector<double> compactionMs;
+    ChunkCoordMap<uint8_t> seen;
+    for (uint32_t tick = 0; tick < options.ticks && result; ++tick) {
+        if (tick % BRUSH_TICKS == 0) {
+            // A 4³ sand cube just above the dunes, wandering across the world
+            const uint32_t cx = 4 + (tick * 7) % (size - 8);
+            const uint32_t cz = 4 + (tick * 13) % (size - 8);
+            const uint32_t cy = size / 4;
+            for (uint32_t z = cz - 2; z < cz + 2; ++z) {
+                for (uint32_t y = cy - 2; y < cy + 2; ++y) {
+                    for (uint32_t x = cx - 2; x < cx + 2; ++x) {
+                        sim.SetVoxel(x, y, z, Utils::PackVoxel(Utils::Material::Sand, static_cast<uint8_t>(x ^ z), 0, 0));
+                    }
+                }
+            }
+        }
+        sim.Step(SETTLE_TICKS + tick);
+
+        if ((tick + 1) % AUTOSAVE_TICKS == 0 || tick + 1 == options.ticks) {
+            start = Clock::now();
+            dirty.clear();
+            sim.CollectDirtyRegions(dirty);
+            for (const CPUDirtyRegion& region : dirty) {
+                const ChunkCoord coord{ static_cast<int32_t>(region.minX / CHUNK_SIZE),
+                    static_cast<int32_t>(region.minY / CHUNK_SIZE), static_cast<int32_t>(region.minZ / CHUNK_SIZE) };
+                EncodeSimChunk(sim, coord, scratch, encoded);
+                result = store.JournalChunk(coord, encoded);
+                if (!result) {
+                    break;
+                }
+                seen.Insert(coord, 1);
+            }
+            if (result) {
+                result = store.CommitJournal();
+            }
+            autosaveMs.push_back(std::chrono::duration<double, std::milli>(Clock::now() - start).count());
+            journaledChunks += dirty.size();
+            maxChunks = std::max(maxChunks, dirty.size());
+            peakJournalBytes = std::max(peakJournalBytes, store.GetJournalBytes());
+        } else if (store.GetJournalPendingCount() > 0) {
+            start = Clock::now();
+            auto compacted = store.CompactJournal(COMPACTION_BUDGET);
+            compactionMs.push_back(std::chrono::duration<double, std::milli>(Clock::now() - start).count());
+            if (!compacted) {
+                result = Error("{}", compacted.error());
+            }
+        }
+    }
+    if (!result) {
+        fmt::print("autosave failed: {}\n", result.error());
+        return 1;
+    }
+
+    // ===== Crash: the directory as it is, journal and all =====
+    const size_t pendingAtCrash = store.GetJournalPendingCount();
+    const uint64_t journalAtCrash = store.GetJournalBytes();
+    std::filesystem::copy(directory, crashDirectory, std::filesystem::copy_options::recursive, error);
+    const RegionStoreStats stats = store.GetStats();
+    store.Close();
+
+    RegionStore recovered;
+    bool exact = !error && static_cast<bool>(recovered.Open(crashDirectory));
+    const uint64_t replayed = recovered.GetStats().replayed;
+    exact = exact && VerifySimChunks(recovered, sim, coords);
+    recovered.Close();
+    bool closedExact = static_cast<bool>(recovered.Open(directory)) && recovered.GetStats().replayed == 0;
+    closedExact = closedExact && VerifySimChunks(recovered, sim, coords);
+    recovered.Close();
+    std::filesystem::remove_all(directory, error);
+    std::filesystem::remove_all(crashDirectory, error);
+
+    std::vector<double> sorted = autosaveMs;
+    std::sort(sorted.begin(), sorted.end());
+    double totalMs = 0.0;
+    for (double ms : autosaveMs) {
+        totalMs += ms;
+    }
+    const double meanMs = autosaveMs.empty() ? 0.0 : totalMs / autosaveMs.size();
+    fmt::print("full save: {} chunks in {:.2f} ms\n", coords.size(), fullSaveMs);
+    fmt::print("autosave: {} checkpoints, {:.1f} chunks each (max {}), {:.2f} ms mean, {:.2f} ms max ({:.0f}x cheaper than a full save)\n",
+        autosaveMs.size(), autosaveMs.empty() ? 0.0 : static_cast<double>(journaledChunks) / autosaveMs.size(), maxChunks,
+        meanMs, sorted.empty() ? 0.0 : sorted.back(), meanMs > 0.0 ? fullSaveMs / meanMs : 0.0);
+    fmt::print("journal: {} records, {:.1f} KB appended, peak {:.1f} KB, {} distinct chunks edited\n",
+        stats.journaled, stats.journalBytes / 1024.0, peakJournalBytes / 1024.0, seen.Size());
+    double compactionTotalMs = 0.0;
+    for (double ms : compactionMs) {
+        compactionTotalMs += ms;
+    }
+    fmt::print("compaction: {} chunks moved ({} per tick budget), {:.3f} ms mean per tick, {:.3f} ms max\n",
+        stats.compacted, COMPACTION_BUDGET, compactionMs.empty() ? 0.0 : compactionTotalMs / compactionMs.size(),
+        compactionMs.empty() ? 0.0 : *std::max_element(compactionMs.begin(), compactionMs.end()));
+    fmt::print("crash with {} chunks pending ({:.1f} KB of journal): {} records replayed, {}\n",
+        pendingAtCrash, journalAtCrash / 1024.0, replayed, exact ? "exact" : "MISMATCH");
+    fmt::print("clean close: journal compacted, {}\n", closedExact ? "exact" : "MISMATCH");
+
+    // ===== An edit survives unload and reload =====
+    constexpr uint32_t EDIT_SEED = 12345;
+    const ChunkCoord editCoord = coords.back();
+    const std::filesystem::path editDirectory = directory.string() + "_edit";
+    int32_t originX, originY, originZ;
+    editCoord.GetWorldOrigin(originX, originY, originZ, CHUNK_SIZE);
+
+    // Loaded as generated: nothing to save
+    PalettedVoxels generated;
+    generated.SetVariantOrigin(originX, originY, originZ, EDIT_SEED);
+    EncodeSimChunk(sim, editCoord, scratch, generated);
+    SharedVoxels chunk;
+    chunk.Reset(std::move(generated));
+    bool editKept = !chunk.IsModified();
+
+    // The readback of a brush stroke: a stone bar through the chunk
+    std::vector<uint32_t> edited = scratch;
+    for (uint32_t x = 0; x < CHUNK_SIZE; ++x) {
+        edited[Utils::LinearIndex3D(x, CHUNK_SIZE / 2, CHUNK_SIZE / 2, CHUNK_SIZE, CHUNK_SIZE)] =
+            Utils::PackVoxel(Utils::Material::Stone, 0, 0, Utils::StateFlags::IsStatic);
+    }
+    chunk.Edit().Encode(edited.data());
+    editKept = editKept && chunk.IsModified();
+
+    // Unload: journaled, then the voxels go away with the chunk
+    RegionStore editStore;
+    result = editStore.Open(editDirectory);
+    if (result) {
+        result = chunk.JournalIfModified(editStore, editCoord);
+    }
+    editKept = editKept && result && !chunk.IsModified();
+    chunk.Reset();
+    editStore.Close();
+
+    // Reload from the reopened store
+    PalettedVoxels reloaded;
+    std::vector<uint32_t> decoded(edited.size());
+    editKept = editKept && editStore.Open(editDirectory);
+    auto found = editStore.LoadChunk(editCoord, CHUNK_SIZE, EDIT_SEED, reloaded);
+    editKept = editKept && found && found.Value();
+    if (editKept) {
+        reloaded.Decode(decoded.data());
+        editKept = decoded == edited && decoded != scratch;
+    }
+    editStore.Close();
+    std::filesystem::remove_all(editDirectory, error);
+    fmt::print("edited chunk unloaded and reloaded: {}\n", editKept ? "edit kept" : "EDIT LOST");
+    return exact && closedExact && editKept ? 0 : 1;
+}
+
+} // namespace VENPOD::Bench
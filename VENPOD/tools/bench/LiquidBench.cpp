@@ -0,0 +1,108 @@
+// =============================================================================
+// VENPOD Bench - liquid
+//
+// liquid: floods an N x N/2 x N world (default 256x128x256) to sea level with
+// raised water blocks that keep slumping, and runs it with and without the
+// liquid surface cache. Both runs must end in the same world.
+// =============================================================================
+
+#include "BenchCommon.h"
+#include "Utils/BitPacking.h"
+#include <algorithm>
+#include <cmath>
+
+namespace VENPOD::Bench {
+
+using namespace Simulation;
+
+namespace {
+
+// Terrain floor, water up to sea level and raised water blocks on a
+// checkerboard that spread out over the surface for many ticks
+void SeedFloodedWorld(CPUSimulation& sim) {
+    uint32_t sx = sim.GetGridSizeX();
+    uint32_t sy = sim.GetGridSizeY();
+    uint32_t sz = sim.GetGridSizeZ();
+    uint32_t seaLevel = sy * 80 / 128;   // SEA_LEVEL 80 at the default height
+
+    for (uint32_t z = 0; z < sz; ++z) {
+        for (uint32_t x = 0; x < sx; ++x) {
+            double hills = std::sin(x * 0.05) + std::cos(z * 0.07) + 2.0;
+            uint32_t floorHeight = 4 + static_cast<uint32_t>(hills * 3.0);
+            bool raised = ((x / 16 + z / 16) % 3) == 0;
+            uint32_t waterTop = std::min(sy - 1, seaLevel + (raised ? 8u : 0u));
+
+            for (uint32_t y = 0; y < waterTop; ++y) {
+                uint8_t material = y < floorHeight ? Utils::Material::Stone : Utils::Material::Water;
+                uint8_t state = y < floorHeight ? Utils::StateFlags::IsStatic : 0;
+                sim.SetVoxel(x, y, z, Utils::PackVoxel(material, static_cast<uint8_t>(x ^ z), 0, state));
+            }
+        }
+    }
+}
+
+} // namespace
+
+int RunLiquid(const BenchOptions& options) {
+    uint32_t sizeXZ = options.gridSize;
+    uint32_t sizeY = std::max(options.gridSize / 2, CHUNK_SIZE);
+
+    fmt::print("Liquid surface benchmark: {}x{}x{} flooded grid, {} ticks, {} kernel\n",
+        sizeXZ, sizeY, sizeXZ, options.ticks,
+        options.kernelMode == CPUKernelMode::Bitboard ? "bitboard" : "scalar");
+    fmt::print("{:>8} {:>12} {:>14} {:>16} {:>10}\n", "cache", "ms/tick", "Mvoxels/s", "columns/tick", "mass");
+
+    uint64_t hashes[2] = {};
+    double msPerTick[2] = {};
+    bool allConserved = true;
+
+    for (uint32_t run = 0; run < 2; ++run) {
+        CPUSimulationConfig config;
+        config.gridSizeX = sizeXZ;
+        config.gridSizeY = sizeY;
+        config.gridSizeZ = sizeXZ;
+        config.workerCount = options.threads;
+        config.kernelMode = options.kernelMode;
+        config.liquidSurfaceCache = run == 1;
+        config.validateMass = true;
+
+        CPUSimulation sim;
+        auto result = sim.Initialize(config);
+        if (!result) {
+            spdlog::error("Failed to initialize simulation: {}", result.error());
+            return 1;
+        }
+        SeedFloodedWorld(sim);
+
+        double totalMs = 0.0;
+        uint64_t totalVoxels = 0;
+        uint64_t totalColumns = 0;
+        for (uint32_t tick = 0; tick < options.ticks; ++tick) {
+            sim.Step(tick);
+            totalMs += sim.GetStats().lastTickMs;
+            totalVoxels += sim.GetStats().voxelsProcessed;
+            totalColumns += sim.GetStats().liquidColumnsRebuilt;
+        }
+
+        bool conserved = sim.GetStats().massViolationTicks == 0;
+        allConserved = allConserved && conserved;
+        hashes[run] = HashWorld(sim.GetReadBuffer());
+        msPerTick[run] = totalMs / options.ticks;
+
+        fmt::print("{:>8} {:>12.3f} {:>14.2f} {:>16.1f} {:>10}\n",
+            config.liquidSurfaceCache ? "on" : "off", msPerTick[run],
+            totalMs > 0.0 ? totalVoxels / (totalMs * 1000.0) : 0.0,
+            static_cast<double>(totalColumns) / options.ticks,
+            conserved ? "ok" : fmt::format("{} bad", sim.GetStats().massViolationTicks));
+
+        sim.Shutdown();
+    }
+
+    bool identical = hashes[0] == hashes[1];
+    fmt::print("speedup {:.2f}x, final worlds {}\n",
+        msPerTick[1] > 0.0 ? msPerTick[0] / msPerTick[1] : 0.0, identical ? "identical" : "DIFFER");
+
+    return (identical && allConserved) ? 0 : 2;
+}
+
+} // namespace VENPOD::Bench
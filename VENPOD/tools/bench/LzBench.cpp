@@ -0,0 +1,143 @@
+// =============================================================================
+// VENPOD Bench - lz
+//
+// lz: compresses 32 generated terrain chunks with the LZ block codec, --ticks
+// rounds each, as raw voxel bytes, as shuffled byte planes, as their Morton RLE
+// stream (plain and shuffled) and as their PalettedVoxels image. Reports the
+// ratio against the payload and against raw voxels, compress MB/s and
+// decompress GB/s (of payload bytes), then the ratio of each byte plane alone.
+// =============================================================================
+
+#include "BenchCommon.h"
+#include "Simulation/PalettedVoxels.h"
+#include "Simulation/TerrainGenerator.h"
+#include "Simulation/MortonRLE.h"
+#include "Utils/BlockCompression.h"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+namespace VENPOD::Bench {
+
+using namespace Simulation;
+
+int RunLz(const BenchOptions& options) {
+    using Clock = std::chrono::steady_clock;
+    const uint32_t chunkSize = 64;
+    const uint32_t seed = 12345;
+    const size_t voxelCount = static_cast<size_t>(chunkSize) * chunkSize * chunkSize;
+    const uint32_t rounds = std::max(options.ticks, 1u);
+    const std::vector<ChunkCoord> coords = MakeTerrainBenchChunks(32);
+
+    // ===== Payloads of every chunk =====
+    std::vector<std::vector<uint32_t>> voxels(coords.size(), std::vector<uint32_t>(voxelCount));
+    std::vector<std::vector<uint8_t>> rleStreams(coords.size());
+    std::vector<std::vector<uint8_t>> images(coords.size());
+    for (size_t i = 0; i < coords.size(); ++i) {
+        MortonRLEVariants variants;
+        coords[i].GetWorldOrigin(variants.originX, variants.originY, variants.originZ, chunkSize);
+        variants.seed = seed;
+        GenerateChunkVoxels(variants.originX, variants.originY, variants.originZ, chunkSize, seed, voxels[i].data());
+        EncodeMortonRLE(voxels[i].data(), chunkSize, chunkSize, chunkSize, rleStreams[i], &variants);
+
+        PalettedVoxels palette;
+        palette.SetVariantOrigin(variants.originX, variants.originY, variants.originZ, seed);
+        palette.Initialize(chunkSize);
+        palette.Encode(voxels[i].data());
+        palette.Serialize(images[i]);
+    }
+
+    fmt::print("{} chunks of {}³, seed {}, {} rounds\n", coords.size(), chunkSize, seed, rounds);
+    fmt::print("{:>18} {:>10} {:>9} {:>9} {:>12} {:>12} {:>7}\n", "payload", "MB", "ratio", "vs raw",
+        "comp MB/s", "decomp GB/s", "exact");
+
+    Utils::LZCompressor compressor;
+    std::vector<uint8_t> compressed;
+    std::vector<uint8_t> decompressed;
+    std::vector<uint8_t> planes;
+    const double rawBytes = static_cast<double>(voxelCount * sizeof(uint32_t) * coords.size());
+    bool allExact = true;
+
+    // Each payload as a byte block, optionally shuffled as 32-bit words
+    auto benchmark = [&](const char* label, const std::vector<const uint8_t*>& data,
+                         const std::vector<size_t>& sizes, bool shuffle) {
+        size_t payloadBytes = 0;
+        size_t compressedBytes = 0;
+        double compressSeconds = 0.0;
+        double decompressSeconds = 0.0;
+        bool exact = true;
+        for (size_t i = 0; i < data.size(); ++i) {
+            const size_t words = sizes[i] / sizeof(uint32_t);
+            std::vector<uint32_t> wordCopy;
+            if (shuffle) {
+                wordCopy.resize(words);
+                std::memcpy(wordCopy.data(), data[i], words * sizeof(uint32_t));
+            }
+            payloadBytes += sizes[i];
+            for (uint32_t round = 0; round < rounds; ++round) {
+                auto start = Clock::now();
+                if (shuffle) {
+                    compressed.clear();
+                    compressor.CompressVoxels(wordCopy.data(), words, compressed);
+                } else {
+                    compressed.resize(Utils::LZCompressBound(sizes[i]));
+                    compressed.resize(compressor.Compress(data[i], sizes[i], compressed.data()));
+                }
+                auto middle = Clock::now();
+                decompressed.resize(sizes[i]);
+                const bool decoded = shuffle
+                    ? Utils::DecompressVoxels(compressed.data(), compressed.size(),
+                          reinterpret_cast<uint32_t*>(decompressed.data()), words, planes)
+                    : Utils::LZDecompress(compressed.data(), compressed.size(), decompressed.data(), sizes[i]);
+                auto end = Clock::now();
+                compressSeconds += std::chrono::duration<double>(middle - start).count();
+                decompressSeconds += std::chrono::duration<double>(end - middle).count();
+                exact = exact && decoded && std::memcmp(decompressed.data(), data[i], sizes[i]) == 0;
+            }
+            compressedBytes += compressed.size();
+        }
+        const double totalBytes = static_cast<double>(payloadBytes) * rounds;
+        fmt::print("{:>18} {:>10.2f} {:>8.1f}x {:>8.1f}x {:>12.0f} {:>12.2f} {:>7}\n", label, payloadBytes / 1.0e6,
+            static_cast<double>(payloadBytes) / compressedBytes, rawBytes / compressedBytes,
+            totalBytes / compressSeconds / 1.0e6, totalBytes / decompressSeconds / 1.0e9, exact ? "yes" : "NO");
+        allExact = allExact && exact;
+    };
+
+    std::vector<const uint8_t*> rawData, rleData, imageData;
+    std::vector<size_t> rawSizes, rleSizes, imageSizes;
+    for (size_t i = 0; i < coords.size(); ++i) {
+        rawData.push_back(reinterpret_cast<const uint8_t*>(voxels[i].data()));
+        rawSizes.push_back(voxelCount * sizeof(uint32_t));
+        rleData.push_back(rleStreams[i].data());
+        rleSizes.push_back(rleStreams[i].size());
+        imageData.push_back(images[i].data());
+        imageSizes.push_back(images[i].size());
+    }
+    benchmark("raw", rawData, rawSizes, false);
+    benchmark("raw shuffled", rawData, rawSizes, true);
+    benchmark("rle", rleData, rleSizes, false);
+    benchmark("rle shuffled", rleData, rleSizes, true);
+    benchmark("paletted", imageData, imageSizes, false);
+
+    // ===== Each byte plane of the raw voxels on its own =====
+    const char* planeNames[] = { "material", "variant", "velocity", "state" };
+    size_t planeCompressed[4] = {};
+    std::vector<uint8_t> shuffled(voxelCount * sizeof(uint32_t));
+    compressed.resize(Utils::LZCompressBound(voxelCount));
+    for (const auto& chunk : voxels) {
+        Utils::ShuffleVoxelBytes(chunk.data(), voxelCount, shuffled.data());
+        for (size_t plane = 0; plane < 4; ++plane) {
+            planeCompressed[plane] += compressor.Compress(shuffled.data() + plane * voxelCount, voxelCount,
+                compressed.data());
+        }
+    }
+    fmt::print("byte planes:");
+    for (size_t plane = 0; plane < 4; ++plane) {
+        fmt::print(" {} {:.1f}x", planeNames[plane],
+            static_cast<double>(voxelCount * coords.size()) / planeCompressed[plane]);
+    }
+    fmt::print("\n");
+    return allExact ? 0 : 1;
+}
+
+} // namespace VENPOD::Bench
@@ -0,0 +1,102 @@
+// =============================================================================
+// VENPOD Bench - noise
+//
+// noise: evaluates SimplexNoise3D, FBM3D at 1, 2, 4 and 8 octaves and
+// RidgedNoise3D over 64K terrain-scale sample points, --ticks rounds per
+// backend (scalar, AVX2), and reports Msamples/s, speedup and the largest
+// difference from the scalar backend (expected 0: same operations, same order).
+// =============================================================================
+
+#include "BenchCommon.h"
+#include "Utils/PCGRandom.h"
+#include "Utils/SimplexNoiseBatch.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+namespace VENPOD::Bench {
+
+using namespace Simulation;
+
+int RunNoise(const BenchOptions& options) {
+    using Clock = std::chrono::steady_clock;
+    const size_t sampleCount = 64 * 1024;
+    const uint32_t rounds = std::max(options.ticks, 1u);
+
+    // Terrain-scale inputs: cave / ore frequencies over a few chunks, with
+    // negative coordinates so floor() rounds both ways
+    std::vector<float> x(sampleCount), y(sampleCount), z(sampleCount);
+    auto unit = [](uint32_t seed) { return static_cast<float>(Utils::PCGHash(seed) >> 8) / 16777216.0f; };
+    for (size_t i = 0; i < sampleCount; ++i) {
+        const uint32_t seed = static_cast<uint32_t>(i) * 3u;
+        x[i] = (unit(seed) - 0.5f) * 20.0f;
+        y[i] = unit(seed + 1) * 8.0f;
+        z[i] = (unit(seed + 2) - 0.5f) * 20.0f;
+    }
+
+    struct NoiseCase {
+        const char* name;
+        int octaves;     // 0 = single SimplexNoise3D
+        bool ridged;
+    };
+    const NoiseCase cases[] = {
+        { "simplex", 0, false }, { "fbm", 1, false }, { "fbm", 2, false }, { "fbm", 4, false },
+        { "fbm", 8, false }, { "ridged", 4, true } };
+
+    auto evaluate = [&](const NoiseCase& noiseCase, float* out) {
+        if (noiseCase.octaves == 0) {
+            Utils::SimplexNoise3DBatch(x.data(), y.data(), z.data(), out, sampleCount);
+        } else if (noiseCase.ridged) {
+            Utils::RidgedNoise3DBatch(x.data(), y.data(), z.data(), out, sampleCount, noiseCase.octaves, 0.5f);
+        } else {
+            Utils::FBM3DBatch(x.data(), y.data(), z.data(), out, sampleCount, noiseCase.octaves, 0.5f, 2.0f);
+        }
+    };
+
+    const Utils::NoiseBackend defaultBackend = Utils::GetNoiseBackend();
+    fmt::print("{} samples x {} rounds, default backend {}\n", sampleCount, rounds,
+        Utils::GetNoiseBackendName(defaultBackend));
+    fmt::print("{:>8} {:>8} {:>8} {:>14} {:>20} {:>9} {:>12}\n", "noise", "octaves", "backend", "Msamples/s",
+        "Msamples*octaves/s", "speedup", "max |diff|");
+
+    std::vector<float> reference(sampleCount), result(sampleCount);
+    for (const NoiseCase& noiseCase : cases) {
+        double scalarRate = 0.0;
+        for (Utils::NoiseBackend backend : { Utils::NoiseBackend::Scalar, Utils::NoiseBackend::AVX2 }) {
+            if (!Utils::IsNoiseBackendSupported(backend)) {
+                continue;
+            }
+            Utils::SetNoiseBackend(backend);
+            float* out = backend == Utils::NoiseBackend::Scalar ? reference.data() : result.data();
+
+            auto start = Clock::now();
+            for (uint32_t round = 0; round < rounds; ++round) {
+                evaluate(noiseCase, out);
+            }
+            double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+            float maxDiff = 0.0f;
+            if (backend != Utils::NoiseBackend::Scalar) {
+                for (size_t i = 0; i < sampleCount; ++i) {
+                    maxDiff = std::max(maxDiff, std::fabs(result[i] - reference[i]));
+                }
+            }
+
+            const double rate = static_cast<double>(sampleCount) * rounds / seconds;
+            if (backend == Utils::NoiseBackend::Scalar) {
+                scalarRate = rate;
+            }
+            const int octaves = std::max(noiseCase.octaves, 1);
+            fmt::print("{:>8} {:>8} {:>8} {:>14.1f} {:>20.1f} {:>8.1f}x {:>12.3g}\n", noiseCase.name, octaves,
+                Utils::GetNoiseBackendName(backend), rate / 1e6, rate * octaves / 1e6, rate / scalarRate, maxDiff);
+        }
+    }
+    Utils::SetNoiseBackend(defaultBackend);
+
+    if (!Utils::IsNoiseBackendSupported(Utils::NoiseBackend::AVX2)) {
+        fmt::print("AVX2 not available on this CPU: scalar backend only\n");
+    }
+    return 0;
+}
+
+} // namespace VENPOD::Bench
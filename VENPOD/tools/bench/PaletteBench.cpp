@@ -0,0 +1,203 @@
+// =============================================================================
+// VENPOD Bench - palette
+//
+// palette: encodes synthetic 64³ chunks laid out like CS_GenerateChunk output
+// (uniform sky, solid stone and open water, surface, underground, a surface
+// chunk where 2% of voxels moved, and random noise) into PalettedVoxels and
+// reports bits per voxel, palette size, resident KB, compression ratio and
+// encode/decode GB/s over --ticks rounds.
+// Every decode is checked against the original voxels, and the uniform
+// chunks must encode to the single-value form that skips the GPU buffer.
+// =============================================================================
+
+#include "BenchCommon.h"
+#include "Simulation/PalettedVoxels.h"
+#include "Simulation/AsyncChunkGenerator.h"
+#include "Utils/BitPacking.h"
+#include "Utils/PCGRandom.h"
+#include <chrono>
+#include <cmath>
+
+namespace VENPOD::Bench {
+
+using namespace Simulation;
+
+namespace {
+
+constexpr uint32_t kPaletteChunkEdge = 64;
+
+constexpr uint32_t kPaletteSeed = 12345;
+
+constexpr int32_t kPaletteSeaLevel = 80;
+
+// Stand-in for CS_GenerateChunk: rolling height field, surface/subsoil/stone
+// layers, bedrock, carved caves and water below sea level, with the shader's
+// Random3D variant on every voxel
+void FillGeneratedChunk(std::vector<uint32_t>& voxels, int32_t ox, int32_t oy, int32_t oz) {
+    namespace Material = Utils::Material;
+    const uint32_t edge = kPaletteChunkEdge;
+    for (uint32_t z = 0; z < edge; ++z) {
+        for (uint32_t y = 0; y < edge; ++y) {
+            for (uint32_t x = 0; x < edge; ++x) {
+                int32_t wx = ox + static_cast<int32_t>(x);
+                int32_t wy = oy + static_cast<int32_t>(y);
+                int32_t wz = oz + static_cast<int32_t>(z);
+                float height = 78.0f + 14.0f * std::sin(wx * 0.05f) * std::cos(wz * 0.04f);
+                float depth = height - static_cast<float>(wy);
+
+                uint8_t material = Material::Air;
+                uint8_t state = 0;
+                if (wy == 0) {
+                    material = Material::Bedrock;
+                    state = Utils::StateFlags::IsStatic;
+                } else if (depth > 0.0f) {
+                    float cave = std::sin(wx * 0.11f) + std::sin(wy * 0.13f) + std::sin(wz * 0.09f);
+                    if (cave < -2.2f) {
+                        material = Material::Air;
+                    } else {
+                        material = depth < 1.5f ? (height < kPaletteSeaLevel - 5 ? Material::Sand : Material::Dirt)
+                                 : depth < 5.0f ? Material::Dirt : Material::Stone;
+                        state = Utils::StateFlags::IsStatic;
+                    }
+                }
+                if (material == Material::Air && wy < kPaletteSeaLevel) {
+                    material = Material::Water;
+                    state = 0;
+                }
+
+                uint8_t variant = static_cast<uint8_t>(Utils::Random3D(
+                    static_cast<uint32_t>(wx), static_cast<uint32_t>(wy), static_cast<uint32_t>(wz), kPaletteSeed) & 0xFF);
+                voxels[x + y * edge + z * edge * edge] = Utils::PackVoxel(material, variant, 0, state);
+            }
+        }
+    }
+}
+
+// One material and state everywhere, with the shader's Random3D variants
+void FillUniformChunk(std::vector<uint32_t>& voxels, uint8_t material, uint8_t state,
+                      int32_t ox, int32_t oy, int32_t oz) {
+    const uint32_t edge = kPaletteChunkEdge;
+    for (uint32_t z = 0; z < edge; ++z) {
+        for (uint32_t y = 0; y < edge; ++y) {
+            for (uint32_t x = 0; x < edge; ++x) {
+                uint8_t variant = static_cast<uint8_t>(Utils::Random3D(static_cast<uint32_t>(ox + static_cast<int32_t>(x)),
+                    static_cast<uint32_t>(oy + static_cast<int32_t>(y)), static_cast<uint32_t>(oz + static_cast<int32_t>(z)),
+                    kPaletteSeed) & 0xFF);
+                voxels[x + y * edge + z * edge * edge] = Utils::PackVoxel(material, variant, 0, state);
+            }
+        }
+    }
+}
+
+} // namespace
+
+int RunPalette(const BenchOptions& options) {
+    using Clock = std::chrono::steady_clock;
+    const uint32_t edge = kPaletteChunkEdge;
+    const uint32_t voxelCount = edge * edge * edge;
+
+    struct Case {
+        const char* name;
+        int32_t originY;
+        uint32_t movedPercent;  // Voxels given a non-procedural variant, as if moved by physics
+        bool noise;             // Fully random voxels (raw fallback)
+        uint8_t fill;           // Whole chunk of this material (Air: terrain stand-in)
+        bool uniform;           // Must encode to a single value without exceptions
+    };
+    namespace Material = Utils::Material;
+    const Case cases[] = {
+        { "sky",         192, 0, false, Material::Air,   true  },
+        { "stone",      -128, 0, false, Material::Stone, true  },
+        { "water",        64, 0, false, Material::Water, true  },
+        { "surface",      64, 0, false, Material::Air,   false },
+        { "underground",   0, 0, false, Material::Air,   false },
+        { "settled",      64, 2, false, Material::Air,   false },
+        { "noise",        64, 0, true,  Material::Air,   false },
+    };
+
+    std::vector<uint32_t> voxels(voxelCount);
+    std::vector<uint32_t> decoded(voxelCount);
+    const double mb = voxelCount * sizeof(uint32_t) / (1024.0 * 1024.0);
+
+    fmt::print("{} rounds per case, {}³ chunks ({:.2f} MB uncompressed)\n", options.ticks, edge, mb);
+    fmt::print("{:>12} {:>5} {:>8} {:>10} {:>7} {:>11} {:>11} {:>6}\n",
+        "case", "bits", "palette", "KB", "ratio", "enc GB/s", "dec GB/s", "exact");
+
+    bool allExact = true;
+    double totalBytes = 0.0;
+    double totalResident = 0.0;
+    for (const Case& c : cases) {
+        if (c.fill == Material::Air) {
+            FillGeneratedChunk(voxels, 0, c.originY, 0);
+        } else {
+            FillUniformChunk(voxels, c.fill,
+                c.fill == Material::Stone ? static_cast<uint8_t>(Utils::StateFlags::IsStatic) : uint8_t{ 0 },
+                0, c.originY, 0);
+        }
+        for (uint32_t i = 0; i < voxelCount; ++i) {
+            uint32_t hash = Utils::PCGHash(i ^ 0xA5A5A5A5u);
+            if (c.noise) {
+                voxels[i] = Utils::PCGHash(hash);
+            } else if (hash % 100 < c.movedPercent) {
+                voxels[i] = (voxels[i] & ~0xFF00u) | ((hash >> 8) & 0xFF00u);
+            }
+        }
+
+        PalettedVoxels palette;
+        palette.SetVariantOrigin(0, c.originY, 0, kPaletteSeed);
+        palette.Initialize(edge);
+
+        double encodeSeconds = 0.0;
+        double decodeSeconds = 0.0;
+        bool exact = true;
+        for (uint32_t round = 0; round < options.ticks; ++round) {
+            auto start = Clock::now();
+            palette.Encode(voxels.data());
+            auto encoded = Clock::now();
+            palette.Decode(decoded.data());
+            auto end = Clock::now();
+            encodeSeconds += std::chrono::duration<double>(encoded - start).count();
+            decodeSeconds += std::chrono::duration<double>(end - encoded).count();
+            exact = exact && decoded == voxels;
+        }
+
+        uint32_t bits = palette.GetBitsPerIndex();
+        uint32_t paletteSize = palette.GetPaletteSize();
+        double resident = static_cast<double>(palette.GetResidentBytes());
+        // Same test as InfiniteChunkManager::AdoptGeneratedChunk
+        if (c.uniform) {
+            exact = exact && palette.IsUniform() && palette.GetVariantExceptionCount() == 0;
+        }
+
+        // Single-voxel access has to agree with the bulk decode, before and after edits
+        for (uint32_t i = 0; i < voxelCount; i += 97) {
+            exact = exact && palette.Get(i) == voxels[i];
+        }
+        for (uint32_t i = 0; i < 4096; ++i) {
+            uint32_t hash = Utils::PCGHash(i * 7919u + 17u);
+            uint32_t index = hash % voxelCount;
+            voxels[index] = voxels[(hash >> 3) % voxelCount];
+            palette.Set(index, voxels[index]);
+        }
+        palette.Compact();
+        palette.Decode(decoded.data());
+        exact = exact && decoded == voxels;
+
+        double gb = options.ticks * static_cast<double>(palette.GetUncompressedBytes()) / 1e9;
+        fmt::print("{:>12} {:>5} {:>8} {:>10.1f} {:>6.1f}x {:>11.2f} {:>11.2f} {:>6}\n",
+            c.name, bits, paletteSize, resident / 1024.0,
+            palette.GetUncompressedBytes() / resident, gb / encodeSeconds, gb / decodeSeconds,
+            exact ? "yes" : "NO");
+
+        allExact = allExact && exact;
+        if (!c.noise) {
+            totalBytes += static_cast<double>(palette.GetUncompressedBytes());
+            totalResident += resident;
+        }
+    }
+
+    fmt::print("Terrain chunks overall: {:.1f}x smaller\n", totalBytes / totalResident);
+    return allExact ? 0 : 2;
+}
+
+} // namespace VENPOD::Bench
@@ -0,0 +1,139 @@
+// =============================================================================
+// VENPOD Bench - region
+//
+// region: saves the terrain bench's --ticks generated chunks to region files
+// in a temporary directory, reopens them and loads every chunk back through
+// the memory map, then rewrites a quarter of them with a few edits. Reports
+// bytes per chunk, file size, save MB/s and load chunks/s (lookup, checksum,
+// deserialize and decode) against regenerating the same chunks, and checks
+// that every loaded chunk decodes to the generated voxels. Runs once per
+// chunk blob codec (paletted image as is, and LZ-compressed).
+// =============================================================================
+
+#include "BenchCommon.h"
+#include "Simulation/PalettedVoxels.h"
+#include "Simulation/TerrainGenerator.h"
+#include "Simulation/RegionStore.h"
+#include "Utils/BitPacking.h"
+#include <chrono>
+#include <filesystem>
+#include <utility>
+
+namespace VENPOD::Bench {
+
+using namespace Simulation;
+
+int RunRegion(const BenchOptions& options) {
+    using Clock = std::chrono::steady_clock;
+    const uint32_t chunkSize = 64;
+    const uint32_t seed = 12345;
+    const size_t voxelCount = static_cast<size_t>(chunkSize) * chunkSize * chunkSize;
+    const std::vector<ChunkCoord> coords = MakeTerrainBenchChunks(options.ticks);
+
+    // ===== Generate (also the regeneration baseline) =====
+    std::vector<std::vector<uint32_t>> reference(coords.size(), std::vector<uint32_t>(voxelCount));
+    std::vector<PalettedVoxels> encoded(coords.size());
+    auto start = Clock::now();
+    for (size_t i = 0; i < coords.size(); ++i) {
+        int32_t ox, oy, oz;
+        coords[i].GetWorldOrigin(ox, oy, oz, chunkSize);
+        GenerateChunkVoxels(ox, oy, oz, chunkSize, seed, reference[i].data());
+        encoded[i].SetVariantOrigin(ox, oy, oz, seed);
+        encoded[i].Initialize(chunkSize);
+        encoded[i].Encode(reference[i].data());
+    }
+    const double generateRate = coords.size() / std::chrono::duration<double>(Clock::now() - start).count();
+
+    // Each codec saves, reloads and rewrites the same chunks; the rewrite's
+    // edits carry over, so the reference is updated with them
+    bool exact = true;
+    const std::pair<ChunkBlobCodec, const char*> codecs[] = {
+        { ChunkBlobCodec::Paletted, "paletted" }, { ChunkBlobCodec::PalettedLZ, "paletted+lz" } };
+    for (const auto& [codec, codecName] : codecs) {
+        std::error_code error;
+        const std::filesystem::path directory = std::filesystem::temp_directory_path(error) /
+            fmt::format("venpod_bench_region_{}", static_cast<uint64_t>(Clock::now().time_since_epoch().count()));
+
+        // ===== Save =====
+        RegionStore store;
+        auto result = store.Open(directory);
+        if (!result) {
+            fmt::print("cannot open region store: {}\n", result.error());
+            return 1;
+        }
+        store.SetCodec(codec);
+        auto start = Clock::now();
+        for (size_t i = 0; i < coords.size(); ++i) {
+            result = store.SaveChunk(coords[i], encoded[i]);
+            if (!result) {
+                fmt::print("save failed: {}\n", result.error());
+                return 1;
+            }
+        }
+        result = store.Flush();
+        const double saveSeconds = std::chrono::duration<double>(Clock::now() - start).count();
+        const uint64_t savedBytes = store.GetStats().bytesWritten;
+        store.Close();
+
+        uint64_t fileBytes = 0;
+        size_t regionFiles = 0;
+        for (const auto& entry : std::filesystem::directory_iterator(directory, error)) {
+            fileBytes += entry.file_size(error);
+            ++regionFiles;
+        }
+
+        // ===== Load from a cold store =====
+        result = store.Open(directory);
+        std::vector<uint32_t> decoded(voxelCount);
+        PalettedVoxels loaded;
+        exact = exact && static_cast<bool>(result);
+        start = Clock::now();
+        for (size_t i = 0; i < coords.size() && exact; ++i) {
+            auto found = store.LoadChunk(coords[i], loaded);
+            exact = found && found.Value();
+            if (exact) {
+                loaded.Decode(decoded.data());
+            }
+            exact = exact && decoded == reference[i];
+        }
+        const double loadRate = coords.size() / std::chrono::duration<double>(Clock::now() - start).count();
+
+        // ===== Rewrite a quarter with edits (new sectors; the old ones free up at the next flush) =====
+        size_t rewritten = 0;
+        for (size_t i = 0; i < coords.size(); i += 4) {
+            for (uint32_t v = 0; v < 64; ++v) {
+                encoded[i].Set(v * 4099 % static_cast<uint32_t>(voxelCount), Utils::PackVoxel(Utils::Material::Sand, 0, 0, 0));
+            }
+            result = store.SaveChunk(coords[i], encoded[i]);
+            exact = exact && static_cast<bool>(result);
+            if (result && store.LoadChunk(coords[i], loaded).Value()) {
+                encoded[i].Decode(reference[i].data());
+                loaded.Decode(decoded.data());
+                exact = exact && decoded == reference[i];
+            }
+            ++rewritten;
+        }
+        store.Close();
+
+        uint64_t rewrittenFileBytes = 0;
+        for (const auto& entry : std::filesystem::directory_iterator(directory, error)) {
+            rewrittenFileBytes += entry.file_size(error);
+        }
+        std::filesystem::remove_all(directory, error);
+
+        const double rawBytes = static_cast<double>(voxelCount) * sizeof(uint32_t);
+        fmt::print("{} codec: {} chunks of {}³ in {} region file(s)\n", codecName, coords.size(), chunkSize, regionFiles);
+        fmt::print("saved {:.2f} MB: {:.0f} bytes/chunk ({:.1f}x smaller than raw), {:.2f} MB on disk\n",
+            savedBytes / 1.0e6, static_cast<double>(savedBytes) / coords.size(),
+            rawBytes * coords.size() / static_cast<double>(savedBytes), fileBytes / 1.0e6);
+        fmt::print("save: {:.1f} MB/s of blobs ({:.0f} chunks/s, incl. flush)\n", savedBytes / 1.0e6 / saveSeconds,
+            coords.size() / saveSeconds);
+        fmt::print("load: {:.0f} chunks/s vs {:.1f} chunks/s regenerating ({:.0f}x)\n", loadRate, generateRate,
+            loadRate / generateRate);
+        fmt::print("rewrote {} edited chunks: {:.2f} MB on disk after\n", rewritten, rewrittenFileBytes / 1.0e6);
+        fmt::print("round trip: {}\n\n", exact ? "exact" : "MISMATCH");
+    }
+    return exact ? 0 : 1;
+}
+
+} // namespace VENPOD::Bench
@@ -0,0 +1,151 @@
+// =============================================================================
+// VENPOD Bench - rle
+//
+// rle: Morton RLE-encodes 32 generated terrain chunks and one 256x192x256
+// terrain grid, --ticks rounds each, with raw voxels and with procedural
+// variants folded out. Reports the compression ratio, runs along the Z-order
+// curve against runs in plain linear order, encode / decode GB/s (of raw voxel
+// bytes) and whether the round trip is exact.
+// =============================================================================
+
+#include "BenchCommon.h"
+#include "Simulation/TerrainGenerator.h"
+#include "Simulation/MortonRLE.h"
+#include "Utils/PCGRandom.h"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <string>
+#include <utility>
+
+namespace VENPOD::Bench {
+
+using namespace Simulation;
+
+namespace {
+
+struct RleBenchGrid {
+    std::string name;
+    uint32_t sizeX, sizeY, sizeZ;
+    MortonRLEVariants variants;     // World origin of voxel (0, 0, 0)
+    std::vector<uint32_t> voxels;
+};
+
+} // namespace
+
+int RunRle(const BenchOptions& options) {
+    using Clock = std::chrono::steady_clock;
+    const uint32_t chunkSize = 64;
+    const uint32_t seed = 12345;
+    const size_t chunkVoxels = static_cast<size_t>(chunkSize) * chunkSize * chunkSize;
+    const uint32_t rounds = std::max(options.ticks, 1u);
+
+    // ===== Test grids: single chunks, and a non-cubic grid of 4x3x4 chunks =====
+    std::vector<RleBenchGrid> grids;
+    for (const ChunkCoord& coord : MakeTerrainBenchChunks(32)) {
+        RleBenchGrid grid{ "chunk", chunkSize, chunkSize, chunkSize, {}, std::vector<uint32_t>(chunkVoxels) };
+        coord.GetWorldOrigin(grid.variants.originX, grid.variants.originY, grid.variants.originZ, chunkSize);
+        grid.variants.seed = seed;
+        GenerateChunkVoxels(grid.variants.originX, grid.variants.originY, grid.variants.originZ, chunkSize, seed,
+            grid.voxels.data());
+        grids.push_back(std::move(grid));
+    }
+    RleBenchGrid world{ "world", 4 * chunkSize, 3 * chunkSize, 4 * chunkSize, { 0, -static_cast<int32_t>(chunkSize), 0, seed }, {} };
+    world.voxels.resize(static_cast<size_t>(world.sizeX) * world.sizeY * world.sizeZ);
+    std::vector<uint32_t> chunk(chunkVoxels);
+    for (int32_t cz = 0; cz < 4; ++cz) {
+        for (int32_t cy = 0; cy < 3; ++cy) {
+            for (int32_t cx = 0; cx < 4; ++cx) {
+                int32_t ox, oy, oz;
+                ChunkCoord{ cx, cy - 1, cz }.GetWorldOrigin(ox, oy, oz, chunkSize);
+                GenerateChunkVoxels(ox, oy, oz, chunkSize, seed, chunk.data());
+                for (uint32_t lz = 0; lz < chunkSize; ++lz) {
+                    for (uint32_t ly = 0; ly < chunkSize; ++ly) {
+                        const size_t gx = static_cast<size_t>(cx) * chunkSize;
+                        const size_t gy = static_cast<size_t>(cy) * chunkSize + ly;
+                        const size_t gz = static_cast<size_t>(cz) * chunkSize + lz;
+                        std::memcpy(&world.voxels[gx + gy * world.sizeX + gz * world.sizeX * world.sizeY],
+                            &chunk[ly * chunkSize + static_cast<size_t>(lz) * chunkSize * chunkSize],
+                            chunkSize * sizeof(uint32_t));
+                    }
+                }
+            }
+        }
+    }
+
+    fmt::print("{} chunks of {}³ and a {}x{}x{} grid, seed {}, {} rounds\n", grids.size(), chunkSize, world.sizeX,
+        world.sizeY, world.sizeZ, seed, rounds);
+    fmt::print("{:>22} {:>9} {:>9} {:>10} {:>12} {:>10} {:>10} {:>7}\n", "grid", "variants", "ratio", "runs",
+        "linear runs", "enc GB/s", "dec GB/s", "exact");
+
+    auto benchmark = [&](const std::vector<const RleBenchGrid*>& set, const std::string& label, bool foldVariants) {
+        size_t rawBytes = 0;
+        size_t encodedBytes = 0;
+        size_t runs = 0;
+        size_t linearRuns = 0;
+        double encodeSeconds = 0.0;
+        double decodeSeconds = 0.0;
+        bool exact = true;
+        std::vector<uint8_t> encoded;
+        std::vector<uint32_t> decoded;
+
+        for (const RleBenchGrid* grid : set) {
+            const MortonRLEVariants* variants = foldVariants ? &grid->variants : nullptr;
+            rawBytes += grid->voxels.size() * sizeof(uint32_t);
+            decoded.assign(grid->voxels.size(), 0);
+            for (uint32_t round = 0; round < rounds; ++round) {
+                encoded.clear();
+                auto start = Clock::now();
+                EncodeMortonRLE(grid->voxels.data(), grid->sizeX, grid->sizeY, grid->sizeZ, encoded, variants);
+                auto middle = Clock::now();
+                exact = DecodeMortonRLE(encoded.data(), encoded.size(), decoded.data(), grid->sizeX, grid->sizeY,
+                    grid->sizeZ) && exact;
+                auto end = Clock::now();
+                encodeSeconds += std::chrono::duration<double>(middle - start).count();
+                decodeSeconds += std::chrono::duration<double>(end - middle).count();
+            }
+            exact = exact && decoded == grid->voxels;
+            encodedBytes += encoded.size();
+            MortonRLEInfo info;
+            ReadMortonRLEInfo(encoded.data(), encoded.size(), info);
+            runs += info.runCount;
+
+            // Same keys in plain x, y, z order, for comparison
+            uint32_t previous = 0;
+            for (size_t i = 0; i < grid->voxels.size(); ++i) {
+                uint32_t key = grid->voxels[i];
+                if (foldVariants) {
+                    const uint32_t x = static_cast<uint32_t>(i % grid->sizeX);
+                    const uint32_t y = static_cast<uint32_t>(i / grid->sizeX % grid->sizeY);
+                    const uint32_t z = static_cast<uint32_t>(i / (static_cast<size_t>(grid->sizeX) * grid->sizeY));
+                    key ^= (Utils::Random3D(static_cast<uint32_t>(grid->variants.originX) + x,
+                        static_cast<uint32_t>(grid->variants.originY) + y,
+                        static_cast<uint32_t>(grid->variants.originZ) + z, grid->variants.seed) & 0xFFu) << 8;
+                }
+                linearRuns += i == 0 || key != previous;
+                previous = key;
+            }
+        }
+
+        const double totalBytes = static_cast<double>(rawBytes) * rounds;
+        fmt::print("{:>22} {:>9} {:>8.1f}x {:>10} {:>12} {:>10.2f} {:>10.2f} {:>7}\n", label,
+            foldVariants ? "folded" : "raw", static_cast<double>(rawBytes) / encodedBytes, runs, linearRuns,
+            totalBytes / encodeSeconds / 1.0e9, totalBytes / decodeSeconds / 1.0e9, exact ? "yes" : "NO");
+        return exact;
+    };
+
+    std::vector<const RleBenchGrid*> chunkSet;
+    for (const RleBenchGrid& grid : grids) {
+        chunkSet.push_back(&grid);
+    }
+    const std::string chunkLabel = fmt::format("{} chunks", grids.size());
+    const std::string worldLabel = fmt::format("{}x{}x{}", world.sizeX, world.sizeY, world.sizeZ);
+    bool exact = true;
+    for (bool foldVariants : { false, true }) {
+        exact = benchmark(chunkSet, chunkLabel, foldVariants) && exact;
+        exact = benchmark({ &world }, worldLabel, foldVariants) && exact;
+    }
+    return exact ? 0 : 1;
+}
+
+} // namespace VENPOD::Bench
@@ -0,0 +1,77 @@
+// =============================================================================
+// VENPOD Bench - scaling
+//
+// scaling: runs the same seeded world with 1, 2, 4, ... up to --max-threads
+// workers and reports tick time, speedup, parallel efficiency and whether
+// mass was conserved on every tick. --bitboard switches sand/water chunks to
+// the bitboard kernel.
+// =============================================================================
+
+#include "BenchCommon.h"
+
+namespace VENPOD::Bench {
+
+using namespace Simulation;
+
+int RunScaling(const BenchOptions& options) {
+    fmt::print("Scaling benchmark: {}^3 grid, {} ticks, {} scheduling, {} kernel\n",
+        options.gridSize, options.ticks,
+        options.scheduleMode == CPUScheduleMode::Checkerboard ? "checkerboard" : "unordered",
+        options.kernelMode == CPUKernelMode::Bitboard ? "bitboard" : "scalar");
+    fmt::print("{:>8} {:>12} {:>14} {:>9} {:>11} {:>10}\n",
+        "threads", "ms/tick", "Mvoxels/s", "speedup", "efficiency", "mass");
+
+    double baselineMs = 0.0;
+    bool allConserved = true;
+
+    for (uint32_t threads = 1; threads <= options.maxThreads; threads *= 2) {
+        CPUSimulationConfig config;
+        config.gridSizeX = options.gridSize;
+        config.gridSizeY = options.gridSize;
+        config.gridSizeZ = options.gridSize;
+        config.workerCount = threads;
+        config.scheduleMode = options.scheduleMode;
+        config.kernelMode = options.kernelMode;
+        config.validateMass = true;
+
+        CPUSimulation sim;
+        auto result = sim.Initialize(config);
+        if (!result) {
+            spdlog::error("Failed to initialize simulation: {}", result.error());
+            return 1;
+        }
+        SeedScalingWorld(sim);
+
+        double totalMs = 0.0;
+        uint64_t totalVoxels = 0;
+        for (uint32_t tick = 0; tick < options.ticks; ++tick) {
+            sim.Step(tick);
+            totalMs += sim.GetStats().lastTickMs;
+            totalVoxels += sim.GetStats().voxelsProcessed;
+        }
+
+        bool conserved = sim.GetStats().massViolationTicks == 0;
+        allConserved = allConserved && conserved;
+
+        double msPerTick = totalMs / options.ticks;
+        if (threads == 1) {
+            baselineMs = msPerTick;
+        }
+        double speedup = msPerTick > 0.0 ? baselineMs / msPerTick : 0.0;
+        double mvoxelsPerSecond = totalMs > 0.0 ? totalVoxels / (totalMs * 1000.0) : 0.0;
+
+        fmt::print("{:>8} {:>12.3f} {:>14.2f} {:>8.2f}x {:>10.1f}% {:>10}\n",
+            threads, msPerTick, mvoxelsPerSecond, speedup, 100.0 * speedup / threads,
+            conserved ? "ok" : fmt::format("{} bad", sim.GetStats().massViolationTicks));
+
+        sim.Shutdown();
+    }
+
+    // Unordered mode is expected to lose mass; only checkerboard gates the exit code
+    if (!allConserved && options.scheduleMode == CPUScheduleMode::Checkerboard) {
+        return 2;
+    }
+    return 0;
+}
+
+} // namespace VENPOD::Bench
@@ -0,0 +1,166 @@
+#include "Scenarios.h"
+#include "Utils/BitPacking.h"
+#include <algorithm>
+#include <cstring>
+
+namespace VENPOD::Bench {
+
+using Simulation::CPUSimulation;
+namespace Material = Utils::Material;
+
+namespace {
+
+constexpr uint8_t kFireLife = 15;
+
+// Deterministic per-voxel variant so scenes look the same on every run
+uint8_t VariantAt(uint32_t x, uint32_t y, uint32_t z) {
+    return static_cast<uint8_t>((x * 73856093u) ^ (y * 19349663u) ^ (z * 83492791u));
+}
+
+// Fill [x0, x1) x [y0, y1) x [z0, z1), clamped to the grid
+void FillBox(CPUSimulation& sim, uint32_t x0, uint32_t y0, uint32_t z0,
+             uint32_t x1, uint32_t y1, uint32_t z1, uint8_t material, uint8_t state = 0) {
+    x1 = std::min(x1, sim.GetGridSizeX());
+    y1 = std::min(y1, sim.GetGridSizeY());
+    z1 = std::min(z1, sim.GetGridSizeZ());
+    for (uint32_t z = z0; z < z1; ++z) {
+        for (uint32_t y = y0; y < y1; ++y) {
+            for (uint32_t x = x0; x < x1; ++x) {
+                sim.SetVoxel(x, y, z, Utils::PackVoxel(material, VariantAt(x, y, z), 0, state));
+            }
+        }
+    }
+}
+
+// Static stone floor at y = 0 and glass walls up to `height` around the grid
+void BuildBasin(CPUSimulation& sim, uint32_t height) {
+    uint32_t sx = sim.GetGridSizeX();
+    uint32_t sz = sim.GetGridSizeZ();
+    FillBox(sim, 0, 0, 0, sx, 1, sz, Material::Stone, Utils::StateFlags::IsStatic);
+    FillBox(sim, 0, 1, 0, sx, height, 1, Material::Glass, Utils::StateFlags::IsStatic);
+    FillBox(sim, 0, 1, sz - 1, sx, height, sz, Material::Glass, Utils::StateFlags::IsStatic);
+    FillBox(sim, 0, 1, 0, 1, height, sz, Material::Glass, Utils::StateFlags::IsStatic);
+    FillBox(sim, sx - 1, 1, 0, sx, height, sz, Material::Glass, Utils::StateFlags::IsStatic);
+}
+
+// A sand cliff over a third of the floor collapses into a slope
+void SeedSandAvalanche(CPUSimulation& sim) {
+    uint32_t sx = sim.GetGridSizeX();
+    uint32_t sy = sim.GetGridSizeY();
+    uint32_t sz = sim.GetGridSizeZ();
+    BuildBasin(sim, sy);
+    FillBox(sim, 1, 1, 1, sx / 3, sy * 3 / 4, sz - 1, Material::Sand);
+}
+
+// A water column in one quarter of the basin is released
+void SeedDamBreak(CPUSimulation& sim) {
+    uint32_t sx = sim.GetGridSizeX();
+    uint32_t sy = sim.GetGridSizeY();
+    uint32_t sz = sim.GetGridSizeZ();
+    BuildBasin(sim, sy);
+    FillBox(sim, 1, 1, 1, sx / 4, sy * 3 / 4, sz - 1, Material::Water);
+}
+
+// Oil layered under water has to rise through it
+void SeedOilOnWater(CPUSimulation& sim) {
+    uint32_t sx = sim.GetGridSizeX();
+    uint32_t sy = sim.GetGridSizeY();
+    uint32_t sz = sim.GetGridSizeZ();
+    BuildBasin(sim, sy);
+    FillBox(sim, 1, 1, 1, sx - 1, sy / 4, sz - 1, Material::Oil);
+    FillBox(sim, 1, sy / 4, 1, sx - 1, sy / 2, sz - 1, Material::Water);
+}
+
+// Lava and water pools side by side, reacting along the contact plane
+void SeedLavaMeetsWater(CPUSimulation& sim) {
+    uint32_t sx = sim.GetGridSizeX();
+    uint32_t sy = sim.GetGridSizeY();
+    uint32_t sz = sim.GetGridSizeZ();
+    BuildBasin(sim, sy);
+    FillBox(sim, 1, 1, 1, sx / 2, sy / 3, sz - 1, Material::Lava);
+    FillBox(sim, sx / 2, 1, 1, sx - 1, sy / 3, sz - 1, Material::Water);
+}
+
+// Wooden trees on a dirt floor, set alight along one edge
+void SeedForestFire(CPUSimulation& sim) {
+    uint32_t sx = sim.GetGridSizeX();
+    uint32_t sy = sim.GetGridSizeY();
+    uint32_t sz = sim.GetGridSizeZ();
+    const uint32_t ground = 4;
+    const uint32_t trunkHeight = std::min(10u, sy / 3);
+    BuildBasin(sim, 2);
+    FillBox(sim, 1, 1, 1, sx - 1, ground, sz - 1, Material::Dirt);
+
+    for (uint32_t tz = 4; tz + 4 < sz; tz += 8) {
+        for (uint32_t tx = 4; tx + 4 < sx; tx += 8) {
+            uint32_t top = ground + trunkHeight;
+            FillBox(sim, tx, ground, tz, tx + 1, top, tz + 1, Material::Wood);
+            FillBox(sim, tx - 2, top, tz - 2, tx + 3, top + 3, tz + 3, Material::Wood);
+        }
+    }
+    FillBox(sim, 1, ground, 1, 3, ground + trunkHeight, sz - 1, Material::Fire, kFireLife);
+}
+
+// A serpentine gunpowder fuse with charges at every turn, lit at one end
+void SeedGunpowderChain(CPUSimulation& sim) {
+    uint32_t sx = sim.GetGridSizeX();
+    uint32_t sz = sim.GetGridSizeZ();
+    BuildBasin(sim, 2);
+
+    uint32_t row = 0;
+    for (uint32_t z = 4; z + 4 < sz; z += 8, ++row) {
+        FillBox(sim, 4, 1, z, sx - 4, 3, z + 2, Material::Gunpowder);
+        // Connect to the next row on alternating sides
+        uint32_t linkX = (row % 2 == 0) ? sx - 6 : 4;
+        FillBox(sim, linkX, 1, z, linkX + 2, 3, std::min(z + 10, sz - 4), Material::Gunpowder);
+        FillBox(sim, linkX - 1, 1, z - 1, linkX + 3, 6, z + 3, Material::Gunpowder);
+    }
+    FillBox(sim, 4, 3, 4, 6, 4, 6, Material::Fire, kFireLife);
+}
+
+// Acid poured into a pit dug through layered stone, dirt and sand
+void SeedAcidPit(CPUSimulation& sim) {
+    uint32_t sx = sim.GetGridSizeX();
+    uint32_t sy = sim.GetGridSizeY();
+    uint32_t sz = sim.GetGridSizeZ();
+    uint32_t groundTop = sy / 2;
+    BuildBasin(sim, sy);
+
+    FillBox(sim, 1, 1, 1, sx - 1, groundTop / 3, sz - 1, Material::Stone, Utils::StateFlags::IsStatic);
+    FillBox(sim, 1, groundTop / 3, 1, sx - 1, groundTop * 2 / 3, sz - 1, Material::Dirt);
+    FillBox(sim, 1, groundTop * 2 / 3, 1, sx - 1, groundTop, sz - 1, Material::Sand);
+
+    // Dig the pit (air), then pour acid above it
+    uint32_t px0 = sx / 3, px1 = sx * 2 / 3;
+    uint32_t pz0 = sz / 3, pz1 = sz * 2 / 3;
+    FillBox(sim, px0, groundTop / 2, pz0, px1, groundTop, pz1, Material::Air);
+    FillBox(sim, px0 + 2, groundTop + 2, pz0 + 2, px1 - 2, groundTop + sy / 6, pz1 - 2, Material::Acid);
+}
+
+const BenchScenario kScenarios[] = {
+    { "sand_avalanche",   "Sand cliff collapsing into a slope",              SeedSandAvalanche },
+    { "dam_break",        "Water column released into an empty basin",       SeedDamBreak },
+    { "oil_on_water",     "Oil layer rising through the water above it",     SeedOilOnWater },
+    { "lava_meets_water", "Lava and water pools reacting at their contact",  SeedLavaMeetsWater },
+    { "forest_fire",      "Fire spreading through a grid of wooden trees",   SeedForestFire },
+    { "gunpowder_chain",  "Serpentine gunpowder fuse with chained charges",  SeedGunpowderChain },
+    { "acid_pit",         "Acid dissolving a layered stone/dirt/sand pit",   SeedAcidPit },
+};
+
+} // namespace
+
+const BenchScenario* GetBenchScenarios(uint32_t& count) {
+    count = static_cast<uint32_t>(std::size(kScenarios));
+    return kScenarios;
+}
+
+const BenchScenario* FindBenchScenario(const char* name) {
+    for (const BenchScenario& scenario : kScenarios) {
+        if (std::strcmp(scenario.name, name) == 0) {
+            return &scenario;
+        }
+    }
+    return nullptr;
+}
+
+} // namespace VENPOD::Bench
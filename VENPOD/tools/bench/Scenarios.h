@@ -0,0 +1,26 @@
+#pragma once
+
+// =============================================================================
+// VENPOD Bench Scenarios - Scripted scenes for reproducible physics benchmarks
+// Every scene is seeded deterministically from the grid size alone, so two
+// builds running the same scenario on the same grid start from identical
+// worlds. Scenes assume a grid of at least 32 voxels per axis.
+// =============================================================================
+
+#include "Simulation/CPUSimulation.h"
+
+namespace VENPOD::Bench {
+
+struct BenchScenario {
+    const char* name;           // Command line / JSON identifier
+    const char* description;
+    void (*seed)(Simulation::CPUSimulation& sim);
+};
+
+// All canonical scenarios, in report order
+const BenchScenario* GetBenchScenarios(uint32_t& count);
+
+// Scenario by name, nullptr when unknown
+const BenchScenario* FindBenchScenario(const char* name);
+
+} // namespace VENPOD::Bench
@@ -0,0 +1,159 @@
+// =============================================================================
+// VENPOD Bench - scenarios
+//
+// scenarios: runs the canonical scenes from Scenarios.cpp (all, or one with
+// --scenario) on an N x N/2 x N grid and writes one JSON report with
+// ticks/s, voxels processed/s, active chunk counts and p50/p99 tick latency
+// per scene, to stdout or --out. --validate adds the per-tick mass check
+// (slower, so off by default for timing runs).
+// =============================================================================
+
+#include "BenchCommon.h"
+#include "Scenarios.h"
+#include <fmt/os.h>
+#include <algorithm>
+#include <cmath>
+#include <string>
+
+namespace VENPOD::Bench {
+
+using namespace Simulation;
+
+namespace {
+
+double Percentile(const std::vector<double>& sorted, double fraction) {
+    if (sorted.empty()) {
+        return 0.0;
+    }
+    size_t rank = static_cast<size_t>(std::ceil(fraction * sorted.size()));
+    return sorted[std::min(std::max(rank, size_t{1}), sorted.size()) - 1];
+}
+
+// One scenario as a JSON object (names are plain identifiers, no escaping needed)
+bool RunScenario(const Bench::BenchScenario& scenario, const BenchOptions& options, std::string& json,
+                 uint64_t& massViolationTicks) {
+    CPUSimulationConfig config;
+    config.gridSizeX = options.gridSize;
+    config.gridSizeY = std::max(options.gridSize / 2, CHUNK_SIZE);
+    config.gridSizeZ = options.gridSize;
+    config.workerCount = options.threads;
+    config.kernelMode = options.kernelMode;
+    config.validateMass = options.validateMass;
+
+    CPUSimulation sim;
+    auto result = sim.Initialize(config);
+    if (!result) {
+        spdlog::error("Failed to initialize simulation: {}", result.error());
+        return false;
+    }
+    scenario.seed(sim);
+
+    std::vector<double> tickMs;
+    tickMs.reserve(options.ticks);
+    uint64_t totalVoxels = 0;
+    uint64_t totalActive = 0;
+    uint32_t maxActive = 0;
+    uint64_t totalDetonations = 0;
+    for (uint32_t tick = 0; tick < options.ticks; ++tick) {
+        sim.Step(tick);
+        const CPUSimulationStats& stats = sim.GetStats();
+        tickMs.push_back(stats.lastTickMs);
+        totalVoxels += stats.voxelsProcessed;
+        totalActive += stats.activeChunks;
+        maxActive = std::max(maxActive, stats.activeChunks);
+        totalDetonations += stats.detonations;
+    }
+
+    double totalMs = 0.0;
+    for (double ms : tickMs) {
+        totalMs += ms;
+    }
+    std::vector<double> sorted = tickMs;
+    std::sort(sorted.begin(), sorted.end());
+    const CPUSimulationStats& stats = sim.GetStats();
+    double seconds = totalMs / 1000.0;
+
+    json += fmt::format(
+        "    {{\n"
+        "      \"name\": \"{}\",\n"
+        "      \"grid\": [{}, {}, {}],\n"
+        "      \"workers\": {},\n"
+        "      \"ticks\": {},\n"
+        "      \"ticks_per_second\": {:.2f},\n"
+        "      \"voxels_processed_per_second\": {:.0f},\n"
+        "      \"active_chunks\": {{ \"mean\": {:.1f}, \"max\": {}, \"final\": {}, \"total\": {} }},\n"
+        "      \"tick_ms\": {{ \"mean\": {:.4f}, \"p50\": {:.4f}, \"p99\": {:.4f}, \"max\": {:.4f} }},\n"
+        "      \"detonations\": {},\n"
+        "      \"final_voxels\": {},\n"
+        "      \"mass_violation_ticks\": {}\n"
+        "    }}",
+        scenario.name, config.gridSizeX, config.gridSizeY, config.gridSizeZ, sim.GetWorkerCount(), options.ticks,
+        seconds > 0.0 ? options.ticks / seconds : 0.0,
+        seconds > 0.0 ? totalVoxels / seconds : 0.0,
+        static_cast<double>(totalActive) / options.ticks, maxActive, stats.activeChunks, sim.GetTotalChunks(),
+        totalMs / options.ticks, Percentile(sorted, 0.50), Percentile(sorted, 0.99), sorted.back(),
+        totalDetonations,
+        options.validateMass ? fmt::format("{}", stats.massAfter) : std::string("null"),
+        options.validateMass ? fmt::format("{}", stats.massViolationTicks) : std::string("null"));
+
+    // Progress goes to stderr so stdout stays valid JSON
+    fmt::print(stderr, "{:<18} {:>9.1f} ticks/s  p50 {:>8.3f} ms  p99 {:>8.3f} ms  {:>6.1f} active chunks\n",
+        scenario.name, seconds > 0.0 ? options.ticks / seconds : 0.0,
+        Percentile(sorted, 0.50), Percentile(sorted, 0.99), static_cast<double>(totalActive) / options.ticks);
+
+    massViolationTicks = stats.massViolationTicks;
+    sim.Shutdown();
+    return true;
+}
+
+} // namespace
+
+int RunScenarios(const BenchOptions& options) {
+    std::vector<const Bench::BenchScenario*> scenarios;
+    if (options.scenario) {
+        const Bench::BenchScenario* scenario = Bench::FindBenchScenario(options.scenario);
+        if (!scenario) {
+            spdlog::error("Unknown scenario '{}'", options.scenario);
+            return 1;
+        }
+        scenarios.push_back(scenario);
+    } else {
+        uint32_t count = 0;
+        const Bench::BenchScenario* all = Bench::GetBenchScenarios(count);
+        for (uint32_t i = 0; i < count; ++i) {
+            scenarios.push_back(&all[i]);
+        }
+    }
+
+    std::string json = "{\n";
+    json += fmt::format("  \"kernel\": \"{}\",\n",
+        options.kernelMode == CPUKernelMode::Bitboard ? "bitboard" : "scalar");
+    json += fmt::format("  \"mass_validated\": {},\n", options.validateMass ? "true" : "false");
+    json += "  \"scenarios\": [\n";
+    uint64_t totalViolations = 0;
+    for (size_t i = 0; i < scenarios.size(); ++i) {
+        uint64_t violations = 0;
+        if (!RunScenario(*scenarios[i], options, json, violations)) {
+            return 1;
+        }
+        json += i + 1 < scenarios.size() ? ",\n" : "\n";
+        totalViolations += violations;
+    }
+    json += "  ]\n}\n";
+
+    if (options.outPath) {
+        try {
+            auto file = fmt::output_file(options.outPath);
+            file.print("{}", json);
+        } catch (const std::exception& e) {
+            spdlog::error("Failed to write {}: {}", options.outPath, e.what());
+            return 1;
+        }
+        fmt::print(stderr, "Wrote {}\n", options.outPath);
+    } else {
+        fmt::print("{}", json);
+    }
+    return totalViolations == 0 ? 0 : 2;
+}
+
+} // namespace VENPOD::Bench
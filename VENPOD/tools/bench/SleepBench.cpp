@@ -0,0 +1,195 @@
+// =============================================================================
+// VENPOD Bench - sleep
+//
+// sleep: lets the scaling world settle with chunk sleep off and on, printing
+// the fraction of non-empty chunks asleep as the piles come to rest, the 4³
+// bricks still simulated and the bytes of the READ -> WRITE copy. Then lava
+// next to wood in every chunk of a flat world, which ignites by chance: the
+// wood left unburnt must be the same with sleep off and on. Last, water
+// dropped high above a resting water film, which the liquid pressure rule
+// lets spill at once: the worlds must stay identical with sleep off and on.
+// =============================================================================
+
+#include "BenchCommon.h"
+#include "Utils/BitPacking.h"
+#include <algorithm>
+
+namespace VENPOD::Bench {
+
+using namespace Simulation;
+
+int RunSleep(const BenchOptions& options) {
+    fmt::print("Chunk sleep benchmark: {}^3 grid, {} ticks, {} kernel\n",
+        options.gridSize, options.ticks,
+        options.kernelMode == CPUKernelMode::Bitboard ? "bitboard" : "scalar");
+
+    const uint32_t checkpoint = std::max(options.ticks / 8, 1u);
+    double msPerTick[2] = {};
+    bool allConserved = true;
+
+    for (uint32_t run = 0; run < 2; ++run) {
+        CPUSimulationConfig config;
+        config.gridSizeX = options.gridSize;
+        config.gridSizeY = options.gridSize;
+        config.gridSizeZ = options.gridSize;
+        config.workerCount = options.threads;
+        config.kernelMode = options.kernelMode;
+        config.chunkSleepTicks = run == 0 ? 0 : CPUSimulationConfig{}.chunkSleepTicks;
+        config.validateMass = true;
+
+        CPUSimulation sim;
+        auto result = sim.Initialize(config);
+        if (!result) {
+            spdlog::error("Failed to initialize simulation: {}", result.error());
+            return 1;
+        }
+        SeedScalingWorld(sim);
+
+        fmt::print("\nsleep {}\n", run == 0 ? "off" : fmt::format("after {} quiet ticks", config.chunkSleepTicks));
+        fmt::print("{:>8} {:>12} {:>10} {:>10} {:>10} {:>10} {:>12}\n",
+            "tick", "ms/tick", "active", "sleeping", "ratio", "bricks", "copy KB");
+
+        double totalMs = 0.0;
+        double windowMs = 0.0;
+        uint64_t windowCopied = 0;
+        for (uint32_t tick = 0; tick < options.ticks; ++tick) {
+            sim.Step(tick);
+            const CPUSimulationStats& stats = sim.GetStats();
+            totalMs += stats.lastTickMs;
+            windowMs += stats.lastTickMs;
+            windowCopied += stats.voxelsCopied;
+
+            if ((tick + 1) % checkpoint == 0 || tick + 1 == options.ticks) {
+                uint32_t windowTicks = (tick % checkpoint) + 1;
+                fmt::print("{:>8} {:>12.3f} {:>10} {:>10} {:>9.1f}% {:>10} {:>12.1f}\n",
+                    tick + 1, windowMs / windowTicks, stats.activeChunks, stats.sleepingChunks,
+                    100.0 * stats.sleepingChunkRatio, stats.simulatedBricks,
+                    windowCopied * sizeof(uint32_t) / 1024.0 / windowTicks);
+                windowMs = 0.0;
+                windowCopied = 0;
+            }
+        }
+
+        bool conserved = sim.GetStats().massViolationTicks == 0;
+        allConserved = allConserved && conserved;
+        msPerTick[run] = totalMs / options.ticks;
+        fmt::print("average {:.3f} ms/tick, mass {}\n", msPerTick[run],
+            conserved ? "ok" : fmt::format("{} bad", sim.GetStats().massViolationTicks));
+
+        sim.Shutdown();
+    }
+
+    fmt::print("\nspeedup {:.2f}x\n", msPerTick[1] > 0.0 ? msPerTick[0] / msPerTick[1] : 0.0);
+
+    // ===== Random reactions: a chunk must not sleep before they happen =====
+    constexpr uint32_t REACTION_GRID = 512;
+    constexpr uint32_t REACTION_TICKS[] = { 10, 35 };
+    uint32_t unburnt[2][2] = {};
+    for (uint32_t run = 0; run < 2; ++run) {
+        CPUSimulationConfig config;
+        config.gridSizeX = REACTION_GRID;
+        config.gridSizeY = CHUNK_SIZE;
+        config.gridSizeZ = REACTION_GRID;
+        config.workerCount = options.threads;
+        config.kernelMode = options.kernelMode;
+        config.chunkSleepTicks = run == 0 ? 0 : CPUSimulationConfig{}.chunkSleepTicks;
+        config.validateMass = false;
+
+        CPUSimulation sim;
+        auto result = sim.Initialize(config);
+        if (!result) {
+            spdlog::error("Failed to initialize simulation: {}", result.error());
+            return 1;
+        }
+        for (uint32_t z = 0; z < REACTION_GRID; ++z) {
+            for (uint32_t x = 0; x < REACTION_GRID; ++x) {
+                sim.SetVoxel(x, 0, z, Utils::PackVoxel(Utils::Material::Stone, 0, 0, Utils::StateFlags::IsStatic));
+            }
+        }
+        for (uint32_t z = CHUNK_SIZE / 2; z < REACTION_GRID; z += CHUNK_SIZE) {
+            for (uint32_t x = CHUNK_SIZE / 2; x < REACTION_GRID; x += CHUNK_SIZE) {
+                sim.SetVoxel(x, 1, z, Utils::PackVoxel(Utils::Material::Wood, 0, 0, 0));
+                sim.SetVoxel(x + 1, 1, z, Utils::PackVoxel(Utils::Material::Lava, 0, 0, 0));
+            }
+        }
+
+        uint32_t tick = 0;
+        for (uint32_t stage = 0; stage < 2; ++stage) {
+            for (; tick < REACTION_TICKS[stage]; ++tick) {
+                sim.Step(tick);
+            }
+            for (uint32_t voxel : sim.GetReadBuffer()) {
+                unburnt[run][stage] += Utils::UnpackMaterial(voxel) == Utils::Material::Wood ? 1u : 0u;
+            }
+        }
+        sim.Shutdown();
+    }
+    const bool reactionsMatch = unburnt[0][0] == unburnt[1][0] && unburnt[0][1] == unburnt[1][1];
+    fmt::print("lava beside wood in {} chunks: unburnt wood at tick {} / {}: sleep off {} / {}, on {} / {} ({})\n",
+        (REACTION_GRID / CHUNK_SIZE) * (REACTION_GRID / CHUNK_SIZE), REACTION_TICKS[0], REACTION_TICKS[1],
+        unburnt[0][0], unburnt[0][1], unburnt[1][0], unburnt[1][1], reactionsMatch ? "match" : "MISMATCH");
+
+    // ===== Liquid pressure: water far up a column must wake the film below it =====
+    constexpr uint32_t PRESSURE_GRID = 128;
+    constexpr uint32_t PRESSURE_HEIGHT = 64;
+    constexpr uint32_t PRESSURE_SETTLE_TICKS = 30;
+    constexpr uint32_t PRESSURE_TICKS[] = { 35, 90 };
+    uint64_t pressureHashes[2][2] = {};
+    for (uint32_t run = 0; run < 2; ++run) {
+        CPUSimulationConfig config;
+        config.gridSizeX = PRESSURE_GRID;
+        config.gridSizeY = PRESSURE_HEIGHT;
+        config.gridSizeZ = PRESSURE_GRID;
+        config.workerCount = options.threads;
+        config.kernelMode = options.kernelMode;
+        config.chunkSleepTicks = run == 0 ? 0 : CPUSimulationConfig{}.chunkSleepTicks;
+        config.validateMass = false;
+
+        CPUSimulation sim;
+        auto result = sim.Initialize(config);
+        if (!result) {
+            spdlog::error("Failed to initialize simulation: {}", result.error());
+            return 1;
+        }
+        // A one voxel deep water film on 8x8 checker squares is at rest: no
+        // cell below it is free and its column is no taller than its neighbours'
+        for (uint32_t z = 0; z < PRESSURE_GRID; ++z) {
+            for (uint32_t x = 0; x < PRESSURE_GRID; ++x) {
+                sim.SetVoxel(x, 0, z, Utils::PackVoxel(Utils::Material::Stone, 0, 0, Utils::StateFlags::IsStatic));
+                if ((x / 8 + z / 8) % 2 == 0) {
+                    sim.SetVoxel(x, 1, z, Utils::PackVoxel(Utils::Material::Water, 0, 0, 0));
+                }
+            }
+        }
+
+        uint32_t tick = 0;
+        for (; tick < PRESSURE_SETTLE_TICKS; ++tick) {
+            sim.Step(tick);
+        }
+        // Water near the top of columns on the squares' edges raises the
+        // film's column height at once, long before it lands
+        for (uint32_t z = 3; z < PRESSURE_GRID; z += 16) {
+            for (uint32_t x = 7; x < PRESSURE_GRID; x += 16) {
+                sim.SetVoxel(x, PRESSURE_HEIGHT - 2, z, Utils::PackVoxel(Utils::Material::Water, 0, 0, 0));
+            }
+        }
+        for (uint32_t stage = 0; stage < 2; ++stage) {
+            for (; tick < PRESSURE_TICKS[stage]; ++tick) {
+                sim.Step(tick);
+            }
+            pressureHashes[run][stage] = HashWorld(sim.GetReadBuffer());
+        }
+        sim.Shutdown();
+    }
+    const bool pressureMatches = pressureHashes[0][0] == pressureHashes[1][0] &&
+                                 pressureHashes[0][1] == pressureHashes[1][1];
+    fmt::print("water dropped over a resting film: worlds at tick {} / {} with sleep off and on {}\n",
+        PRESSURE_TICKS[0], PRESSURE_TICKS[1], pressureMatches ? "identical" : "DIFFER");
+
+    if (!allConserved) {
+        return 2;
+    }
+    return (reactionsMatch && pressureMatches) ? 0 : 1;
+}
+
+} // namespace VENPOD::Bench
@@ -0,0 +1,181 @@
+// =============================================================================
+// VENPOD Bench - snapshot
+//
+// snapshot: generates --ticks terrain chunks behind copy-on-write handles and
+// saves them twice: blocking (the frame stall a plain save costs) and as a
+// snapshot written by a background thread while frames keep editing a few
+// chunks each, the way InfiniteChunkManager takes in a GPU readback (the
+// whole chunk re-encoded through Edit()). Reports the pin time, frames run
+// and chunks cloned during the save and the extra memory they took, and
+// checks both versions: the snapshot holds the voxels as they were when it
+// was taken, the live chunks hold every edit and are marked modified.
+// =============================================================================
+
+#include "BenchCommon.h"
+#include "Simulation/PalettedVoxels.h"
+#include "Simulation/TerrainGenerator.h"
+#include "Simulation/RegionStore.h"
+#include "Simulation/ChunkSnapshot.h"
+#include "Utils/BitPacking.h"
+#include "Utils/PCGRandom.h"
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <thread>
+#include <utility>
+
+namespace VENPOD::Bench {
+
+using namespace Simulation;
+
+int RunSnapshot(const BenchOptions& options) {
+    using Clock = std::chrono::steady_clock;
+    constexpr uint32_t EDITS_PER_FRAME = 2;
+    const uint32_t chunkSize = 64;
+    const uint32_t seed = 12345;
+    const size_t voxelCount = static_cast<size_t>(chunkSize) * chunkSize * chunkSize;
+    const std::vector<ChunkCoord> coords = MakeTerrainBenchChunks(options.ticks);
+
+    // ===== The world: generated chunks behind copy-on-write handles =====
+    std::vector<std::vector<uint32_t>> reference(coords.size(), std::vector<uint32_t>(voxelCount));
+    std::vector<SharedVoxels> chunks(coords.size());
+    size_t residentBytes = 0;
+    for (size_t i = 0; i < coords.size(); ++i) {
+        int32_t ox, oy, oz;
+        coords[i].GetWorldOrigin(ox, oy, oz, chunkSize);
+        GenerateChunkVoxels(ox, oy, oz, chunkSize, seed, reference[i].data());
+        PalettedVoxels voxels;
+        voxels.SetVariantOrigin(ox, oy, oz, seed);
+        voxels.Initialize(chunkSize);
+        voxels.Encode(reference[i].data());
+        residentBytes += voxels.GetResidentBytes();
+        chunks[i].Reset(std::move(voxels));
+    }
+    fmt::print("Snapshot benchmark: {} chunks of {}³, {:.2f} MB resident\n", coords.size(), chunkSize, residentBytes / 1.0e6);
+
+    std::error_code error;
+    const uint64_t stamp = static_cast<uint64_t>(Clock::now().time_since_epoch().count());
+    const std::filesystem::path base = std::filesystem::temp_directory_path(error);
+    const std::filesystem::path blockingDirectory = base / fmt::format("venpod_bench_snapshot_{}_blocking", stamp);
+    const std::filesystem::path snapshotDirectory = base / fmt::format("venpod_bench_snapshot_{}", stamp);
+
+    // ===== Blocking save: the frame waits for every chunk =====
+    RegionStore store;
+    auto result = store.Open(blockingDirectory);
+    store.SetCodec(ChunkBlobCodec::PalettedLZ);
+    auto start = Clock::now();
+    for (size_t i = 0; i < coords.size() && result; ++i) {
+        result = store.SaveChunk(coords[i], chunks[i].Get());
+    }
+    if (result) {
+        result = store.Flush();
+    }
+    const double blockingMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    store.Close();
+    std::filesystem::remove_all(blockingDirectory, error);
+    if (!result) {
+        fmt::print("blocking save failed: {}\n", result.error());
+        return 1;
+    }
+
+    // ===== Snapshot: pin every chunk, save on a worker, keep editing =====
+    start = Clock::now();
+    std::vector<PinnedChunk> pinned;
+    pinned.reserve(coords.size());
+    for (size_t i = 0; i < coords.size(); ++i) {
+        pinned.push_back(PinnedChunk{ coords[i], chunks[i].Pin() });
+    }
+    SnapshotSaver saver;
+    result = saver.Start(std::move(pinned), snapshotDirectory);
+    const double pinUs = std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+    if (!result) {
+        fmt::print("snapshot failed to start: {}\n", result.error());
+        return 1;
+    }
+
+    uint32_t frames = 0;
+    uint32_t editIndex = 0;
+    size_t clones = 0;
+    size_t cloneBytes = 0;
+    double maxFrameMs = 0.0;
+    std::vector<uint8_t> edited(coords.size(), 0);
+    std::vector<std::vector<uint32_t>> expected = reference;     // The live version
+    std::vector<uint32_t> readback(voxelCount);
+    do {
+        const auto frameStart = Clock::now();
+        for (uint32_t e = 0; e < EDITS_PER_FRAME; ++e) {
+            const uint32_t hash = Utils::PCGHash(editIndex++);
+            const size_t i = hash % coords.size();
+            if (chunks[i].IsShared()) {
+                ++clones;
+                cloneBytes += chunks[i].Get().GetResidentBytes();
+            }
+            // A GPU write of one voxel, read back
+            chunks[i].Get().Decode(readback.data());
+            const uint32_t index = Utils::PCGHash(hash) % static_cast<uint32_t>(voxelCount);
+            readback[index] = Utils::PackVoxel(Utils::Material::Sand, 0, 0, 0);
+            chunks[i].Edit().Encode(readback.data());
+            expected[i][index] = readback[index];
+            edited[i] = 1;
+        }
+        maxFrameMs = std::max(maxFrameMs, std::chrono::duration<double, std::milli>(Clock::now() - frameStart).count());
+        ++frames;
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));     // The rest of the frame
+    } while (!saver.IsFinished());
+    result = saver.Wait();
+    const double snapshotMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    if (!result) {
+        fmt::print("snapshot save failed: {}\n", result.error());
+        std::filesystem::remove_all(snapshotDirectory, error);
+        return 1;
+    }
+
+    // ===== The snapshot holds the voxels as pinned, edits or not =====
+    bool exact = static_cast<bool>(store.Open(snapshotDirectory));
+    std::vector<uint32_t> decoded(voxelCount);
+    PalettedVoxels loaded;
+    for (size_t i = 0; i < coords.size() && exact; ++i) {
+        auto found = store.LoadChunk(coords[i], loaded);
+        exact = found && found.Value();
+        if (exact) {
+            loaded.Decode(decoded.data());
+            exact = decoded == reference[i];
+        }
+    }
+    store.Close();
+    std::filesystem::remove_all(snapshotDirectory, error);
+
+    // ===== The live chunks hold every edit made while pinned =====
+    bool liveExact = true;
+    for (size_t i = 0; i < coords.size() && liveExact; ++i) {
+        chunks[i].Get().Decode(decoded.data());
+        liveExact = decoded == expected[i] && chunks[i].IsModified() == (edited[i] != 0);
+    }
+
+    // ===== One more edit under a pin, whatever the save's timing was =====
+    std::shared_ptr<const PalettedVoxels> pin = chunks[0].Pin();
+    chunks[0].Get().Decode(readback.data());
+    readback[0] = Utils::PackVoxel(Utils::Material::Lava, 0, 0, 0);
+    chunks[0].Edit().Encode(readback.data());
+    pin->Decode(decoded.data());
+    bool pinnedExact = decoded == expected[0];
+    chunks[0].Get().Decode(decoded.data());
+    pinnedExact = pinnedExact && decoded == readback && chunks[0].IsModified();
+    pin.reset();
+
+    size_t editedChunks = 0;
+    for (uint8_t flag : edited) {
+        editedChunks += flag;
+    }
+    fmt::print("blocking save: {:.2f} ms frame stall\n", blockingMs);
+    fmt::print("snapshot: pinned and started in {:.1f} us, written in {:.2f} ms in the background\n", pinUs, snapshotMs);
+    fmt::print("frames during the save: {} ({} edits each, {:.3f} ms max edit time)\n", frames, EDITS_PER_FRAME, maxFrameMs);
+    fmt::print("copy-on-write: {} of {} chunks cloned ({} edited), {:.1f} KB extra ({:.1f}% of resident)\n",
+        clones, coords.size(), editedChunks, cloneBytes / 1024.0, 100.0 * cloneBytes / static_cast<double>(residentBytes));
+    fmt::print("snapshot contents: {}\n", exact ? "exact (as pinned)" : "MISMATCH");
+    fmt::print("live chunks: {}\n", liveExact ? "exact (every edit, marked modified)" : "MISMATCH");
+    fmt::print("edit under a pin: {}\n", pinnedExact ? "pinned version unchanged, live version edited" : "MISMATCH");
+    return exact && liveExact && pinnedExact ? 0 : 1;
+}
+
+} // namespace VENPOD::Bench
@@ -0,0 +1,160 @@
+// =============================================================================
+// VENPOD Bench - streaming
+//
+// streaming: walks the camera --ticks chunk boundaries (mostly along X, with
+// Z and Y steps mixed in) at render distances 8 to 48 and keeps a loaded set
+// up to date two ways: rescanning the whole render cylinder plus every
+// loaded chunk (the old loader), and visiting only the entering / leaving
+// shells (ChunkCylinder). Reports coordinates visited and microseconds per
+// boundary crossing; both loaded sets must stay identical.
+// =============================================================================
+
+#include "BenchCommon.h"
+#include "Simulation/ChunkCoordMap.h"
+#include "Simulation/ChunkCylinder.h"
+#include "Utils/PCGRandom.h"
+#include <algorithm>
+#include <chrono>
+
+namespace VENPOD::Bench {
+
+using namespace Simulation;
+
+namespace {
+
+struct StreamingResult {
+    double microsPerStep = 0.0;
+    double visitedPerStep = 0.0;    // Coordinates tested (cylinder cells + loaded chunks walked)
+    uint64_t checksum = 0;
+};
+
+// Loaded set after each step, order independent
+uint64_t LoadedSetChecksum(const ChunkCoordMap<uint32_t>& loaded) {
+    uint64_t sum = loaded.Size();
+    for (const auto& [coord, value] : loaded) {
+        sum += coord.Hash();
+    }
+    return sum;
+}
+
+StreamingResult RunStreamingCase(const std::vector<ChunkCoord>& path, ChunkCylinder load, ChunkCylinder unload,
+                                 bool shells, std::vector<uint64_t>& stepChecksums) {
+    using Clock = std::chrono::steady_clock;
+    ChunkCoordMap<uint32_t> loaded;
+    std::vector<ChunkCoord> leaving;
+    uint64_t visited = 0;
+    double totalSeconds = 0.0;
+
+    for (size_t step = 0; step < path.size(); ++step) {
+        const ChunkCoord& camera = path[step];
+        const ChunkCoord* previous = step > 0 ? &path[step - 1] : nullptr;
+        // The first step fills the cylinder the same way for both and is not timed
+        auto start = Clock::now();
+
+        if (shells) {
+            load.ForEachChunkEntering(previous, camera, [&](const ChunkCoord& coord) {
+                ++visited;
+                if (!loaded.Contains(coord)) {
+                    loaded.Insert(coord, 1);
+                }
+            });
+            leaving.clear();
+            if (previous) {
+                unload.ForEachChunkEntering(&camera, *previous, [&](const ChunkCoord& coord) {
+                    ++visited;
+                    if (loaded.Contains(coord)) {
+                        leaving.push_back(coord);
+                    }
+                });
+            }
+        } else {
+            // Old QueueChunksAroundCamera + UnloadDistantChunks
+            const int32_t maxHorizDistSq = load.horizontal * load.horizontal;
+            for (int32_t dy = -load.vertical; dy <= load.vertical; ++dy) {
+                for (int32_t dx = -load.horizontal; dx <= load.horizontal; ++dx) {
+                    for (int32_t dz = -load.horizontal; dz <= load.horizontal; ++dz) {
+                        ++visited;
+                        if (dx * dx + dz * dz > maxHorizDistSq) {
+                            continue;
+                        }
+                        ChunkCoord coord{ camera.x + dx, camera.y + dy, camera.z + dz };
+                        if (!loaded.Contains(coord)) {
+                            loaded.Insert(coord, 1);
+                        }
+                    }
+                }
+            }
+            leaving.clear();
+            for (const auto& [coord, value] : loaded) {
+                ++visited;
+                if (!unload.Contains(camera, coord)) {
+                    leaving.push_back(coord);
+                }
+            }
+        }
+        for (const ChunkCoord& coord : leaving) {
+            loaded.Erase(coord);
+        }
+
+        if (step > 0) {
+            totalSeconds += std::chrono::duration<double>(Clock::now() - start).count();
+        } else {
+            visited = 0;
+        }
+        stepChecksums.push_back(LoadedSetChecksum(loaded));
+    }
+
+    StreamingResult result;
+    const double steps = static_cast<double>(path.size() - 1);
+    result.microsPerStep = totalSeconds * 1e6 / steps;
+    result.visitedPerStep = visited / steps;
+    for (uint64_t checksum : stepChecksums) {
+        result.checksum = result.checksum * 31 + checksum;
+    }
+    return result;
+}
+
+} // namespace
+
+int RunStreaming(const BenchOptions& options) {
+    // Camera path: one chunk boundary per step, mostly +X, some Z and Y
+    std::vector<ChunkCoord> path{ ChunkCoord{ 0, 0, 0 } };
+    for (uint32_t step = 0; step < std::max(options.ticks, 1u); ++step) {
+        ChunkCoord next = path.back();
+        uint32_t r = Utils::PCGHash(step) % 8;
+        if (r < 5) {
+            next.x += 1;
+        } else if (r < 7) {
+            next.z += (r == 5) ? 1 : -1;
+        } else {
+            next.y += (Utils::PCGHash(step + 7919) & 1) ? 1 : -1;
+        }
+        path.push_back(next);
+    }
+
+    fmt::print("{} chunk boundary crossings\n", path.size() - 1);
+    fmt::print("{:>10} {:>10} {:>16} {:>16} {:>14} {:>14} {:>9}\n",
+        "render", "cylinder", "rescan visited", "shell visited", "rescan us", "shell us", "speedup");
+
+    for (int32_t horizontal : { 8, 16, 32, 48 }) {
+        ChunkCylinder load{ horizontal, std::max(2, horizontal / 4) };
+        ChunkCylinder unload{ load.horizontal + 2, load.vertical + 2 };
+
+        std::vector<uint64_t> rescanSteps, shellSteps;
+        StreamingResult rescan = RunStreamingCase(path, load, unload, false, rescanSteps);
+        StreamingResult shell = RunStreamingCase(path, load, unload, true, shellSteps);
+        if (rescanSteps != shellSteps) {
+            spdlog::error("Shell streaming diverged from the full rescan at render distance {}", horizontal);
+            return 2;
+        }
+
+        size_t cylinderChunks = 0;
+        load.ForEachChunkEntering(nullptr, ChunkCoord{ 0, 0, 0 }, [&](const ChunkCoord&) { ++cylinderChunks; });
+        fmt::print("{:>7}x{:<2} {:>10} {:>16.0f} {:>16.0f} {:>14.1f} {:>14.1f} {:>8.1f}x\n",
+            load.horizontal, load.vertical, cylinderChunks, rescan.visitedPerStep, shell.visitedPerStep,
+            rescan.microsPerStep, shell.microsPerStep, rescan.microsPerStep / shell.microsPerStep);
+    }
+    return 0;
+}
+
+} // namespace VENPOD::Bench
@@ -0,0 +1,210 @@
+// =============================================================================
+// VENPOD Bench - terrain
+//
+// terrain: generates --ticks 64³ chunks (four vertical layers: deep, sea
+// level, hills, mountains) with the CPU port of CS_GenerateChunk: serially
+// without and with the TerrainColumnCache, then through AsyncChunkGenerator
+// with 1, 2, 4, ... up to --threads workers. Reports chunks/s, voxels/s,
+// speedup, compressed size and the material mix; every cached and async
+// chunk must match the uncached serial voxels, and every chunk the column
+// heights predict uniform must come out as that one value. When the CPU has
+// AVX2 the serial run is repeated on the scalar noise backend as well. Last,
+// the resident bytes per loaded chunk at the default render and unload
+// distances: palette voxels for every loaded chunk, a 1 MB GPU buffer only
+// for non-uniform chunks in the render window (before: every loaded one).
+// =============================================================================
+
+#include "BenchCommon.h"
+#include "Simulation/TerrainGenerator.h"
+#include "Simulation/TerrainColumnCache.h"
+#include "Simulation/AsyncChunkGenerator.h"
+#include "Simulation/ChunkCylinder.h"
+#include "Utils/BitPacking.h"
+#include "Utils/SimplexNoiseBatch.h"
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <utility>
+
+namespace VENPOD::Bench {
+
+using namespace Simulation;
+
+int RunTerrain(const BenchOptions& options) {
+    using Clock = std::chrono::steady_clock;
+    const uint32_t chunkSize = 64;
+    const uint32_t seed = 12345;
+    const size_t voxelCount = static_cast<size_t>(chunkSize) * chunkSize * chunkSize;
+
+    const std::vector<ChunkCoord> coords = MakeTerrainBenchChunks(options.ticks);
+
+    // ===== Serial reference =====
+    std::vector<std::vector<uint32_t>> reference(coords.size(), std::vector<uint32_t>(voxelCount));
+    auto start = Clock::now();
+    for (size_t i = 0; i < coords.size(); ++i) {
+        int32_t ox, oy, oz;
+        coords[i].GetWorldOrigin(ox, oy, oz, chunkSize);
+        GenerateChunkVoxels(ox, oy, oz, chunkSize, seed, reference[i].data());
+    }
+    double serialSeconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+    uint64_t materialCounts[256] = {};
+    for (const auto& voxels : reference) {
+        for (uint32_t voxel : voxels) {
+            ++materialCounts[Utils::UnpackMaterial(voxel)];
+        }
+    }
+    const double totalVoxels = static_cast<double>(voxelCount) * coords.size();
+    fmt::print("{} chunks of {}³, seed {}, {} noise\n", coords.size(), chunkSize, seed,
+        Utils::GetNoiseBackendName(Utils::GetNoiseBackend()));
+    fmt::print("material mix:");
+    const std::pair<uint8_t, const char*> materials[] = {
+        { Utils::Material::Air, "air" }, { Utils::Material::Water, "water" }, { Utils::Material::Stone, "stone" },
+        { Utils::Material::Dirt, "dirt" }, { Utils::Material::Sand, "sand" }, { Utils::Material::Ice, "ice" },
+        { Utils::Material::Lava, "lava" }, { Utils::Material::Bedrock, "bedrock" } };
+    for (const auto& [material, name] : materials) {
+        fmt::print(" {} {:.2f}%", name, 100.0 * materialCounts[material] / totalVoxels);
+    }
+    fmt::print("\n");
+
+    fmt::print("{:>10} {:>12} {:>14} {:>9} {:>14}\n", "workers", "chunks/s", "Mvoxels/s", "speedup", "KB/chunk");
+    const double serialRate = coords.size() / serialSeconds;
+    fmt::print("{:>10} {:>12.1f} {:>14.1f} {:>9} {:>14}\n", "serial", serialRate, serialRate * voxelCount / 1e6, "1.0x", "-");
+
+    // ===== Serial on the scalar noise backend (the reference above used the default one) =====
+    const Utils::NoiseBackend defaultBackend = Utils::GetNoiseBackend();
+    if (defaultBackend != Utils::NoiseBackend::Scalar) {
+        Utils::SetNoiseBackend(Utils::NoiseBackend::Scalar);
+        std::vector<uint32_t> voxels(voxelCount);
+        double scalarSeconds = 0.0;
+        bool matches = true;
+        for (size_t i = 0; i < coords.size() && matches; ++i) {
+            int32_t ox, oy, oz;
+            coords[i].GetWorldOrigin(ox, oy, oz, chunkSize);
+            start = Clock::now();
+            GenerateChunkVoxels(ox, oy, oz, chunkSize, seed, voxels.data());
+            scalarSeconds += std::chrono::duration<double>(Clock::now() - start).count();
+            matches = voxels == reference[i];
+        }
+        Utils::SetNoiseBackend(defaultBackend);
+        if (!matches) {
+            spdlog::error("Scalar noise backend generated different terrain than {}",
+                Utils::GetNoiseBackendName(defaultBackend));
+            return 2;
+        }
+        const double scalarRate = coords.size() / scalarSeconds;
+        fmt::print("{:>10} {:>12.1f} {:>14.1f} {:>8.1f}x {:>14}\n", "scalar", scalarRate, scalarRate * voxelCount / 1e6,
+            scalarRate / serialRate, "-");
+    }
+
+    // ===== Serial with the column cache: height / biome once per chunk column =====
+    {
+        TerrainColumnCache columnCache;
+        columnCache.Initialize(chunkSize, seed);
+        std::vector<uint32_t> voxels(voxelCount);
+        double cachedSeconds = 0.0;
+        size_t predicted = 0;
+        for (size_t i = 0; i < coords.size(); ++i) {
+            int32_t ox, oy, oz;
+            coords[i].GetWorldOrigin(ox, oy, oz, chunkSize);
+            start = Clock::now();
+            auto column = columnCache.Acquire(coords[i].x, coords[i].z);
+            GenerateChunkVoxels(ox, oy, oz, chunkSize, seed, voxels.data(), column.get());
+            cachedSeconds += std::chrono::duration<double>(Clock::now() - start).count();
+            if (voxels != reference[i]) {
+                spdlog::error("Column-cached chunk [{},{},{}] differs from the uncached generator",
+                    coords[i].x, coords[i].y, coords[i].z);
+                return 2;
+            }
+
+            uint32_t uniformVoxel = 0;
+            if (PredictUniformChunk(oy, chunkSize, *column, uniformVoxel)) {
+                ++predicted;
+                bool uniform = std::all_of(voxels.begin(), voxels.end(), [&](uint32_t voxel) {
+                    return Utils::UnpackMaterial(voxel) == Utils::UnpackMaterial(uniformVoxel) &&
+                           Utils::UnpackState(voxel) == Utils::UnpackState(uniformVoxel);
+                });
+                if (!uniform) {
+                    spdlog::error("Chunk [{},{},{}] predicted uniform but generated mixed",
+                        coords[i].x, coords[i].y, coords[i].z);
+                    return 2;
+                }
+            }
+        }
+        const double cachedRate = coords.size() / cachedSeconds;
+        fmt::print("{:>10} {:>12.1f} {:>14.1f} {:>8.1f}x {:>14}\n", "cached", cachedRate, cachedRate * voxelCount / 1e6,
+            cachedRate / serialRate, "-");
+        TerrainColumnCacheStats stats = columnCache.GetStats();
+        fmt::print("column cache: {} columns ({:.0f} KB), {} hits, {} misses\n",
+            columnCache.GetSize(), columnCache.GetResidentBytes() / 1024.0, stats.hits, stats.misses);
+        fmt::print("column heights predict {} of {} chunks uniform\n", predicted, coords.size());
+    }
+
+    // ===== Async workers =====
+    uint32_t maxWorkers = options.threads > 0 ? options.threads : std::max(1u, std::thread::hardware_concurrency());
+    std::vector<uint32_t> decoded(voxelCount);
+    size_t residentBytes = 0;
+    size_t uniformChunks = 0;
+    for (uint32_t workers = 1; ; workers = std::min(workers * 2, maxWorkers)) {
+        AsyncChunkGenerator generator;
+        generator.Initialize(workers, seed, chunkSize);
+
+        start = Clock::now();
+        for (const ChunkCoord& coord : coords) {
+            generator.Submit(coord);
+        }
+        generator.WaitIdle();
+        double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+        std::vector<GeneratedChunk> results;
+        generator.PollCompleted(results);
+        generator.Shutdown();
+
+        residentBytes = 0;
+        uniformChunks = 0;
+        for (const GeneratedChunk& result : results) {
+            size_t index = std::find(coords.begin(), coords.end(), result.coord) - coords.begin();
+            result.voxels.Decode(decoded.data());
+            if (index == coords.size() || decoded != reference[index]) {
+                spdlog::error("Async chunk [{},{},{}] differs from the serial generator",
+                    result.coord.x, result.coord.y, result.coord.z);
+                return 2;
+            }
+            residentBytes += result.voxels.GetResidentBytes();
+            if (result.voxels.IsUniform() && result.voxels.GetVariantExceptionCount() == 0) {
+                ++uniformChunks;
+            }
+        }
+        if (results.size() != coords.size()) {
+            spdlog::error("Async generator returned {} of {} chunks", results.size(), coords.size());
+            return 2;
+        }
+
+        double rate = coords.size() / seconds;
+        fmt::print("{:>10} {:>12.1f} {:>14.1f} {:>8.1f}x {:>14.1f}\n", workers, rate, rate * voxelCount / 1e6,
+            rate / serialRate, residentBytes / 1024.0 / results.size());
+        if (workers == maxWorkers) {
+            break;
+        }
+    }
+
+    // ===== Resident bytes per loaded chunk (this chunk mix) =====
+    // InfiniteChunkConfig defaults: render ±8 x ±2, unload ±10 x ±4
+    const ChunkCylinder render{ 8, 2 };
+    const ChunkCylinder unload{ 10, 4 };
+    size_t renderCount = 0;
+    size_t loadedCount = 0;
+    render.ForEachChunkEntering(nullptr, ChunkCoord{}, [&](const ChunkCoord&) { ++renderCount; });
+    unload.ForEachChunkEntering(nullptr, ChunkCoord{}, [&](const ChunkCoord&) { ++loadedCount; });
+
+    const double mixedShare = 1.0 - static_cast<double>(uniformChunks) / coords.size();
+    const double cpuKB = residentBytes / 1024.0 / coords.size();
+    const double bufferKB = voxelCount * sizeof(uint32_t) / 1024.0;
+    const double gpuKB = bufferKB * mixedShare * renderCount / loadedCount;
+    fmt::print("resident per loaded chunk ({} loaded, {} in the render window, {:.1f}% uniform): "
+               "{:.1f} KB CPU + {:.1f} KB GPU (before: {:.1f} KB GPU)\n",
+        loadedCount, renderCount, 100.0 * (1.0 - mixedShare), cpuKB, gpuKB, bufferKB * mixedShare);
+    return 0;
+}
+
+} // namespace VENPOD::Bench
@@ -0,0 +1,143 @@
+// =============================================================================
+// VENPOD Bench - Headless benchmarks for the CPU simulation
+//
+// Usage:
+//   venpod_bench scaling [--grid N] [--ticks N] [--max-threads N] [--unordered] [--bitboard]
+//   venpod_bench liquid  [--grid N] [--ticks N] [--threads N] [--bitboard]
+//   venpod_bench sleep   [--grid N] [--ticks N] [--threads N] [--bitboard]
+//   venpod_bench clock   [--grid N] [--ticks N] [--threads N] [--rate N] [--substeps N]
+//   venpod_bench scenarios [--scenario NAME] [--grid N] [--ticks N] [--threads N] [--bitboard]
+//                          [--validate] [--out FILE]
+//   venpod_bench palette [--ticks N]
+//   venpod_bench coordmap [--ticks N]
+//   venpod_bench genqueue [--ticks N]
+//   venpod_bench streaming [--ticks N]
+//   venpod_bench terrain [--ticks N] [--threads N]
+//   venpod_bench noise [--ticks N]
+//   venpod_bench caves [--ticks N]
+//   venpod_bench region [--ticks N]
+//   venpod_bench rle [--ticks N]
+//   venpod_bench lz [--ticks N]
+//   venpod_bench journal [--grid N] [--ticks N] [--threads N]
+//   venpod_bench snapshot [--ticks N]
+//
+// Each subcommand lives in tools/bench/<Name>Bench.cpp, whose header
+// describes what it measures and checks.
+// =============================================================================
+
+#include "BenchCommon.h"
+#include <cstdlib>
+#include <cstring>
+
+using namespace VENPOD::Bench;
+using VENPOD::Simulation::CPUKernelMode;
+using VENPOD::Simulation::CPUScheduleMode;
+
+namespace {
+
+struct BenchCommand {
+    const char* name;           // First command line argument
+    const char* arguments;      // Usage line after the name
+    int (*run)(const BenchOptions& options);
+    uint32_t gridSize;          // Defaults, overridden by --grid / --ticks
+    uint32_t ticks;
+};
+
+// All subcommands, in usage order
+constexpr BenchCommand kCommands[] = {
+    { "scaling",   "[--grid N] [--ticks N] [--max-threads N] [--unordered] [--bitboard]", RunScaling, 128, 100 },
+    { "liquid",    "[--grid N] [--ticks N] [--threads N] [--bitboard]", RunLiquid, 256, 30 },
+    { "sleep",     "[--grid N] [--ticks N] [--threads N] [--bitboard]", RunSleep, 96, 400 },
+    { "clock",     "[--grid N] [--ticks N] [--threads N] [--rate N] [--substeps N]", RunClock, 64, 600 },
+    { "scenarios", "[--scenario NAME] [--grid N] [--ticks N] [--threads N] [--bitboard]\n"
+                   "                              [--validate] [--out FILE]", RunScenarios, 128, 200 },
+    { "palette",   "[--ticks N]", RunPalette, 128, 20 },
+    { "coordmap",  "[--ticks N]", RunCoordMap, 128, 50 },
+    { "genqueue",  "[--ticks N]", RunGenQueue, 128, 200 },
+    { "streaming", "[--ticks N]", RunStreaming, 128, 200 },
+    { "terrain",   "[--ticks N] [--threads N]", RunTerrain, 128, 32 },
+    { "noise",     "[--ticks N]", RunNoise, 128, 20 },
+    { "caves",     "[--ticks N]", RunCaves, 128, 32 },
+    { "region",    "[--ticks N]", RunRegion, 128, 64 },
+    { "rle",       "[--ticks N]", RunRle, 128, 10 },
+    { "lz",        "[--ticks N]", RunLz, 128, 10 },
+    { "journal",   "[--grid N] [--ticks N] [--threads N]", RunJournal, 96, 300 },
+    { "snapshot",  "[--ticks N]", RunSnapshot, 128, 64 },
+};
+
+void PrintUsage() {
+    const char* prefix = "Usage:";
+    for (const BenchCommand& command : kCommands) {
+        fmt::print("{:>6} venpod_bench {} {}\n", prefix, command.name, command.arguments);
+        prefix = "";
+    }
+}
+
+bool ParseOptions(int argc, char** argv, int first, BenchOptions& options) {
+    for (int i = first; i < argc; ++i) {
+        auto nextValue = [&](uint32_t& out) {
+            if (i + 1 >= argc) {
+                return false;
+            }
+            out = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+            return out > 0;
+        };
+
+        if (std::strcmp(argv[i], "--grid") == 0) {
+            if (!nextValue(options.gridSize)) return false;
+        } else if (std::strcmp(argv[i], "--ticks") == 0) {
+            if (!nextValue(options.ticks)) return false;
+        } else if (std::strcmp(argv[i], "--max-threads") == 0) {
+            if (!nextValue(options.maxThreads)) return false;
+        } else if (std::strcmp(argv[i], "--threads") == 0) {
+            if (!nextValue(options.threads)) return false;
+        } else if (std::strcmp(argv[i], "--rate") == 0) {
+            if (!nextValue(options.rate)) return false;
+        } else if (std::strcmp(argv[i], "--substeps") == 0) {
+            if (!nextValue(options.substeps)) return false;
+        } else if (std::strcmp(argv[i], "--scenario") == 0) {
+            if (i + 1 >= argc) return false;
+            options.scenario = argv[++i];
+        } else if (std::strcmp(argv[i], "--out") == 0) {
+            if (i + 1 >= argc) return false;
+            options.outPath = argv[++i];
+        } else if (std::strcmp(argv[i], "--validate") == 0) {
+            options.validateMass = true;
+        } else if (std::strcmp(argv[i], "--unordered") == 0) {
+            options.scheduleMode = CPUScheduleMode::Unordered;
+        } else if (std::strcmp(argv[i], "--bitboard") == 0) {
+            options.kernelMode = CPUKernelMode::Bitboard;
+        } else {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    spdlog::set_level(spdlog::level::warn);
+
+    if (argc < 2) {
+        PrintUsage();
+        return 1;
+    }
+
+    for (const BenchCommand& command : kCommands) {
+        if (std::strcmp(argv[1], command.name) != 0) {
+            continue;
+        }
+        BenchOptions options;
+        options.gridSize = command.gridSize;
+        options.ticks = command.ticks;
+        if (!ParseOptions(argc, argv, 2, options)) {
+            PrintUsage();
+            return 1;
+        }
+        return command.run(options);
+    }
+
+    PrintUsage();
+    return 1;
+}
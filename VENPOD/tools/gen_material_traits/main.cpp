@@ -0,0 +1,131 @@
+// =============================================================================
+// VENPOD Material Traits Generator - Emits MaterialTraits.hlsli from the C++ table
+//
+// Usage:
+//   venpod_gen_material_traits <output.hlsli>
+//
+// Writes MATERIAL_TRAITS (src/Simulation/MaterialTraits.h) as static HLSL
+// arrays plus the lookup helpers used by the compute shaders, so the CPU and
+// GPU paths classify materials from the same data. Run through the
+// generate_material_traits target after editing the table.
+// =============================================================================
+
+#include "Simulation/MaterialTraits.h"
+#include <fmt/format.h>
+#include <fmt/os.h>
+#include <cstdint>
+#include <string>
+
+using namespace VENPOD::Simulation;
+
+namespace {
+
+struct FlagName {
+    const char* name;
+    uint32_t value;
+};
+
+constexpr FlagName kFlagNames[] = {
+    { "MATFLAG_MOVABLE",     MaterialFlag::Movable },
+    { "MATFLAG_LIQUID",      MaterialFlag::Liquid },
+    { "MATFLAG_GAS",         MaterialFlag::Gas },
+    { "MATFLAG_FLAMMABLE",   MaterialFlag::Flammable },
+    { "MATFLAG_DISSOLVABLE", MaterialFlag::Dissolvable },
+    { "MATFLAG_HEAT_SOURCE", MaterialFlag::HeatSource },
+    { "MATFLAG_POWDER",      MaterialFlag::Powder },
+    { "MATFLAG_SOLID",       MaterialFlag::Solid },
+    { "MATFLAG_ACTIVE",      MaterialFlag::Active },
+    { "MATFLAG_RESTLESS",    MaterialFlag::Restless },
+};
+
+// One 256-entry static array, 8 values per line
+template <typename Getter>
+std::string EmitTable(const char* name, const char* comment, Getter getter) {
+    std::string out = fmt::format("// {}\nstatic const uint {}[256] = {{\n", comment, name);
+    for (uint32_t i = 0; i < 256; ++i) {
+        if (i % 8 == 0) {
+            out += "    ";
+        }
+        out += fmt::format("0x{:08X}u{}", getter(MATERIAL_TRAITS[i]), i + 1 < 256 ? "," : "");
+        out += (i % 8 == 7) ? "\n" : " ";
+    }
+    out += "};\n\n";
+    return out;
+}
+
+std::string GenerateHLSL() {
+    std::string out;
+    out += "// =============================================================================\n";
+    out += "// VENPOD Material Traits - GENERATED from src/Simulation/MaterialTraits.h\n";
+    out += "// Do not edit by hand: change the C++ table and build generate_material_traits.\n";
+    out += "// =============================================================================\n\n";
+    out += "#ifndef MATERIAL_TRAITS_HLSLI\n#define MATERIAL_TRAITS_HLSLI\n\n";
+
+    out += "// Trait flags\n";
+    for (const FlagName& flag : kFlagNames) {
+        out += fmt::format("#define {:<20} 0x{:03X}u\n", flag.name, flag.value);
+    }
+    out += "\n";
+
+    out += EmitTable("MaterialFlagsTable", "MATFLAG_* bits per material",
+                     [](const MaterialTraits& t) { return t.flags; });
+    out += EmitTable("MaterialParamsTable", "density | viscosity << 8 | flammability << 16 | lifetime << 24",
+                     [](const MaterialTraits& t) {
+                         return static_cast<uint32_t>(t.density) | (static_cast<uint32_t>(t.viscosity) << 8) |
+                                (static_cast<uint32_t>(t.flammability) << 16) |
+                                (static_cast<uint32_t>(t.lifetime) << 24);
+                     });
+    out += EmitTable("MaterialReactsTable", "Bit N set: reacts on contact with material N (N < 32)",
+                     [](const MaterialTraits& t) { return t.reactsWith; });
+
+    out += R"(uint GetMaterialFlags(uint material) {
+    return MaterialFlagsTable[material & 0xFF];
+}
+
+bool MaterialHasFlag(uint material, uint flag) {
+    return (MaterialFlagsTable[material & 0xFF] & flag) != 0;
+}
+
+uint GetMaterialDensity(uint material) {
+    return MaterialParamsTable[material & 0xFF] & 0xFF;
+}
+
+bool MaterialsReact(uint a, uint b) {
+    return b < 32 && (MaterialReactsTable[a & 0xFF] & (1u << b)) != 0;
+}
+
+// Density displacement: a falling voxel sinks through a lighter liquid or gas
+// below it, unless the two react on contact instead
+bool CanDisplaceMaterial(uint self, uint below) {
+    uint selfFlags = GetMaterialFlags(self);
+    return (selfFlags & MATFLAG_MOVABLE) != 0 &&
+           (selfFlags & MATFLAG_GAS) == 0 &&
+           MaterialHasFlag(below, MATFLAG_LIQUID | MATFLAG_GAS) &&
+           GetMaterialDensity(self) > GetMaterialDensity(below) &&
+           !MaterialsReact(self, below);
+}
+
+#endif // MATERIAL_TRAITS_HLSLI
+)";
+    return out;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    if (argc != 2) {
+        fmt::print("Usage: venpod_gen_material_traits <output.hlsli>\n");
+        return 1;
+    }
+
+    try {
+        auto file = fmt::output_file(argv[1]);
+        file.print("{}", GenerateHLSL());
+    } catch (const std::exception& e) {
+        fmt::print("Failed to write {}: {}\n", argv[1], e.what());
+        return 1;
+    }
+
+    fmt::print("Wrote {}\n", argv[1]);
+    return 0;
+}